@@ -5,9 +5,9 @@
 namespace FastContainer {
 
 	/*O*/
-	class fast_container_exception :public std::exception {
+	class fast_container_exception :public std::runtime_error {
 	public:
-		fast_container_exception(const char *s = "fast_container_exception") : std::exception(s) {}
+		fast_container_exception(const char *s = "fast_container_exception") : std::runtime_error(s) {}
 	};
 
 }
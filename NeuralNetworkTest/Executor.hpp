@@ -0,0 +1,39 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	ubNPʂ̏̎s
+	parallel_for_range(first, last, func): [first, last)𕪊 func(begin, end) s
+	get_concurrency(): ɎsubN̖ڈ
+	(ThreadPooľ`𖞂)
+	*/
+
+	/*s*/
+	class SerialExecutor {
+	public:
+		int get_concurrency() { return 1; }
+		template<class F>
+		void parallel_for_range(int first, int last, F func, int = 1) {
+			if (first < last) func(first, last);
+		}
+	};
+
+	/*PPLŕs*/
+	class PplExecutor {
+	public:
+		int get_concurrency() { return std::max((int)std::thread::hardware_concurrency(), 1); }
+		template<class F>
+		void parallel_for_range(int first, int last, F func, int grain = 1) {
+			if (grain < 1) grain = 1;
+			int block_num = (last - first + grain - 1) / grain;
+			concurrency::parallel_for<int>(0, block_num, [&](int i) {
+				int begin = first + i * grain;
+				func(begin, std::min(begin + grain, last));
+			});
+		}
+	};
+
+}
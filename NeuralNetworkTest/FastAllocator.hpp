@@ -0,0 +1,295 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*FastMatrix, FastVector̗̈̋E (LbVCAAVX-512̃WX^)*/
+	const size_t FAST_CONTAINER_ALIGNMENT = 64;
+
+	/*
+	̈̊mە
+	allocate: alignmentEɑbytesȏ̗̈Ԃ
+	deallocate: allocateŊmۂ̈ (bytes͊mێƓl)
+	*/
+	class MemoryResource {
+	public:
+		virtual ~MemoryResource() { }
+		virtual void *allocate(size_t bytes) = 0;
+		virtual void deallocate(void *ptr, size_t bytes) = 0;
+	};
+
+	/*E𑵂Ċm*/
+	inline void *aligned_malloc(size_t bytes) {
+#ifdef _MSC_VER
+		void *ptr = _aligned_malloc(bytes, FAST_CONTAINER_ALIGNMENT);
+#else
+		void *ptr = nullptr;
+		if (posix_memalign(&ptr, FAST_CONTAINER_ALIGNMENT, bytes) != 0) ptr = nullptr;
+#endif
+		if (ptr == nullptr) throw std::bad_alloc();
+		return ptr;
+	}
+	inline void aligned_free(void *ptr) {
+#ifdef _MSC_VER
+		_aligned_free(ptr);
+#else
+		free(ptr);
+#endif
+	}
+
+	/*E𑵂Ėm (v[Ȃ)*/
+	class AlignedResource :public MemoryResource {
+	public:
+		void *allocate(size_t bytes) override { return aligned_malloc(std::max(bytes, (size_t)1)); }
+		void deallocate(void *ptr, size_t) override { aligned_free(ptr); }
+	};
+
+	/*̈̓v*/
+	struct MemoryStatistics {
+		/*mۂ̉*/
+		long long allocations = 0;
+		/*v[ėp*/
+		long long hits = 0;
+		/*VɊmۂ*/
+		long long misses = 0;
+		/*gp̃oCg (TCYNXɐ؂グl)*/
+		long long bytes_in_flight = 0;
+		/*gp̃oCg̍ől*/
+		long long peak_bytes_in_flight = 0;
+		/*v[ɕێĂoCg*/
+		long long bytes_cached = 0;
+	};
+
+	/*
+	TCYNXɃv[mە
+	TCYNX2ׂ̂4傫 (؂グɂ閳ʂ25%ȉ)
+	ꂽ̈̓Xbh̃LbVɖ߂Aӂꂽ͋L̃v[ɖ߂
+	POOL_MAX_BYTES 𒴂̈̓v[Ȃ
+	Xbh̃LbV̓vZX1Ȃ̂ŁACX^X get_instance() 1
+	*/
+	class PooledResource :public MemoryResource {
+	public:
+		static const size_t POOL_MAX_BYTES = (size_t)1 << 30;
+		/*TCYNX̐ (POOL_MAX_BYTES = 2^30 ܂ (2^29, 2^30] ̍Ō̃NX܂)*/
+		static const int CLASS_NUM = (30 - 6) * 4 + 1;
+		static const int THREAD_CACHE_COUNT = 4;
+		static const size_t THREAD_CACHE_MAX_BYTES = (size_t)1 << 22;
+
+		/*vZXʂ̃CX^X (ỈɈˑȂ悤jȂ)*/
+		static PooledResource& get_instance() {
+			static PooledResource *resource = new PooledResource();
+			return *resource;
+		}
+		PooledResource(const PooledResource&) = delete;
+		PooledResource& operator=(const PooledResource&) = delete;
+
+		/*bytes܂ރTCYNX*/
+		static int get_size_class(size_t bytes) {
+			if (bytes <= FAST_CONTAINER_ALIGNMENT) return 0;
+			int log2 = 0;
+			while (((size_t)1 << (log2 + 1)) < bytes) log2++;
+			//(2^log2, 2^(log2+1)] 4
+			size_t base = (size_t)1 << log2;
+			int sub = (int)((bytes - base - 1) / (base / 4));
+			int size_class = (log2 - 6) * 4 + sub + 1;
+			assert(size_class < CLASS_NUM);
+			return size_class;
+		}
+		/*TCYNX̑傫*/
+		static size_t get_class_bytes(int size_class) {
+			if (size_class == 0) return FAST_CONTAINER_ALIGNMENT;
+			int log2 = (size_class - 1) / 4 + 6;
+			int sub = (size_class - 1) % 4;
+			size_t base = (size_t)1 << log2;
+			return base + base / 4 * (sub + 1);
+		}
+
+		void *allocate(size_t bytes) override {
+			stats_allocations++;
+			if (bytes > POOL_MAX_BYTES) {
+				stats_misses++;
+				add_in_flight((long long)bytes);
+				return aligned_malloc(bytes);
+			}
+			int size_class = get_size_class(bytes);
+			size_t class_bytes = get_class_bytes(size_class);
+			add_in_flight((long long)class_bytes);
+			void *ptr = get_thread_cache().pop(size_class);
+			if (ptr == nullptr) {
+				Bucket& bucket = buckets[size_class];
+				std::lock_guard<std::mutex> lock(bucket.mutex);
+				if (!bucket.blocks.empty()) {
+					ptr = bucket.blocks.back();
+					bucket.blocks.pop_back();
+				}
+			}
+			if (ptr != nullptr) {
+				stats_hits++;
+				stats_cached -= (long long)class_bytes;
+				return ptr;
+			}
+			stats_misses++;
+			return aligned_malloc(class_bytes);
+		}
+
+		void deallocate(void *ptr, size_t bytes) override {
+			if (ptr == nullptr) return;
+			if (bytes > POOL_MAX_BYTES) {
+				stats_in_flight -= (long long)bytes;
+				aligned_free(ptr);
+				return;
+			}
+			int size_class = get_size_class(bytes);
+			size_t class_bytes = get_class_bytes(size_class);
+			stats_in_flight -= (long long)class_bytes;
+			stats_cached += (long long)class_bytes;
+			if (class_bytes <= THREAD_CACHE_MAX_BYTES && get_thread_cache().push(size_class, ptr)) return;
+			Bucket& bucket = buckets[size_class];
+			std::lock_guard<std::mutex> lock(bucket.mutex);
+			bucket.blocks.push_back(ptr);
+		}
+
+		/*L̃v[ɕێĂ̈ (Xbh̃LbV͎c)*/
+		void release() {
+			for (int i = 0; i < CLASS_NUM; i++) {
+				std::vector<void *> blocks;
+				{
+					std::lock_guard<std::mutex> lock(buckets[i].mutex);
+					blocks.swap(buckets[i].blocks);
+				}
+				for (auto ptr : blocks) aligned_free(ptr);
+				stats_cached -= (long long)(blocks.size() * get_class_bytes(i));
+			}
+		}
+
+		MemoryStatistics get_statistics() const {
+			MemoryStatistics result;
+			result.allocations = stats_allocations.load();
+			result.hits = stats_hits.load();
+			result.misses = stats_misses.load();
+			result.bytes_in_flight = stats_in_flight.load();
+			result.peak_bytes_in_flight = stats_peak.load();
+			result.bytes_cached = stats_cached.load();
+			return result;
+		}
+		/*񐔂ƍől0ɖ߂*/
+		void reset_statistics() {
+			stats_allocations = 0;
+			stats_hits = 0;
+			stats_misses = 0;
+			stats_peak = stats_in_flight.load();
+		}
+
+	private:
+		PooledResource() { }
+
+		struct Bucket {
+			std::mutex mutex;
+			std::vector<void *> blocks;
+		};
+
+		/*Xbh̃LbV (XbhIɋL̃v[֖߂)*/
+		class ThreadCache {
+		public:
+			explicit ThreadCache(PooledResource *owner) : owner(owner) { }
+			~ThreadCache() {
+				for (int i = 0; i < CLASS_NUM; i++) {
+					std::lock_guard<std::mutex> lock(owner->buckets[i].mutex);
+					for (int j = 0; j < count[i]; j++) owner->buckets[i].blocks.push_back(blocks[i][j]);
+				}
+			}
+			void *pop(int size_class) {
+				if (count[size_class] == 0) return nullptr;
+				return blocks[size_class][--count[size_class]];
+			}
+			bool push(int size_class, void *ptr) {
+				if (count[size_class] == THREAD_CACHE_COUNT) return false;
+				blocks[size_class][count[size_class]++] = ptr;
+				return true;
+			}
+		private:
+			PooledResource *owner;
+			void *blocks[CLASS_NUM][THREAD_CACHE_COUNT] = {};
+			int count[CLASS_NUM] = {};
+		};
+
+		ThreadCache& get_thread_cache() {
+			thread_local ThreadCache cache(this);
+			return cache;
+		}
+
+		void add_in_flight(long long bytes) {
+			long long now = stats_in_flight += bytes;
+			long long peak = stats_peak.load(std::memory_order_relaxed);
+			while (now > peak && !stats_peak.compare_exchange_weak(peak, now)) { }
+		}
+
+		Bucket buckets[CLASS_NUM];
+		std::atomic<long long> stats_allocations{ 0 };
+		std::atomic<long long> stats_hits{ 0 };
+		std::atomic<long long> stats_misses{ 0 };
+		std::atomic<long long> stats_in_flight{ 0 };
+		std::atomic<long long> stats_peak{ 0 };
+		std::atomic<long long> stats_cached{ 0 };
+	};
+
+	/*vZXʂ̃v[*/
+	inline PooledResource& get_pooled_resource() { return PooledResource::get_instance(); }
+
+	inline std::atomic<MemoryResource *>& get_memory_resource_state() {
+		static std::atomic<MemoryResource *> resource(&get_pooled_resource());
+		return resource;
+	}
+
+	/*gp̊mە (PooledResource)*/
+	inline MemoryResource *get_memory_resource() { return get_memory_resource_state().load(); }
+
+	/*
+	mەύX
+	ύXOɊmۂ͕̈ύXO̊mەŉ̂ŁAresource͍Ō̗̈̉܂ŔjȂ
+	*/
+	inline void set_memory_resource(MemoryResource *resource) { get_memory_resource_state().store(resource); }
+
+	/*̃v[̓v*/
+	inline MemoryStatistics get_memory_statistics() { return get_pooled_resource().get_statistics(); }
+
+	/*
+	FastMatrix, FastVector̗̈̃AP[^
+	̈̐擪ɊmەL^̂ŁAmەrŕύXĂ
+	*/
+	template<typename T>
+	class FastAllocator {
+	public:
+		using value_type = T;
+
+		FastAllocator() { }
+		template<typename U>
+		FastAllocator(const FastAllocator<U>&) { }
+
+		T *allocate(size_t n) {
+			if (n > (std::numeric_limits<size_t>::max() - FAST_CONTAINER_ALIGNMENT) / sizeof(T)) throw std::bad_alloc();
+			size_t bytes = n * sizeof(T) + FAST_CONTAINER_ALIGNMENT;
+			MemoryResource *resource = get_memory_resource();
+			char *ptr = (char *)resource->allocate(bytes);
+			*(MemoryResource **)ptr = resource;
+			return (T *)(ptr + FAST_CONTAINER_ALIGNMENT);
+		}
+		void deallocate(T *ptr, size_t n) {
+			if (ptr == nullptr) return;
+			char *head = (char *)ptr - FAST_CONTAINER_ALIGNMENT;
+			MemoryResource *resource = *(MemoryResource **)head;
+			resource->deallocate(head, n * sizeof(T) + FAST_CONTAINER_ALIGNMENT);
+		}
+
+		template<typename U>
+		bool operator==(const FastAllocator<U>&) const { return true; }
+		template<typename U>
+		bool operator!=(const FastAllocator<U>&) const { return false; }
+	};
+
+	/*FastMatrix, FastVector̗̈*/
+	template<typename T>
+	using FastStorage = std::vector<T, FastAllocator<T>>;
+
+}
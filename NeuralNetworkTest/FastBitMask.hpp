@@ -0,0 +1,129 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*row[pos]`row[pos + count - 1] ̃rbg bits ̉countrbg (count <= 64)*/
+	inline void bitmask_store(uint64_t *row, int pos, uint64_t bits, int count) {
+		int word = pos >> 6;
+		int shift = pos & 63;
+		uint64_t field = count >= 64 ? ~0ull : ((1ull << count) - 1);
+		bits &= field;
+		row[word] = (row[word] & ~(field << shift)) | (bits << shift);
+		//̌ɂ܂镔
+		if (shift + count > 64) {
+			int rest = shift + count - 64;
+			uint64_t rest_field = (1ull << rest) - 1;
+			row[word + 1] = (row[word + 1] & ~rest_field) | (bits >> (64 - shift));
+		}
+	}
+	/*row[pos]`row[pos + count - 1] ̃rbgʂׂēǂݏo (count <= 64)*/
+	inline uint64_t bitmask_load(const uint64_t *row, int pos, int count) {
+		int word = pos >> 6;
+		int shift = pos & 63;
+		uint64_t bits = row[word] >> shift;
+		if (shift + count > 64) bits |= row[word + 1] << (64 - shift);
+		return count >= 64 ? bits : (bits & ((1ull << count) - 1));
+	}
+
+	/*
+	Leaky ReLU out = in > 0 ? in : slope * in vZAin > 0 ̗vf̃rbg bits (擪rbg0) ֏
+	slopes: nullptrłȂΗvf̌X (slopȇɎg)
+	*/
+	template<typename T>
+	void relu_mask_scalar(const T *in, const T *slopes, T slope, T *out, uint64_t *bits, int count) {
+		for (int j = 0; j < count; j += 64) {
+			int n = std::min(64, count - j);
+			uint64_t word = 0;
+			for (int x = 0; x < n; x++) {
+				T v = in[j + x];
+				bool positive = v > (T)0;
+				word |= (uint64_t)positive << x;
+				out[j + x] = positive ? v : (T)((slopes != nullptr ? slopes[j + x] : slope) * v);
+			}
+			bitmask_store(bits, j, word, n);
+		}
+	}
+	/*Leaky ReLU ̋t`d out = rbg1Ȃ gradA0Ȃ slope * grad (}XNőI)*/
+	template<typename T>
+	void relu_mask_backward_scalar(const T *grad, const T *slopes, T slope, const uint64_t *bits, T *out, int count) {
+		for (int j = 0; j < count; j += 64) {
+			int n = std::min(64, count - j);
+			uint64_t word = bitmask_load(bits, j, n);
+			for (int x = 0; x < n; x++) {
+				T g = grad[j + x];
+				out[j + x] = ((word >> x) & 1) ? g : (T)((slopes != nullptr ? slopes[j + x] : slope) * g);
+			}
+		}
+	}
+
+	/*ReLUñ}XÑJ[l (float, doubleFastSimd.hppœꉻSIMD߂ŌvZ)*/
+	template<typename T>
+	struct ReluMaskKernel {
+		using forward_func = void(*)(const T *in, const T *slopes, T slope, T *out, uint64_t *bits, int count);
+		using backward_func = void(*)(const T *grad, const T *slopes, T slope, const uint64_t *bits, T *out, int count);
+		static forward_func get_forward() { return &relu_mask_scalar<T>; }
+		static backward_func get_backward() { return &relu_mask_backward_scalar<T>; }
+	};
+
+	/*
+	1vf1rbg̃}XN (ReLUñC̋t`dp)
+	es64rbǧ̋En܂̂ŁAsɕʂ̃Xbhŏ߂
+	*/
+	class FastBitMask {
+	public:
+		FastBitMask() { }
+		/*row x col ̑S0̃}XN*/
+		FastBitMask(int row, int col) { resize(row, col); }
+
+		/*row x col ɂ (͍̈ėp e͕s)*/
+		void resize(int row, int col) {
+			row_size = row;
+			column_size = col;
+			words_per_row = (col + 63) / 64;
+			words.resize((size_t)row * words_per_row);
+		}
+
+		int get_row_size() const { return row_size; }
+		int get_column_size() const { return column_size; }
+		int get_size() const { return row_size * column_size; }
+		/*1šꐔ*/
+		int get_words_per_row() const { return words_per_row; }
+		/*}XN̗̈̃oCg*/
+		size_t get_byte_size() const { return words.size() * sizeof(uint64_t); }
+
+		uint64_t *get_data() { return words.data(); }
+		const uint64_t *get_data() const { return words.data(); }
+		uint64_t *get_row(int i) { return words.data() + (size_t)i * words_per_row; }
+		const uint64_t *get_row(int i) const { return words.data() + (size_t)i * words_per_row; }
+
+		bool get(int i, int j) const { return (get_row(i)[j >> 6] >> (j & 63)) & 1; }
+		void set(int i, int j, bool value) { bitmask_store(get_row(i), j, value ? 1 : 0, 1); }
+		/*S0ɂ*/
+		void clear() { std::fill(words.begin(), words.end(), 0ull); }
+		/*1̃rbg̐*/
+		int count() const {
+			int result = 0;
+			for (int i = 0; i < row_size; i++) {
+				const uint64_t *row = get_row(i);
+				for (int j = 0; j < column_size; j += 64) result += popcount(bitmask_load(row, j, std::min(64, column_size - j)));
+			}
+			return result;
+		}
+
+	private:
+		static int popcount(uint64_t x) {
+			x = x - ((x >> 1) & 0x5555555555555555ull);
+			x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+			x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+			return (int)((x * 0x0101010101010101ull) >> 56);
+		}
+
+		int row_size = 0;
+		int column_size = 0;
+		int words_per_row = 0;
+		FastStorage<uint64_t> words;
+	};
+
+}
@@ -2,20 +2,27 @@
 
 /*
 [hؑ֎̊֐̎[hؑ
+[hw肵Ȃꍇ͌ĂяoɏʂőI (AUTO[h)
 */
-#ifdef FAST_CONTAONER_FUNCTIONS_AMP_MODE
+#ifdef FAST_CONTAONER_FUNCTIONS_COM_MODE
+#elif defined FAST_CONTAONER_FUNCTIONS_AMP_MODE
 #elif defined FAST_CONTAONER_FUNCTIONS_PPL_MODE
+#elif defined FAST_CONTAONER_FUNCTIONS_STD_MODE
 #else
-	#define FAST_CONTAONER_FUNCTIONS_COM_MODE
+	#define FAST_CONTAONER_FUNCTIONS_AUTO_MODE
 #endif
 
 /*
 FastContainerNX̉ZqI[o[Ch̎[hؑ
+[hw肵Ȃꍇ͌ĂяoɗvfőI (AUTO[h)
 */
-#ifdef FAST_CONTAONER_OPERATOR_OVERLOAD_AMP_MODE
+#ifdef FAST_CONTAONER_OPERATOR_OVERLOAD_COM_MODE
+#elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_AMP_MODE
 #elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_PPL_MODE
+#elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_STD_MODE
+#elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_EXPR_MODE
 #else
-	#define FAST_CONTAONER_OPERATOR_OVERLOAD_COM_MODE
+	#define FAST_CONTAONER_OPERATOR_OVERLOAD_AUTO_MODE
 #endif
 
 /*
@@ -24,12 +31,37 @@ FastContainer
 #ifdef FAST_CONTAINER_NO_EXCEPTION
 #endif
 
+/*
+C++ AMP / PPL g킸ɑ֎ (ThreadPoolŎs) g
+MSVCȊOł͏ɗL (AMP16rbǧ^Ȃ߁Abfloat16, halfgꍇMSVCł`)
+*/
+#if !defined(_MSC_VER) && !defined(FAST_CONTAINER_NO_AMP)
+	#define FAST_CONTAINER_NO_AMP
+#endif
+
 #ifdef FAST_CONTAONER_FUNCTIONS_COM_MODE
 	#define SWITCH_FAST_CONTAONER_FUNCTION(func) func ## _com
 #elif defined FAST_CONTAONER_FUNCTIONS_AMP_MODE
 	#define SWITCH_FAST_CONTAONER_FUNCTION(func) func ## _amp
 #elif defined FAST_CONTAONER_FUNCTIONS_PPL_MODE
 	#define SWITCH_FAST_CONTAONER_FUNCTION(func) func ## _ppl
+#elif defined FAST_CONTAONER_FUNCTIONS_STD_MODE
+	#define SWITCH_FAST_CONTAONER_FUNCTION(func) func ## _std
+#elif defined FAST_CONTAONER_FUNCTIONS_AUTO_MODE
+	#define SWITCH_FAST_CONTAONER_FUNCTION(func) FAST_CONTAINER_DISPATCH(func, FastContainer::get_dispatch_op(#func))
+#endif
+
+/*Zq͉ZqI[o[Ch̎[hɏ] (EXPR[hSTDAAUTO[h͗vfőI)*/
+#ifdef FAST_CONTAONER_OPERATOR_OVERLOAD_COM_MODE
+	#define SWITCH_FAST_CONTAONER_OPERATOR(func) func ## _com
+#elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_AMP_MODE
+	#define SWITCH_FAST_CONTAONER_OPERATOR(func) func ## _amp
+#elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_PPL_MODE
+	#define SWITCH_FAST_CONTAONER_OPERATOR(func) func ## _ppl
+#elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_AUTO_MODE
+	#define SWITCH_FAST_CONTAONER_OPERATOR(func) FAST_CONTAINER_DISPATCH(func, FastContainer::DISPATCH_OP_ELEMENTWISE)
+#else
+	#define SWITCH_FAST_CONTAONER_OPERATOR(func) func ## _std
 #endif
 
 #include <iostream>
@@ -38,18 +70,73 @@ FastContainer
 #include <exception>
 #include <ostream>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
 #include <random>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+#include <unordered_map>
+#include <map>
+#include <set>
+#include <fstream>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <limits>
+#include <utility>
+#include <cmath>
+#include <cstdint>
+#include <cassert>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+#ifdef _MSC_VER
+#include <malloc.h>
+#else
+#include <unistd.h>
+#endif
+#ifndef FAST_CONTAINER_NO_AMP
 #include <amp.h>
 #include <amp_math.h>
 #include <ppl.h>
-#include <iomanip>
-#include <sstream>
+#endif
 
 #include "Exception.hpp"
+#include "ThreadPool.hpp"
+#include "PortableConcurrency.hpp"
+#include "Executor.hpp"
+#include "FastAllocator.hpp"
+#include "FastDispatch.hpp"
+#include "FastBitMask.hpp"
+#include "FastGemm.hpp"
+#include "FastSimd.hpp"
+#include "FastHalf.hpp"
+#include "FastGemmBatched.hpp"
+#include "FastReduce.hpp"
+#include "FastTranspose.hpp"
+#include "FastTuner.hpp"
+#include "FastExpression.hpp"
 #include "Random.hpp"
 #include "FastVector.hpp"
+#include "FastSampler.hpp"
 #include "FastMatrix.hpp"
+#include "FastView.hpp"
+#include "FastWorkspace.hpp"
+#include "FastTensor.hpp"
+#include "FastSparseMatrix.hpp"
+#include "FastQuantize.hpp"
 
 namespace FastContainer {
 
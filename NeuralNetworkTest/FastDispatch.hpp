@@ -0,0 +1,199 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	s̎I (AUTO[h)
+	Z̎ނƏʂĂяoɎI
+	ʂ臒lȂ璀 (COM)AȏȂXbh (STD)AAMP臒lȏȂAMP
+	臒l set_dispatch_threshold() ϐŕύXł
+		FAST_CONTAINER_BACKEND=auto|serial|threaded|amp (Œ)
+		FAST_CONTAINER_THRESHOLD_<>= (Xbh臒l)
+		FAST_CONTAINER_AMP_THRESHOLD_<>= (AMP臒l)
+		<>: ELEMENTWISE, TRANSCENDENTAL, REDUCTION, GEMM
+	*/
+
+	/*Z̎*/
+	enum DispatchOp {
+		DISPATCH_OP_ELEMENTWISE,
+		DISPATCH_OP_TRANSCENDENTAL,
+		DISPATCH_OP_REDUCTION,
+		DISPATCH_OP_GEMM,
+		DISPATCH_OP_NUM
+	};
+
+	/**/
+	enum DispatchBackend {
+		DISPATCH_AUTO,
+		DISPATCH_SERIAL,
+		DISPATCH_THREADED,
+		DISPATCH_AMP
+	};
+
+	/*ޖ臒l̊l (ʂ͗vfAGEMM͐Ϙả)*/
+	const long long DISPATCH_DEFAULT_THRESHOLD[DISPATCH_OP_NUM] = { 65536, 8192, 32768, 64 * 64 * 64 };
+
+	inline const char *get_dispatch_op_name(DispatchOp op) {
+		static const char *names[DISPATCH_OP_NUM] = { "ELEMENTWISE", "TRANSCENDENTAL", "REDUCTION", "GEMM" };
+		return names[op];
+	}
+
+	/*ϐǂݍ (΋󕶎)*/
+	inline std::string read_dispatch_env(const std::string& name) {
+#ifdef _MSC_VER
+		char *buf = nullptr;
+		size_t len = 0;
+		if (_dupenv_s(&buf, &len, name.c_str()) != 0 || buf == nullptr) return std::string();
+		std::string result(buf);
+		free(buf);
+		return result;
+#else
+		const char *value = getenv(name.c_str());
+		return value == nullptr ? std::string() : std::string(value);
+#endif
+	}
+
+	/*̃LbVt@Cǂݍ (񂾂ǂݍ FastTuner.hpp Œ`)
+	臒lAubNTCYA^C̑傫߂ĎQƂύX鎞ɌĂԂ̂ŁAĂ΂ȂĂLbV̐ݒgA
+	IɕύXl̓LbVŏ㏑Ȃ*/
+	inline void ensure_tuning_loaded();
+
+	/*臒lƌŒ肷 (Ɋϐǂݍ)*/
+	class DispatchState {
+	public:
+		DispatchState() {
+			for (int i = 0; i < DISPATCH_OP_NUM; i++) {
+				threaded[i] = read_env_threshold(std::string("FAST_CONTAINER_THRESHOLD_") + get_dispatch_op_name((DispatchOp)i), DISPATCH_DEFAULT_THRESHOLD[i]);
+				amp[i] = read_env_threshold(std::string("FAST_CONTAINER_AMP_THRESHOLD_") + get_dispatch_op_name((DispatchOp)i), std::numeric_limits<long long>::max());
+			}
+			std::string value = read_dispatch_env("FAST_CONTAINER_BACKEND");
+			std::transform(value.begin(), value.end(), value.begin(), [](char c) { return (char)tolower((unsigned char)c); });
+			if (value == "serial") backend = DISPATCH_SERIAL;
+			else if (value == "threaded") backend = DISPATCH_THREADED;
+			else if (value == "amp") backend = DISPATCH_AMP;
+			else backend = DISPATCH_AUTO;
+		}
+
+		static DispatchState& get_instance() {
+			static DispatchState state;
+			return state;
+		}
+
+		std::atomic<long long> threaded[DISPATCH_OP_NUM];
+		std::atomic<long long> amp[DISPATCH_OP_NUM];
+		std::atomic<int> backend;
+
+	private:
+		static long long read_env_threshold(const std::string& name, long long value) {
+			std::string str = read_dispatch_env(name);
+			if (str.empty()) return value;
+			try {
+				return std::max(std::stoll(str), 0LL);
+			}
+			catch (const std::exception&) {
+				return value;
+			}
+		}
+	};
+
+	/*臒l
+	backend: DISPATCH_THREADED, DISPATCH_AMP*/
+	inline long long get_dispatch_threshold(DispatchBackend backend, DispatchOp op) {
+		ensure_tuning_loaded();
+		DispatchState& state = DispatchState::get_instance();
+		if (backend == DISPATCH_THREADED) return state.threaded[op].load(std::memory_order_relaxed);
+		if (backend == DISPATCH_AMP) return state.amp[op].load(std::memory_order_relaxed);
+		throw fast_container_exception();
+	}
+
+	/*臒lύX (ʂworkȏbackendg)
+	backend: DISPATCH_THREADED, DISPATCH_AMP*/
+	inline void set_dispatch_threshold(DispatchBackend backend, DispatchOp op, long long work) {
+		ensure_tuning_loaded();
+		DispatchState& state = DispatchState::get_instance();
+		if (op < 0 || op >= DISPATCH_OP_NUM) throw fast_container_exception();
+		if (backend == DISPATCH_THREADED) state.threaded[op].store(work, std::memory_order_relaxed);
+		else if (backend == DISPATCH_AMP) state.amp[op].store(work, std::memory_order_relaxed);
+		else throw fast_container_exception();
+	}
+
+	/*Œ肵Ă (DISPATCH_AUTOȂ玩I)*/
+	inline DispatchBackend get_dispatch_backend() { return (DispatchBackend)DispatchState::get_instance().backend.load(std::memory_order_relaxed); }
+
+	/*Œ (DISPATCH_AUTOŎIɖ߂)*/
+	inline void set_dispatch_backend(DispatchBackend backend) { DispatchState::get_instance().backend.store((int)backend, std::memory_order_relaxed); }
+
+	/*ʂI*/
+	inline DispatchBackend select_backend(DispatchOp op, long long work) {
+		ensure_tuning_loaded();
+		DispatchState& state = DispatchState::get_instance();
+		DispatchBackend backend = (DispatchBackend)state.backend.load(std::memory_order_relaxed);
+		if (backend != DISPATCH_AUTO) return backend;
+		if (work >= state.amp[op].load(std::memory_order_relaxed)) return DISPATCH_AMP;
+		if (work >= state.threaded[op].load(std::memory_order_relaxed) && ThreadPool::get_instance().get_concurrency() > 1) return DISPATCH_THREADED;
+		return DISPATCH_SERIAL;
+	}
+
+	constexpr bool dispatch_starts_with(const char *str, const char *prefix) {
+		return *prefix == '\0' || (*str == *prefix && dispatch_starts_with(str + 1, prefix + 1));
+	}
+
+	/*֐牉Z̎ނ߂ (RpCɕ])*/
+	constexpr DispatchOp get_dispatch_op(const char *name) {
+		return dispatch_starts_with(name, "dot") ? DISPATCH_OP_GEMM
+			: dispatch_starts_with(name, "exp") || dispatch_starts_with(name, "log") || dispatch_starts_with(name, "sqrt")
+			|| dispatch_starts_with(name, "pow") || dispatch_starts_with(name, "sigmoid") || dispatch_starts_with(name, "softmax")
+			|| dispatch_starts_with(name, "normalization") || dispatch_starts_with(name, "cross_entropy")
+			|| dispatch_starts_with(name, "num_diff") ? DISPATCH_OP_TRANSCENDENTAL
+			: dispatch_starts_with(name, "get_") || dispatch_starts_with(name, "sum") || dispatch_starts_with(name, "mean")
+			|| dispatch_starts_with(name, "min_by") || dispatch_starts_with(name, "max_by") || dispatch_starts_with(name, "argmax") ? DISPATCH_OP_REDUCTION
+			: DISPATCH_OP_ELEMENTWISE;
+	}
+
+	/* (vf)*/
+	template<int OP>
+	struct DispatchWork {
+		template<class C, class... A>
+		static long long get(const C& self, const A&...) { return self.get_size(); }
+	};
+	/* (Ϙả m * k * n)*/
+	template<>
+	struct DispatchWork<DISPATCH_OP_GEMM> {
+		template<class C, class M, class... A>
+		static long long get(const C& self, const M& mat, const A&...) { return get(self, mat, false, false); }
+		/*]uw肵 (reverse_this, reverse_mat m, k, n ւ)*/
+		template<class C, class M, class... A>
+		static long long get(const C& self, const M& mat, bool reverse_this, bool reverse_mat, const A&...) {
+			long long m = reverse_this ? self.get_column_size() : self.get_row_size();
+			long long k = reverse_this ? self.get_row_size() : self.get_column_size();
+			long long n = reverse_mat ? mat.get_row_size() : mat.get_column_size();
+			return m * k * n;
+		}
+	};
+
+	/*ʂ璀sXbhv[IԎs*/
+	class AutoExecutor {
+	public:
+		AutoExecutor(DispatchOp op, long long work) : threaded(select_backend(op, work) != DISPATCH_SERIAL) { }
+		int get_concurrency() { return threaded ? ThreadPool::get_instance().get_concurrency() : 1; }
+		template<class F>
+		void parallel_for_range(int first, int last, F func, int grain = 1) {
+			if (threaded) ThreadPool::get_instance().parallel_for_range(first, last, func, grain);
+			else if (first < last) func(first, last);
+		}
+	private:
+		bool threaded;
+	};
+
+}
+
+/*ĂяoɎI func ## _com / _std / _amp Ă*/
+#define FAST_CONTAINER_DISPATCH(func, op) [&](auto&&... args) -> decltype(auto) { \
+		switch (FastContainer::select_backend(op, FastContainer::DispatchWork<op>::get(*this, args...))) { \
+		case FastContainer::DISPATCH_SERIAL: return this->func ## _com(std::forward<decltype(args)>(args)...); \
+		case FastContainer::DISPATCH_AMP: return this->func ## _amp(std::forward<decltype(args)>(args)...); \
+		default: return this->func ## _std(std::forward<decltype(args)>(args)...); \
+		} \
+	}
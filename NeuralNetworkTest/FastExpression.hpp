@@ -0,0 +1,254 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	template<typename T>
+	class FastVector;
+	template<typename T>
+	class FastMatrix;
+	template<typename T>
+	class FastVectorView;
+	template<typename T>
+	class FastMatrixView;
+
+	/*̕]񉻂ŏvf*/
+	const int EXPRESSION_GRAIN = 4096;
+
+	/*
+	ev[g̊NX
+	E: hNX (value_type, container_type, is_scalar, get_size(), get_row_size(), get_column_size(), operator[] )
+	Zq͎gݗĂ邾ŁAReiւ̑1̑ŕ]
+	ReimAReiƃXJ[l̓񍀉ZSIMD̃J[lŕ]Aq̎͗vfɃXJ[ŕ]
+	̓Rei𕡎ʂɎQƂ̂ŁAauto Ŏ󂯂ĕ]ɉ񂷂ƃRei̎ɒӂKv
+	(auto e = a + make_matrix(); ͈ꎞIuWFNg̏IŔjĎQƐ悪Ȃ ]܂ŎێȂꍇFastMatrixŎ󂯂)
+	*/
+	template<class E>
+	class Expression {
+	public:
+		const E& self() const { return static_cast<const E&>(*this); }
+
+		/*]ăReiԂ*/
+		template<class U = E>
+		typename U::container_type eval() const { return typename U::container_type(*this); }
+
+		/*]ɍv (16rbg_floatŗݐςčŌɊۂ߂)*/
+		template<class U = E>
+		typename U::value_type sum() const {
+			const U& expr = self();
+			int size = expr.get_size();
+			int block_num = (size + EXPRESSION_GRAIN - 1) / EXPRESSION_GRAIN;
+			std::vector<Accumulate<typename U::value_type>> partial(block_num);
+			parallel_for(0, block_num, [&](int b) {
+				int end = std::min(size, (b + 1) * EXPRESSION_GRAIN);
+				Accumulate<typename U::value_type> buf = 0;
+				for (int i = b * EXPRESSION_GRAIN; i < end; i++) buf += (Accumulate<typename U::value_type>)expr[i];
+				partial[b] = buf;
+			});
+			Accumulate<typename U::value_type> result = 0;
+			for (auto x : partial) result += x;
+			return (typename U::value_type)result;
+		}
+	};
+
+	/*ReiQƂ鎮*/
+	template<class C>
+	class ContainerExpression;
+
+	/*FastMatrixQƂ鎮*/
+	template<typename T>
+	class ContainerExpression<FastMatrix<T>> :public Expression<ContainerExpression<FastMatrix<T>>> {
+	public:
+		using value_type = T;
+		using container_type = FastMatrix<T>;
+		static const bool is_scalar = false;
+		ContainerExpression(const FastMatrix<T>& mat)
+			: data(mat.get_data()), row_size(mat.get_row_size()), column_size(mat.get_column_size()) { }
+		T operator[](int i) const { return data[i]; }
+		const T *get_data() const { return data; }
+		int get_size() const { return row_size * column_size; }
+		int get_row_size() const { return row_size; }
+		int get_column_size() const { return column_size; }
+	private:
+		const T *data;
+		int row_size;
+		int column_size;
+	};
+
+	/*FastVectorQƂ鎮*/
+	template<typename T>
+	class ContainerExpression<FastVector<T>> :public Expression<ContainerExpression<FastVector<T>>> {
+	public:
+		using value_type = T;
+		using container_type = FastVector<T>;
+		static const bool is_scalar = false;
+		ContainerExpression(const FastVector<T>& vec) : data(vec.get_data()), size(vec.get_size()) { }
+		T operator[](int i) const { return data[i]; }
+		const T *get_data() const { return data; }
+		int get_size() const { return size; }
+		int get_row_size() const { return 1; }
+		int get_column_size() const { return size; }
+	private:
+		const T *data;
+		int size;
+	};
+
+	/*XJ[l̎*/
+	template<typename S>
+	class ScalarExpression :public Expression<ScalarExpression<S>> {
+	public:
+		using value_type = S;
+		using container_type = void;
+		static const bool is_scalar = true;
+		ScalarExpression(S value) : value(value) { }
+		S operator[](int) const { return value; }
+		S get_value() const { return value; }
+		int get_size() const { return 0; }
+		int get_row_size() const { return 0; }
+		int get_column_size() const { return 0; }
+	private:
+		S value;
+	};
+
+	/*񍀉Z̎*/
+	template<class Op, class L, class R>
+	class BinaryExpression :public Expression<BinaryExpression<Op, L, R>> {
+		using shape_type = typename std::conditional<L::is_scalar, R, L>::type;
+	public:
+		using value_type = typename shape_type::value_type;
+		using container_type = typename shape_type::container_type;
+		static const bool is_scalar = false;
+		static_assert(L::is_scalar || R::is_scalar || std::is_same<typename L::container_type, typename R::container_type>::value,
+			"operands must be the same container type");
+		BinaryExpression(const L& lhs, const R& rhs) : lhs(lhs), rhs(rhs) {
+			if (!L::is_scalar && !R::is_scalar) {
+				if (lhs.get_row_size() != rhs.get_row_size()) throw fast_container_exception();
+				if (lhs.get_column_size() != rhs.get_column_size()) throw fast_container_exception();
+			}
+		}
+		value_type operator[](int i) const { return Op::apply((value_type)lhs[i], (value_type)rhs[i]); }
+		const L& get_lhs() const { return lhs; }
+		const R& get_rhs() const { return rhs; }
+		int get_size() const { return get_shape().get_size(); }
+		int get_row_size() const { return get_shape().get_row_size(); }
+		int get_column_size() const { return get_shape().get_column_size(); }
+	private:
+		const shape_type& get_shape() const { return get_shape(std::integral_constant<bool, L::is_scalar>()); }
+		const shape_type& get_shape(std::false_type) const { return lhs; }
+		const shape_type& get_shape(std::true_type) const { return rhs; }
+		L lhs;
+		R rhs;
+	};
+
+	/*Zq̒`
+	simd: ΉSIMD̓񍀉ZAreversed: Eւꍇ̓񍀉Z (XJ[lӂ̏ꍇɎg)*/
+	struct AddOperation { static const SimdBinaryOp simd = SIMD_ADD; static const SimdBinaryOp reversed = SIMD_ADD; template<typename T> static T apply(T x1, T x2) { return x1 + x2; } };
+	struct SubOperation { static const SimdBinaryOp simd = SIMD_SUB; static const SimdBinaryOp reversed = SIMD_RSUB; template<typename T> static T apply(T x1, T x2) { return x1 - x2; } };
+	struct MulOperation { static const SimdBinaryOp simd = SIMD_MUL; static const SimdBinaryOp reversed = SIMD_MUL; template<typename T> static T apply(T x1, T x2) { return x1 * x2; } };
+	struct DivOperation { static const SimdBinaryOp simd = SIMD_DIV; static const SimdBinaryOp reversed = SIMD_RDIV; template<typename T> static T apply(T x1, T x2) { return x1 / x2; } };
+	struct EqualOperation { static const SimdBinaryOp simd = SIMD_EQ; static const SimdBinaryOp reversed = SIMD_EQ; template<typename T> static T apply(T x1, T x2) { return x1 == x2; } };
+	struct NotEqualOperation { static const SimdBinaryOp simd = SIMD_NE; static const SimdBinaryOp reversed = SIMD_NE; template<typename T> static T apply(T x1, T x2) { return x1 != x2; } };
+	struct GreaterOperation { static const SimdBinaryOp simd = SIMD_GT; static const SimdBinaryOp reversed = SIMD_LT; template<typename T> static T apply(T x1, T x2) { return x1 > x2; } };
+	struct LessOperation { static const SimdBinaryOp simd = SIMD_LT; static const SimdBinaryOp reversed = SIMD_GT; template<typename T> static T apply(T x1, T x2) { return x1 < x2; } };
+	struct GreaterEqualOperation { static const SimdBinaryOp simd = SIMD_GE; static const SimdBinaryOp reversed = SIMD_LE; template<typename T> static T apply(T x1, T x2) { return x1 >= x2; } };
+	struct LessEqualOperation { static const SimdBinaryOp simd = SIMD_LE; static const SimdBinaryOp reversed = SIMD_GE; template<typename T> static T apply(T x1, T x2) { return x1 <= x2; } };
+
+	/*SIMD̃J[lŎ]out֏ (J[ľ̖`ƌ^łfalse)*/
+	template<typename T, class E>
+	bool evaluate_expression_simd(const E&, T *) { return false; }
+	/*Rei̕*/
+	template<typename T, template<typename> class C>
+	bool evaluate_expression_simd(const ContainerExpression<C<T>>& e, T *out) {
+		const T *in = e.get_data();
+		if (in != out) parallel_for_range(0, e.get_size(), [&](int begin, int end) { std::copy(in + begin, in + end, out + begin); }, SIMD_GRAIN);
+		return true;
+	}
+	/*Reim̓񍀉Z*/
+	template<typename T, class Op, template<typename> class C>
+	bool evaluate_expression_simd(const BinaryExpression<Op, ContainerExpression<C<T>>, ContainerExpression<C<T>>>& e, T *out) {
+		return simd_binary(Op::simd, e.get_lhs().get_data(), e.get_rhs().get_data(), out, e.get_size(), ThreadPool::get_instance());
+	}
+	/*ReiƃXJ[l̓񍀉Z*/
+	template<typename T, class Op, template<typename> class C, typename S>
+	bool evaluate_expression_simd(const BinaryExpression<Op, ContainerExpression<C<T>>, ScalarExpression<S>>& e, T *out) {
+		return simd_binary_scalar(Op::simd, e.get_lhs().get_data(), (T)e.get_rhs().get_value(), out, e.get_size(), ThreadPool::get_instance());
+	}
+	/*XJ[lƃRei̓񍀉Z (EւZŕ])*/
+	template<typename T, class Op, template<typename> class C, typename S>
+	bool evaluate_expression_simd(const BinaryExpression<Op, ScalarExpression<S>, ContainerExpression<C<T>>>& e, T *out) {
+		return simd_binary_scalar(Op::reversed, e.get_rhs().get_data(), (T)e.get_lhs().get_value(), out, e.get_size(), ThreadPool::get_instance());
+	}
+
+	/*]out֏
+	SIMD̃J[lŕ]łȂ͗vfɕ] (out͎̎QƂReiƓ̈ł悢)*/
+	template<typename T, class E>
+	void evaluate_expression(const Expression<E>& expr, T *out) {
+		const E& e = expr.self();
+		if (evaluate_expression_simd(e, out)) return;
+		parallel_for_range(0, e.get_size(), [&](int begin, int end) {
+			for (int i = begin; i < end; i++) out[i] = (T)e[i];
+		}, EXPRESSION_GRAIN);
+	}
+
+	/*Zq̈֕ϊ*/
+	template<class X, class Enable = void>
+	struct ToExpression { static const bool is_operand = false; static const bool is_scalar = false; };
+	template<typename T>
+	struct ToExpression<FastMatrix<T>> {
+		static const bool is_operand = true;
+		static const bool is_scalar = false;
+		using type = ContainerExpression<FastMatrix<T>>;
+	};
+	template<typename T>
+	struct ToExpression<FastVector<T>> {
+		static const bool is_operand = true;
+		static const bool is_scalar = false;
+		using type = ContainerExpression<FastVector<T>>;
+	};
+	template<class X>
+	struct ToExpression<X, typename std::enable_if<std::is_base_of<Expression<X>, X>::value>::type> {
+		static const bool is_operand = true;
+		static const bool is_scalar = false;
+		using type = X;
+	};
+	template<class X>
+	struct ToExpression<X, typename std::enable_if<std::is_arithmetic<X>::value || IsHalfFloat<X>::value>::type> {
+		static const bool is_operand = false;
+		static const bool is_scalar = true;
+		using type = ScalarExpression<X>;
+	};
+
+	/*ȂƂReiŁAReiXJ[̏ꍇ̓񍀉Z̎*/
+	template<class Op, class L, class R>
+	using BinaryExpressionOf = typename std::enable_if<
+		(ToExpression<L>::is_operand && (ToExpression<R>::is_operand || ToExpression<R>::is_scalar)) ||
+		(ToExpression<L>::is_scalar && ToExpression<R>::is_operand),
+		BinaryExpression<Op, typename ToExpression<L>::type, typename ToExpression<R>::type>>::type;
+
+#ifdef FAST_CONTAONER_OPERATOR_OVERLOAD_EXPR_MODE
+
+	template<class L, class R>
+	BinaryExpressionOf<AddOperation, L, R> operator+(const L& x1, const R& x2) { return BinaryExpressionOf<AddOperation, L, R>(x1, x2); }
+	template<class L, class R>
+	BinaryExpressionOf<SubOperation, L, R> operator-(const L& x1, const R& x2) { return BinaryExpressionOf<SubOperation, L, R>(x1, x2); }
+	template<class L, class R>
+	BinaryExpressionOf<MulOperation, L, R> operator*(const L& x1, const R& x2) { return BinaryExpressionOf<MulOperation, L, R>(x1, x2); }
+	template<class L, class R>
+	BinaryExpressionOf<DivOperation, L, R> operator/(const L& x1, const R& x2) { return BinaryExpressionOf<DivOperation, L, R>(x1, x2); }
+	template<class L, class R>
+	BinaryExpressionOf<EqualOperation, L, R> operator==(const L& x1, const R& x2) { return BinaryExpressionOf<EqualOperation, L, R>(x1, x2); }
+	template<class L, class R>
+	BinaryExpressionOf<NotEqualOperation, L, R> operator!=(const L& x1, const R& x2) { return BinaryExpressionOf<NotEqualOperation, L, R>(x1, x2); }
+	template<class L, class R>
+	BinaryExpressionOf<GreaterOperation, L, R> operator>(const L& x1, const R& x2) { return BinaryExpressionOf<GreaterOperation, L, R>(x1, x2); }
+	template<class L, class R>
+	BinaryExpressionOf<LessOperation, L, R> operator<(const L& x1, const R& x2) { return BinaryExpressionOf<LessOperation, L, R>(x1, x2); }
+	template<class L, class R>
+	BinaryExpressionOf<GreaterEqualOperation, L, R> operator>=(const L& x1, const R& x2) { return BinaryExpressionOf<GreaterEqualOperation, L, R>(x1, x2); }
+	template<class L, class R>
+	BinaryExpressionOf<LessEqualOperation, L, R> operator<=(const L& x1, const R& x2) { return BinaryExpressionOf<LessEqualOperation, L, R>(x1, x2); }
+
+#endif
+
+}
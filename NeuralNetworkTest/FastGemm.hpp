@@ -0,0 +1,456 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	sς̃ubNTCY
+	MR x NR: }CNJ[lvZo̓^C (WX^)
+	KC: pbNς݃pl̐[ (NRplL1Ɏ܂)
+	MC: pbNςAubN̍s (MC x KC L2Ɏ܂)
+	NC: pbNςBubN̗ (KC x NC L3Ɏ܂)
+	*/
+	template<typename T>
+	struct GemmBlock {
+		static const int MR = 4;
+		static const int NR = 8;
+		static const int MC = 128;
+		static const int KC = 256;
+		static const int NC = 4096;
+	};
+	template<>
+	struct GemmBlock<float> {
+		static const int MR = 6;
+		static const int NR = 16;
+		static const int MC = 144;
+		static const int KC = 256;
+		static const int NC = 4096;
+	};
+	template<>
+	struct GemmBlock<double> {
+		static const int MR = 6;
+		static const int NR = 8;
+		static const int MC = 96;
+		static const int KC = 256;
+		static const int NC = 4096;
+	};
+
+	/*
+	sɕύXłubNTCY (ŕύX)
+	MR  NR ̓}CNJ[lŌ܂̂ŕύXłȂ
+	*/
+	template<typename T>
+	struct GemmTuning {
+		static std::atomic<int>& get_mc() {
+			static std::atomic<int> mc(GemmBlock<T>::MC);
+			return mc;
+		}
+		static std::atomic<int>& get_kc() {
+			static std::atomic<int> kc(GemmBlock<T>::KC);
+			return kc;
+		}
+	};
+
+	/*gp̃ubNTCY*/
+	template<typename T>
+	int get_gemm_mc() {
+		ensure_tuning_loaded();
+		return GemmTuning<T>::get_mc().load(std::memory_order_relaxed);
+	}
+	template<typename T>
+	int get_gemm_kc() {
+		ensure_tuning_loaded();
+		return GemmTuning<T>::get_kc().load(std::memory_order_relaxed);
+	}
+
+	/*ubNTCYύX (mcMR̔{ɐ؂̂)*/
+	template<typename T>
+	void set_gemm_block_size(int mc, int kc) {
+		const int MR = GemmBlock<T>::MR;
+		if (mc < MR || kc < 1) throw fast_container_exception();
+		ensure_tuning_loaded();
+		GemmTuning<T>::get_mc().store(mc / MR * MR, std::memory_order_relaxed);
+		GemmTuning<T>::get_kc().store(kc, std::memory_order_relaxed);
+	}
+
+	/*sς̑傫 (C: m x n, ̎: k)*/
+	struct GemmShape {
+		int m;
+		int n;
+		int k;
+		bool operator<(const GemmShape& shape) const {
+			if (m != shape.m) return m < shape.m;
+			if (n != shape.n) return n < shape.n;
+			return k < shape.k;
+		}
+		bool operator==(const GemmShape& shape) const { return m == shape.m && n == shape.n && k == shape.k; }
+	};
+
+	/*Ăяoꂽsς̑傫L^ (p)*/
+	template<typename T>
+	class GemmShapeRecorder {
+	public:
+		static GemmShapeRecorder& get_instance() {
+			static GemmShapeRecorder recorder;
+			return recorder;
+		}
+		/*L^Jn*/
+		void start() {
+			std::lock_guard<std::mutex> lock(mutex);
+			shapes.clear();
+			recording = true;
+		}
+		/*L^IċL^傫Ԃ*/
+		std::vector<GemmShape> stop() {
+			std::lock_guard<std::mutex> lock(mutex);
+			recording = false;
+			return std::vector<GemmShape>(shapes.begin(), shapes.end());
+		}
+		void record(int m, int n, int k) {
+			if (!recording.load(std::memory_order_relaxed)) return;
+			std::lock_guard<std::mutex> lock(mutex);
+			if (recording) shapes.insert(GemmShape{ m, n, k });
+		}
+	private:
+		std::atomic<bool> recording{ false };
+		std::mutex mutex;
+		std::set<GemmShape> shapes;
+	};
+
+	/*
+	pbNp̍Ɨ̈
+	(q̌Ăяoł̈悪Փ˂Ȃ悤[ɕێ)
+	*/
+	template<typename T>
+	class GemmBuffer {
+	public:
+		GemmBuffer(size_t size) {
+			auto& stack = get_stack();
+			depth = get_depth()++;
+			if ((int)stack.size() <= depth) stack.resize(depth + 1);
+			if (stack[depth].size() < size) stack[depth].resize(size);
+			ptr = stack[depth].data();
+		}
+		~GemmBuffer() { get_depth()--; }
+		T *get() { return ptr; }
+	private:
+		static std::vector<std::vector<T>>& get_stack() {
+			thread_local std::vector<std::vector<T>> stack;
+			return stack;
+		}
+		static int& get_depth() {
+			thread_local int depth = 0;
+			return depth;
+		}
+		T *ptr;
+		int depth;
+	};
+
+	/*sς̏o͂ɑēKp銈֐*/
+	enum GemmActivation {
+		GEMM_ACTIVATION_NONE,
+		GEMM_ACTIVATION_RELU,
+		GEMM_ACTIVATION_SIGMOID
+	};
+
+	/*
+	sς̏o͂ɑēKp鏈 (Gs[O)
+	ŌkubN̏o̓^CC֏ނƂɓKp (Cւ1񂾂)
+	bias: C(i, j)  bias[j] 𑫂 (nullptrȂ瑫Ȃ)
+	activation: ֐
+	mask: nullptrłȂ΍sǐ mask + i * ldm ̃rbgjɁȀo͂Ȃ1AȊO0
+	(FastBitMasǩ` ReLŰt`dp)
+	*/
+	template<typename T>
+	struct GemmEpilogue {
+		const T *bias = nullptr;
+		GemmActivation activation = GEMM_ACTIVATION_NONE;
+		uint64_t *mask = nullptr;
+		int ldm = 0;
+		bool is_empty() const { return bias == nullptr && activation == GEMM_ACTIVATION_NONE && mask == nullptr; }
+	};
+
+	/*
+	Gs[Oo͂̍si̗ j`j + count - 1 ɓKp out[0]`out[count - 1] ֏
+	in: sς̌ (accumulateȂ out ɑĂKp inout͓ł悢)
+	*/
+	template<typename T>
+	void gemm_epilogue_scalar(const GemmEpilogue<T>& epilogue, int i, int j, int count, const T *in, T *out, bool accumulate) {
+		uint64_t *mask = epilogue.mask != nullptr ? epilogue.mask + (size_t)i * epilogue.ldm : nullptr;
+		uint64_t bits = 0;
+		for (int x = 0; x < count; x++) {
+			double y = (double)in[x];
+			if (accumulate) y += (double)out[x];
+			if (epilogue.bias != nullptr) y += (double)epilogue.bias[j + x];
+			if (epilogue.activation == GEMM_ACTIVATION_RELU) y = y > 0 ? y : 0;
+			else if (epilogue.activation == GEMM_ACTIVATION_SIGMOID) y = 1 / (1 + std::exp(-y));
+			T result = (T)y;
+			out[x] = result;
+			if (mask == nullptr) continue;
+			//64vfɂ܂Ƃ߂ď
+			if (result > (T)0) bits |= 1ull << (x & 63);
+			if ((x & 63) == 63 || x == count - 1) {
+				bitmask_store(mask, j + (x & ~63), bits, (x & 63) + 1);
+				bits = 0;
+			}
+		}
+	}
+
+	/*Gs[ÕJ[l (float, doubleFastSimd.hppœꉻSIMD߂ŌvZ)*/
+	template<typename T>
+	struct GemmEpilogueKernel {
+		using func = void(*)(const GemmEpilogue<T>& epilogue, int i, int j, int count, const T *in, T *out, bool accumulate);
+		static func get() { return &gemm_epilogue_scalar<T>; }
+	};
+
+	/*C (m x n) ̑ŜɃGs[OKp (sς̌ŕʂɓKpꍇ)*/
+	template<typename T, class E>
+	void gemm_epilogue_apply(const GemmEpilogue<T>& epilogue, int m, int n, T *c, int ldc, E& exec) {
+		if (epilogue.is_empty() || m <= 0 || n <= 0) return;
+		auto kernel = GemmEpilogueKernel<T>::get();
+		//1̒̕Pʂ4096vfx̍s
+		exec.parallel_for_range(0, m, [&](int begin, int end) {
+			for (int i = begin; i < end; i++) kernel(epilogue, i, 0, n, c + (size_t)i * ldc, c + (size_t)i * ldc, false);
+		}, std::max(1, 4096 / n));
+	}
+
+	/*pbN1ŕϊvf (X^bN̍Ɨ̈Ɏ܂傫)*/
+	const int GEMM_PACK_CHUNK = 256;
+
+	/*pbNAvf̕ϊ S -> T (16rbg_FastHalf.hppœꉻSIMD߂ŕϊ)*/
+	template<typename T, typename S>
+	struct GemmPackConverter {
+		static void run(const S *in, T *out, int count) {
+			for (int x = 0; x < count; x++) out[x] = (T)in[x];
+		}
+	};
+
+	/*A mc x kc ubN MR s̃plփpbN ([0 vfST֕ϊȂʂ)*/
+	template<typename T, typename S>
+	void gemm_pack_a(int mc, int kc, const S *a, int rs_a, int cs_a, T *buf) {
+		const int MR = GemmBlock<T>::MR;
+		//^ႢsAĂ΁Asɂ܂Ƃ߂ĕϊĂׂ
+		if (!std::is_same<T, S>::value && cs_a == 1) {
+			T row[GEMM_PACK_CHUNK];
+			for (int ir = 0; ir < mc; ir += MR, buf += MR * kc) {
+				int mr = std::min(MR, mc - ir);
+				for (int i = 0; i < MR; i++) {
+					if (i >= mr) {
+						for (int p = 0; p < kc; p++) buf[p * MR + i] = 0;
+						continue;
+					}
+					const S *pa = a + (ir + i) * rs_a;
+					for (int p0 = 0; p0 < kc; p0 += GEMM_PACK_CHUNK) {
+						int count = std::min(GEMM_PACK_CHUNK, kc - p0);
+						GemmPackConverter<T, S>::run(pa + p0, row, count);
+						for (int p = 0; p < count; p++) buf[(p0 + p) * MR + i] = row[p];
+					}
+				}
+			}
+			return;
+		}
+		for (int ir = 0; ir < mc; ir += MR) {
+			int mr = std::min(MR, mc - ir);
+			const S *pa = a + ir * rs_a;
+			for (int p = 0; p < kc; p++) {
+				for (int i = 0; i < mr; i++) buf[i] = (T)pa[i * rs_a + p * cs_a];
+				for (int i = mr; i < MR; i++) buf[i] = 0;
+				buf += MR;
+			}
+		}
+	}
+
+	/*B kc x NR pl1pbN ([0 vfST֕ϊȂʂ)*/
+	template<typename T, typename S>
+	void gemm_pack_b(int kc, int nr, const S *b, int rs_b, int cs_b, T *buf) {
+		const int NR = GemmBlock<T>::NR;
+		if (cs_b == 1 && nr == NR) {
+			for (int p = 0; p < kc; p++, buf += NR) GemmPackConverter<T, S>::run(b + p * rs_b, buf, NR);
+			return;
+		}
+		if (rs_b == 1) {
+			//]uꂽB͗ɘAēǂ (^Ⴆ΂܂Ƃ߂ĕϊĂׂ)
+			T col[GEMM_PACK_CHUNK];
+			for (int j = 0; j < nr; j++) {
+				const S *pb = b + j * cs_b;
+				if (std::is_same<T, S>::value) {
+					for (int p = 0; p < kc; p++) buf[p * NR + j] = (T)pb[p];
+					continue;
+				}
+				for (int p0 = 0; p0 < kc; p0 += GEMM_PACK_CHUNK) {
+					int count = std::min(GEMM_PACK_CHUNK, kc - p0);
+					GemmPackConverter<T, S>::run(pb + p0, col, count);
+					for (int p = 0; p < count; p++) buf[(p0 + p) * NR + j] = col[p];
+				}
+			}
+			for (int p = 0; p < kc; p++) {
+				for (int j = nr; j < NR; j++) buf[p * NR + j] = 0;
+			}
+			return;
+		}
+		for (int p = 0; p < kc; p++, buf += NR) {
+			for (int j = 0; j < nr; j++) buf[j] = (T)b[p * rs_b + j * cs_b];
+			for (int j = nr; j < NR; j++) buf[j] = 0;
+		}
+	}
+
+	/*}CNJ[l tile[MR x NR] = a[kc x MR]^T * b[kc x NR] XJ[*/
+	template<typename T>
+	struct GemmKernel {
+		static void run(int kc, const T *a, const T *b, T *tile) {
+			const int MR = GemmBlock<T>::MR;
+			const int NR = GemmBlock<T>::NR;
+			T acc[MR][NR] = {};
+			for (int p = 0; p < kc; p++, a += MR, b += NR) {
+				for (int i = 0; i < MR; i++) {
+					T ai = a[i];
+					for (int j = 0; j < NR; j++) acc[i][j] += ai * b[j];
+				}
+			}
+			for (int i = 0; i < MR; i++) {
+				for (int j = 0; j < NR; j++) tile[i * NR + j] = acc[i][j];
+			}
+		}
+	};
+
+	/*}CNJ[l̑I (float, doubleFastSimd.hppœꉻSIMD߂ŌvZ)*/
+	template<typename T>
+	struct GemmMicroKernel {
+		using func = void(*)(int kc, const T *a, const T *b, T *tile);
+		static func get() { return &GemmKernel<T>::run; }
+	};
+
+	/*sςvZ^ (ubNTCY̎̑Ώ 16rbg_FastHalf.hppœꉻ)*/
+	template<typename T>
+	struct GemmCompute { using type = T; };
+
+	/*
+	o̓^C̏ (vZ^T̏o̓^CAi[^SC֏)
+	ŌkubN̓Gs[OKpȂ1ŏ݁AȑOkubNC֗ݐς
+	(STႤꍇFastHalf.hppœꉻ)
+	*/
+	template<typename T, typename S>
+	class GemmOutput {
+	public:
+		static_assert(std::is_same<T, S>::value, "GemmOutput: no conversion from the compute type");
+		/*multiple_k_blocks: k̃ubNɕ邩*/
+		GemmOutput(int, int, bool, S *c, int ldc, const GemmEpilogue<S>& epilogue)
+			: c(c), ldc(ldc), epilogue(epilogue), has_epilogue(!epilogue.is_empty()), kernel(GemmEpilogueKernel<S>::get()) { }
+		/*si̗ j`j + count - 1  src (o̓^C1s) 
+		first: ŏkubN, last: ŌkubN*/
+		void write(int i, int j, int count, const T *src, bool first, bool last) const {
+			S *row = c + (size_t)i * ldc + j;
+			if (last && has_epilogue) kernel(epilogue, i, j, count, src, row, !first);
+			else if (first) for (int x = 0; x < count; x++) row[x] = src[x];
+			else for (int x = 0; x < count; x++) row[x] += src[x];
+		}
+	private:
+		S *c;
+		int ldc;
+		const GemmEpilogue<S>& epilogue;
+		bool has_epilogue;
+		typename GemmEpilogueKernel<S>::func kernel;
+	};
+
+	/*ubNs ( gemm() Ɠ)
+	GemmCompute<S>::type ŌvZ (SƈႦ΃pbNɕϊAo͂GemmOutputŊۂ߂ď)*/
+	template<typename S, class E>
+	void gemm_blocked(int m, int n, int k, const S *a, int rs_a, int cs_a, const S *b, int rs_b, int cs_b, S *c, int ldc, const GemmEpilogue<S>& epilogue, E& exec) {
+		using T = typename GemmCompute<S>::type;
+		const int MR = GemmBlock<T>::MR;
+		const int NR = GemmBlock<T>::NR;
+		const int MC = get_gemm_mc<T>();
+		const int KC = get_gemm_kc<T>();
+		const int NC = GemmBlock<T>::NC;
+		if (m <= 0 || n <= 0) return;
+		GemmShapeRecorder<T>::get_instance().record(m, n, k);
+		if (k <= 0) {
+			for (int i = 0; i < m; i++) {
+				for (int j = 0; j < n; j++) c[i * ldc + j] = 0;
+			}
+			gemm_epilogue_apply(epilogue, m, n, c, ldc, exec);
+			return;
+		}
+		GemmOutput<T, S> output(m, n, k > KC, c, ldc, epilogue);
+		auto kernel = GemmMicroKernel<T>::get();
+		//xɑ邾ÃubN𕪊
+		int concurrency = exec.get_concurrency();
+		int mc = MC;
+		if (concurrency > 1) {
+			int per_thread = (m + concurrency - 1) / concurrency;
+			per_thread = (per_thread + MR - 1) / MR * MR;
+			mc = std::max(MR, std::min(MC, per_thread));
+		}
+		int m_blocks = (m + mc - 1) / mc;
+		GemmBuffer<T> b_buf(KC * ((std::min(NC, n) + NR - 1) / NR * NR));
+		T *pack_b = b_buf.get();
+		for (int jc = 0; jc < n; jc += NC) {
+			int nc = std::min(NC, n - jc);
+			int n_panels = (nc + NR - 1) / NR;
+			for (int pc = 0; pc < k; pc += KC) {
+				int kc = std::min(KC, k - pc);
+				bool first = pc == 0;
+				bool last = pc + kc >= k;
+				const S *pb = b + pc * rs_b + jc * cs_b;
+				exec.parallel_for_range(0, n_panels, [&](int begin, int end) {
+					for (int jp = begin; jp < end; jp++) {
+						gemm_pack_b(kc, std::min(NR, nc - jp * NR), pb + jp * NR * cs_b, rs_b, cs_b, pack_b + jp * NR * kc);
+					}
+				});
+				exec.parallel_for_range(0, m_blocks, [&](int begin, int end) {
+					GemmBuffer<T> a_buf(mc * KC + MR * NR);
+					T *pack_a = a_buf.get();
+					T *tile = pack_a + mc * KC;
+					for (int blk = begin; blk < end; blk++) {
+						int ic = blk * mc;
+						int mb = std::min(mc, m - ic);
+						gemm_pack_a(mb, kc, a + ic * rs_a + pc * cs_a, rs_a, cs_a, pack_a);
+						for (int jp = 0; jp < n_panels; jp++) {
+							int jr = jp * NR;
+							int nr = std::min(NR, nc - jr);
+							const T *panel_b = pack_b + jr * kc;
+							for (int ir = 0; ir < mb; ir += MR) {
+								int mr = std::min(MR, mb - ir);
+								kernel(kc, pack_a + ir * kc, panel_b, tile);
+								for (int i = 0; i < mr; i++) output.write(ic + ir + i, jc + jr, nr, tile + i * NR, first, last);
+							}
+						}
+					}
+				});
+			}
+		}
+	}
+
+	/*^̍sς̎*/
+	template<typename T>
+	struct GemmDriver {
+		template<class E>
+		static void run(int m, int n, int k, const T *a, int rs_a, int cs_a, const T *b, int rs_b, int cs_b, T *c, int ldc, const GemmEpilogue<T>& epilogue, E& exec) {
+			gemm_blocked(m, n, k, a, rs_a, cs_a, b, rs_b, cs_b, c, ldc, epilogue, exec);
+		}
+	};
+
+	/*
+	s C = A * B
+	A: m x k (A(i, p) = a[i * rs_a + p * cs_a])
+	B: k x n (B(p, j) = b[p * rs_b + j * cs_b])
+	C: m x n (C(i, j) = c[i * ldc + j])
+	exec: s (SerialExecutor, PplExecutor, ThreadPool)
+	*/
+	template<typename T, class E>
+	void gemm(int m, int n, int k, const T *a, int rs_a, int cs_a, const T *b, int rs_b, int cs_b, T *c, int ldc, E& exec) {
+		GemmDriver<T>::run(m, n, k, a, rs_a, cs_a, b, rs_b, cs_b, c, ldc, GemmEpilogue<T>(), exec);
+	}
+
+	/*
+	Gs[Ot̍s C = epilogue(A * B)
+	oCAX̉ZƊ֐o̓^CɑēKp̂ŁAo͂1񂾂
+	(̑̈ gemm() Ɠ)
+	*/
+	template<typename T, class E>
+	void gemm(int m, int n, int k, const T *a, int rs_a, int cs_a, const T *b, int rs_b, int cs_b, T *c, int ldc, const GemmEpilogue<T>& epilogue, E& exec) {
+		GemmDriver<T>::run(m, n, k, a, rs_a, cs_a, b, rs_b, cs_b, c, ldc, epilogue, exec);
+	}
+
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	pbNɌvZ鏬ȍsς̏ (m * n * k)
+	菬ƃpbN̎Ԃƕ񉻂̌ĂяovZdȂ
+	*/
+	const long long GEMM_SMALL_WORK = 32 * 32 * 32;
+	/*܂Ƃ߂ČvZsς1^XN̐Ϙả񐔂̖ڈ*/
+	const long long GEMM_BATCH_GRAIN_WORK = 64 * 64 * 64;
+
+	/*sς̐Ϙả*/
+	inline long long gemm_work(int m, int n, int k) { return (long long)std::max(m, 0) * std::max(n, 0) * std::max(k, 0); }
+
+	/*ȍs (XJ[  gemm() Ɠ)*/
+	template<typename T>
+	void gemm_small_scalar(int m, int n, int k, const T *a, int rs_a, int cs_a, const T *b, int rs_b, int cs_b, T *c, int ldc) {
+		for (int i = 0; i < m; i++) {
+			const T *pa = a + i * rs_a;
+			for (int j = 0; j < n; j++) {
+				const T *pb = b + j * cs_b;
+				T sum = 0;
+				for (int p = 0; p < k; p++) sum += pa[p * cs_a] * pb[p * rs_b];
+				c[i * ldc + j] = sum;
+			}
+		}
+	}
+
+	/*߃Zbg̏ȍsς̃J[l (Sse4Kernels, Avx2Kernels, Avx512Kernels)*/
+#define FAST_CONTAINER_SIMD_KERNELS "FastGemmBatchedKernels.hpp"
+#include "FastSimdTarget.hpp"
+#undef FAST_CONTAINER_SIMD_KERNELS
+
+	/*^̏ȍsς̎ (float, double, 16rbg_ȊO1Xbh gemm())*/
+	template<typename T>
+	struct GemmSmall {
+		static void run(int m, int n, int k, const T *a, int rs_a, int cs_a, const T *b, int rs_b, int cs_b, T *c, int ldc) {
+			SerialExecutor exec;
+			gemm(m, n, k, a, rs_a, cs_a, b, rs_b, cs_b, c, ldc, exec);
+		}
+	};
+	template<typename T>
+	struct GemmSmallFloating {
+		static void run(int m, int n, int k, const T *a, int rs_a, int cs_a, const T *b, int rs_b, int cs_b, T *c, int ldc) {
+			if (m <= 0 || n <= 0) return;
+			if (k <= 0) {
+				for (int i = 0; i < m; i++) std::fill(c + i * ldc, c + i * ldc + n, (T)0);
+				return;
+			}
+			if (cs_b == 1) {
+				run_rows(m, n, k, a, rs_a, cs_a, b, rs_b, c, ldc);
+				return;
+			}
+			//B̍sAĂȂ΋lߒ
+			GemmBuffer<T> buf(k * n);
+			T *pb = buf.get();
+			for (int p = 0; p < k; p++) {
+				for (int j = 0; j < n; j++) pb[p * n + j] = b[p * rs_b + j * cs_b];
+			}
+			run_rows(m, n, k, a, rs_a, cs_a, pb, n, c, ldc);
+		}
+	private:
+		/*
+		L߃Zbg珇ɌvZł܂Ői߁Ac̗͋߃ZbgŌvZ
+		(AVX5121s2WX^̗񂪖Ƒ݂̑҂BȂ̂AVX2ɔC)
+		*/
+		static void run_rows(int m, int n, int k, const T *a, int rs_a, int cs_a, const T *b, int rs_b, T *c, int ldc) {
+			SimdLevel level = get_simd_level();
+			int j = 0;
+#ifdef FAST_CONTAINER_SIMD_AVX512
+			if (level >= SIMD_LEVEL_AVX512 && n - j >= SimdAvx512<T>::width * 2) j += Avx512Kernels::GemmSmallKernel<SimdAvx512<T>, T>::run(m, n - j, k, a, rs_a, cs_a, b + j, rs_b, c + j, ldc);
+#endif
+#ifdef FAST_CONTAINER_SIMD_AVX2
+			if (level >= SIMD_LEVEL_AVX2 && n - j >= SimdAvx2<T>::width) j += Avx2Kernels::GemmSmallKernel<SimdAvx2<T>, T>::run(m, n - j, k, a, rs_a, cs_a, b + j, rs_b, c + j, ldc);
+#endif
+#ifdef FAST_CONTAINER_SIMD_SSE4
+			if (level >= SIMD_LEVEL_SSE4 && n - j >= SimdSse4<T>::width) j += Sse4Kernels::GemmSmallKernel<SimdSse4<T>, T>::run(m, n - j, k, a, rs_a, cs_a, b + j, rs_b, c + j, ldc);
+#endif
+			(void)level;
+			if (j < n) gemm_small_scalar(m, n - j, k, a, rs_a, cs_a, b + j, rs_b, 1, c + j, ldc);
+		}
+	};
+	template<>
+	struct GemmSmall<double> :public GemmSmallFloating<double> { };
+	template<>
+	struct GemmSmall<float> :public GemmSmallFloating<float> { };
+
+	/*16rbg_̏ȍs (float֕ϊfloatŌvZAʂۂ߂ď)*/
+	template<typename T>
+	struct GemmSmallHalf {
+		static void run(int m, int n, int k, const T *a, int rs_a, int cs_a, const T *b, int rs_b, int cs_b, T *c, int ldc) {
+			if (m <= 0 || n <= 0) return;
+			GemmBuffer<float> buf(m * k + k * n + m * n);
+			float *fa = buf.get();
+			float *fb = fa + m * k;
+			float *fc = fb + k * n;
+			for (int i = 0; i < m; i++) {
+				for (int p = 0; p < k; p++) fa[i * k + p] = (float)a[i * rs_a + p * cs_a];
+			}
+			for (int p = 0; p < k; p++) {
+				if (cs_b == 1) HalfConverter<T>::to_float(b + p * rs_b, fb + p * n, n);
+				else for (int j = 0; j < n; j++) fb[p * n + j] = (float)b[p * rs_b + j * cs_b];
+			}
+			GemmSmall<float>::run(m, n, k, fa, k, 1, fb, n, 1, fc, n);
+			for (int i = 0; i < m; i++) HalfConverter<T>::from_float(fc + i * n, c + i * ldc, n);
+		}
+	};
+	template<>
+	struct GemmSmall<bfloat16> :public GemmSmallHalf<bfloat16> { };
+	template<>
+	struct GemmSmall<half> :public GemmSmallHalf<half> { };
+
+	/*ȍsς1XbhŃpbNɌvZ ( gemm() Ɠ)*/
+	template<typename T>
+	void gemm_small(int m, int n, int k, const T *a, int rs_a, int cs_a, const T *b, int rs_b, int cs_b, T *c, int ldc) {
+		GemmSmall<T>::run(m, n, k, a, rs_a, cs_a, b, rs_b, cs_b, c, ldc);
+	}
+
+	/*܂Ƃ߂ČvZsς1 (e gemm() Ɠ)*/
+	template<typename T>
+	struct GemmBatchItem {
+		int m;
+		int n;
+		int k;
+		const T *a;
+		int rs_a;
+		int cs_a;
+		const T *b;
+		int rs_b;
+		int cs_b;
+		T *c;
+		int ldc;
+	};
+
+	/*
+	sς܂Ƃ߂ČvZ
+	ȍs (m * n * k <= GEMM_SMALL_WORK) ͑S1̕񃋁[vŐU蕪A1pbNɌvZ
+	傫ȍsς1 gemm() ŕɌvZ
+	exec: s
+	*/
+	template<typename T, class E>
+	void gemm_batched(const GemmBatchItem<T> *items, int count, E& exec) {
+		long long small_work = 0;
+		int small_count = 0;
+		for (int i = 0; i < count; i++) {
+			const GemmBatchItem<T>& item = items[i];
+			long long work = gemm_work(item.m, item.n, item.k);
+			if (work <= GEMM_SMALL_WORK) {
+				small_work += work;
+				small_count++;
+			}
+			else gemm(item.m, item.n, item.k, item.a, item.rs_a, item.cs_a, item.b, item.rs_b, item.cs_b, item.c, item.ldc, exec);
+		}
+		if (small_count == 0) return;
+		int grain = (int)std::max(1LL, GEMM_BATCH_GRAIN_WORK / std::max(1LL, small_work / small_count));
+		exec.parallel_for_range(0, count, [&](int begin, int end) {
+			for (int i = begin; i < end; i++) {
+				const GemmBatchItem<T>& item = items[i];
+				if (gemm_work(item.m, item.n, item.k) > GEMM_SMALL_WORK) continue;
+				gemm_small(item.m, item.n, item.k, item.a, item.rs_a, item.cs_a, item.b, item.rs_b, item.cs_b, item.c, item.ldc);
+			}
+		}, grain);
+	}
+
+	/*
+	`̍sς܂Ƃ߂ČvZ
+	iڂ a + i * stride_a, b + i * stride_b, c + i * stride_c (̑̈ gemm() Ɠ)
+	exec: s
+	*/
+	template<typename T, class E>
+	void gemm_strided_batched(int batch, int m, int n, int k, const T *a, int rs_a, int cs_a, size_t stride_a,
+		const T *b, int rs_b, int cs_b, size_t stride_b, T *c, int ldc, size_t stride_c, E& exec) {
+		long long work = gemm_work(m, n, k);
+		if (work > GEMM_SMALL_WORK) {
+			for (int i = 0; i < batch; i++) gemm(m, n, k, a + i * stride_a, rs_a, cs_a, b + i * stride_b, rs_b, cs_b, c + i * stride_c, ldc, exec);
+			return;
+		}
+		int grain = (int)std::max(1LL, GEMM_BATCH_GRAIN_WORK / std::max(1LL, work));
+		exec.parallel_for_range(0, batch, [&](int begin, int end) {
+			for (int i = begin; i < end; i++) gemm_small(m, n, k, a + i * stride_a, rs_a, cs_a, b + i * stride_b, rs_b, cs_b, c + i * stride_c, ldc);
+		}, grain);
+	}
+
+}
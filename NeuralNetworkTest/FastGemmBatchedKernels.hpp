@@ -0,0 +1,80 @@
+/*
+߃Zbg̏ȍsς̃J[l (FastGemmBatched.hpp 疽߃ZbgɎ荞 #pragma once Ȃ)
+S: ߃Zbg̃WX^ (荞ޖOԂ̖߃Zbĝ)
+*/
+
+	/*
+	pbNȂȍsςSIMDJ[l (B̍s͘A)
+	4s x 2WX^o͂WX^ɒuČvZAwidth̔{̗܂ŏ
+	߂l: vZ
+	*/
+	template<class S, typename T>
+	struct GemmSmallKernel {
+		using reg = typename S::reg;
+		static int run(int m, int n, int k, const T *a, int rs_a, int cs_a, const T *b, int rs_b, T *c, int ldc) {
+			const int W = S::width;
+			int j = 0;
+			for (; j + W * 2 <= n; j += W * 2) {
+				int i = 0;
+				for (; i + 4 <= m; i += 4) {
+					const T *pa = a + i * rs_a;
+					reg c00 = S::set1((T)0), c01 = c00, c10 = c00, c11 = c00, c20 = c00, c21 = c00, c30 = c00, c31 = c00;
+					for (int p = 0; p < k; p++) {
+						const T *pb = b + p * rs_b + j;
+						const T *ap = pa + p * cs_a;
+						reg b0 = S::load(pb);
+						reg b1 = S::load(pb + W);
+						reg ai;
+						ai = S::set1(ap[0]); c00 = S::fmadd(ai, b0, c00); c01 = S::fmadd(ai, b1, c01);
+						ai = S::set1(ap[rs_a]); c10 = S::fmadd(ai, b0, c10); c11 = S::fmadd(ai, b1, c11);
+						ai = S::set1(ap[rs_a * 2]); c20 = S::fmadd(ai, b0, c20); c21 = S::fmadd(ai, b1, c21);
+						ai = S::set1(ap[rs_a * 3]); c30 = S::fmadd(ai, b0, c30); c31 = S::fmadd(ai, b1, c31);
+					}
+					T *pc = c + i * ldc + j;
+					S::store(pc, c00); S::store(pc + W, c01); pc += ldc;
+					S::store(pc, c10); S::store(pc + W, c11); pc += ldc;
+					S::store(pc, c20); S::store(pc + W, c21); pc += ldc;
+					S::store(pc, c30); S::store(pc + W, c31);
+				}
+				for (; i < m; i++) {
+					const T *pa = a + i * rs_a;
+					reg c0 = S::set1((T)0), c1 = c0;
+					for (int p = 0; p < k; p++) {
+						const T *pb = b + p * rs_b + j;
+						reg ai = S::set1(pa[p * cs_a]);
+						c0 = S::fmadd(ai, S::load(pb), c0);
+						c1 = S::fmadd(ai, S::load(pb + W), c1);
+					}
+					S::store(c + i * ldc + j, c0);
+					S::store(c + i * ldc + j + W, c1);
+				}
+			}
+			for (; j + W <= n; j += W) {
+				int i = 0;
+				for (; i + 4 <= m; i += 4) {
+					const T *pa = a + i * rs_a;
+					reg c0 = S::set1((T)0), c1 = c0, c2 = c0, c3 = c0;
+					for (int p = 0; p < k; p++) {
+						const T *ap = pa + p * cs_a;
+						reg b0 = S::load(b + p * rs_b + j);
+						c0 = S::fmadd(S::set1(ap[0]), b0, c0);
+						c1 = S::fmadd(S::set1(ap[rs_a]), b0, c1);
+						c2 = S::fmadd(S::set1(ap[rs_a * 2]), b0, c2);
+						c3 = S::fmadd(S::set1(ap[rs_a * 3]), b0, c3);
+					}
+					T *pc = c + i * ldc + j;
+					S::store(pc, c0); pc += ldc;
+					S::store(pc, c1); pc += ldc;
+					S::store(pc, c2); pc += ldc;
+					S::store(pc, c3);
+				}
+				for (; i < m; i++) {
+					const T *pa = a + i * rs_a;
+					reg c0 = S::set1((T)0);
+					for (int p = 0; p < k; p++) c0 = S::fmadd(S::set1(pa[p * cs_a]), S::load(b + p * rs_b + j), c0);
+					S::store(c + i * ldc + j, c0);
+				}
+			}
+			return j;
+		}
+	};
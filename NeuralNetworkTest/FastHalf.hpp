@@ -0,0 +1,448 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+/*
+16rbg_̈ꊇϊŎg閽߃Zbg
+(F16C߂AVX2̒iKɊ܂߂Ďsɐؑ)
+*/
+#ifdef FAST_CONTAINER_SIMD_AVX2
+	#define FAST_CONTAINER_SIMD_F16C
+#endif
+
+namespace FastContainer {
+
+	/*
+	16rbg_ (i[p)
+	bfloat16: 1, w8, 7 (float̏16rbgA͈͂floatƓ)
+	half: 1, w5, 10 (IEEE 754 binary16)
+	Zfloat֕ϊčsAɍŋߐڋ֊ۂ߂
+	AMP16rbǧ^Ȃ߁AMSVCŎgꍇ FAST_CONTAINER_NO_AMP `邱 (ZqA֐AMP͑֎ɂȂ)
+	*/
+
+	inline uint32_t float_to_bits(float x) {
+		uint32_t result;
+		memcpy(&result, &x, sizeof(result));
+		return result;
+	}
+	inline float bits_to_float(uint32_t x) {
+		float result;
+		memcpy(&result, &x, sizeof(result));
+		return result;
+	}
+
+	/*float -> bfloat16 (ŋߐڋۂ)*/
+	inline uint16_t float_to_bfloat16_bits(float x) {
+		uint32_t u = float_to_bits(x);
+		if ((u & 0x7fffffff) > 0x7f800000) return (uint16_t)((u >> 16) | 0x40);
+		u += 0x7fff + ((u >> 16) & 1);
+		return (uint16_t)(u >> 16);
+	}
+	/*bfloat16 -> float*/
+	inline float bfloat16_bits_to_float(uint16_t x) { return bits_to_float((uint32_t)x << 16); }
+
+	/*float -> half (ŋߐڋۂ߁A͈͊O͖)*/
+	inline uint16_t float_to_half_bits(float x) {
+		uint32_t u = float_to_bits(x);
+		uint32_t sign = (u >> 16) & 0x8000;
+		uint32_t abs = u & 0x7fffffff;
+		if (abs >= 0x7f800000) return (uint16_t)(sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0));
+		if (abs >= 0x477ff000) return (uint16_t)(sign | 0x7c00);
+		if (abs < 0x38800000) {
+			//񐳋K
+			if (abs < 0x33000000) return (uint16_t)sign;
+			uint32_t mant = (abs & 0x7fffff) | 0x800000;
+			int shift = 126 - (int)(abs >> 23);
+			uint32_t result = mant >> shift;
+			uint32_t rem = mant & ((1u << shift) - 1);
+			uint32_t halfway = 1u << (shift - 1);
+			if (rem > halfway || (rem == halfway && (result & 1))) result++;
+			return (uint16_t)(sign | result);
+		}
+		abs -= 0x38000000;
+		return (uint16_t)(sign | ((abs + 0xfff + ((abs >> 13) & 1)) >> 13));
+	}
+	/*half -> float*/
+	inline float half_bits_to_float(uint16_t x) {
+		uint32_t sign = (uint32_t)(x & 0x8000) << 16;
+		uint32_t exp = (x >> 10) & 0x1f;
+		uint32_t mant = x & 0x3ff;
+		if (exp == 0) {
+			if (mant == 0) return bits_to_float(sign);
+			//񐳋K𐳋K
+			exp = 113;
+			while (!(mant & 0x400)) {
+				mant <<= 1;
+				exp--;
+			}
+			return bits_to_float(sign | (exp << 23) | ((mant & 0x3ff) << 13));
+		}
+		if (exp == 31) return bits_to_float(sign | 0x7f800000 | (mant << 13) | (mant ? 0x400000 : 0));
+		return bits_to_float(sign | ((exp + 112) << 23) | (mant << 13));
+	}
+
+	/*16rbg_̋ʕ
+	D: hNX, TO: float -> rbg, FROM: rbg -> float*/
+	template<class D, uint16_t(*TO)(float), float(*FROM)(uint16_t)>
+	struct HalfFloatBase {
+		uint16_t bits;
+
+		operator float() const { return FROM(bits); }
+		static D from_bits(uint16_t bits) {
+			D result;
+			result.bits = bits;
+			return result;
+		}
+
+		template<typename U>
+		D& operator+=(U x) { return set((float)*this + (float)x); }
+		template<typename U>
+		D& operator-=(U x) { return set((float)*this - (float)x); }
+		template<typename U>
+		D& operator*=(U x) { return set((float)*this * (float)x); }
+		template<typename U>
+		D& operator/=(U x) { return set((float)*this / (float)x); }
+
+	protected:
+		D& set(float x) {
+			bits = TO(x);
+			return static_cast<D&>(*this);
+		}
+	};
+
+	/*bfloat16*/
+	struct bfloat16 :public HalfFloatBase<bfloat16, &float_to_bfloat16_bits, &bfloat16_bits_to_float> {
+		bfloat16() = default;
+		template<typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+		bfloat16(U x) { bits = float_to_bfloat16_bits((float)x); }
+	};
+
+	/*half (IEEE 754 binary16)*/
+	struct half :public HalfFloatBase<half, &float_to_half_bits, &half_bits_to_float> {
+		half() = default;
+		template<typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+		half(U x) { bits = float_to_half_bits((float)x); }
+	};
+
+	/*16rbg_*/
+	template<typename T>
+	struct IsHalfFloat :public std::false_type { };
+	template<>
+	struct IsHalfFloat<bfloat16> :public std::true_type { };
+	template<>
+	struct IsHalfFloat<half> :public std::true_type { };
+
+	/*16rbg_floatŗݐς*/
+	template<>
+	struct AccumulateType<bfloat16> { using type = float; };
+	template<>
+	struct AccumulateType<half> { using type = float; };
+
+	/*ꊇϊ T <-> float
+	SIMDgȂꍇ1vfϊ*/
+	template<typename T>
+	struct HalfConverter;
+
+#ifdef FAST_CONTAINER_SIMD_AVX2
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_AVX2)
+	/*8vfϊł鏊܂ŕϊ AVX2
+	߂l: ϊvf*/
+	inline int bfloat16_to_float_avx2(const bfloat16 *in, float *out, int size) {
+		int i = 0;
+		for (; i + 8 <= size; i += 8) {
+			__m256i x = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(in + i)));
+			_mm256_storeu_ps(out + i, _mm256_castsi256_ps(_mm256_slli_epi32(x, 16)));
+		}
+		return i;
+	}
+	inline int bfloat16_from_float_avx2(const float *in, bfloat16 *out, int size) {
+		const __m256i bias = _mm256_set1_epi32(0x7fff);
+		const __m256i one = _mm256_set1_epi32(1);
+		const __m256i quiet = _mm256_set1_epi32(0x40);
+		int i = 0;
+		for (; i + 8 <= size; i += 8) {
+			__m256 f = _mm256_loadu_ps(in + i);
+			__m256i u = _mm256_castps_si256(f);
+			__m256i lsb = _mm256_and_si256(_mm256_srli_epi32(u, 16), one);
+			__m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(u, _mm256_add_epi32(bias, lsb)), 16);
+			__m256i nan = _mm256_or_si256(_mm256_srli_epi32(u, 16), quiet);
+			__m256i is_nan = _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_UNORD_Q));
+			__m256i r = _mm256_blendv_epi8(rounded, nan, is_nan);
+			r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0xd8);
+			_mm_storeu_si128((__m128i *)(out + i), _mm256_castsi256_si128(r));
+		}
+		return i;
+	}
+FAST_CONTAINER_TARGET_END
+#endif
+
+#ifdef FAST_CONTAINER_SIMD_F16C
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_AVX2)
+	/*8vfϊł鏊܂ŕϊ F16C
+	߂l: ϊvf*/
+	inline int half_to_float_f16c(const half *in, float *out, int size) {
+		int i = 0;
+		for (; i + 8 <= size; i += 8) _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(in + i))));
+		return i;
+	}
+	inline int half_from_float_f16c(const float *in, half *out, int size) {
+		int i = 0;
+		for (; i + 8 <= size; i += 8) _mm_storeu_si128((__m128i *)(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+		return i;
+	}
+FAST_CONTAINER_TARGET_END
+#endif
+
+	template<>
+	struct HalfConverter<bfloat16> {
+		static void to_float(const bfloat16 *in, float *out, int size) {
+			int i = 0;
+#ifdef FAST_CONTAINER_SIMD_AVX2
+			if (get_simd_level() >= SIMD_LEVEL_AVX2) i = bfloat16_to_float_avx2(in, out, size);
+#endif
+			for (; i < size; i++) out[i] = in[i];
+		}
+		static void from_float(const float *in, bfloat16 *out, int size) {
+			int i = 0;
+#ifdef FAST_CONTAINER_SIMD_AVX2
+			if (get_simd_level() >= SIMD_LEVEL_AVX2) i = bfloat16_from_float_avx2(in, out, size);
+#endif
+			for (; i < size; i++) out[i] = in[i];
+		}
+	};
+	template<>
+	struct HalfConverter<half> {
+		/*F16C߂AVX2ɑΉCPUŎg*/
+		static void to_float(const half *in, float *out, int size) {
+			int i = 0;
+#ifdef FAST_CONTAINER_SIMD_F16C
+			if (get_simd_level() >= SIMD_LEVEL_AVX2) i = half_to_float_f16c(in, out, size);
+#endif
+			for (; i < size; i++) out[i] = in[i];
+		}
+		static void from_float(const float *in, half *out, int size) {
+			int i = 0;
+#ifdef FAST_CONTAINER_SIMD_F16C
+			if (get_simd_level() >= SIMD_LEVEL_AVX2) i = half_from_float_f16c(in, out, size);
+#endif
+			for (; i < size; i++) out[i] = in[i];
+		}
+	};
+
+	/*ϊȂ珈1̗vf (X^bN̍Ɨ̈Ɏ܂傫)*/
+	const int HALF_CHUNK = 512;
+
+	/*vf̒PZ (float֕ϊfloat̃J[lŌvZ)*/
+	template<typename T, int OP>
+	struct HalfUnaryKernel {
+		static void run(const T *in, T *out, int size) {
+			auto kernel = get_simd_kernels<float>().unary[OP];
+			float buf[HALF_CHUNK];
+			for (int i = 0; i < size; i += HALF_CHUNK) {
+				int n = std::min(HALF_CHUNK, size - i);
+				HalfConverter<T>::to_float(in + i, buf, n);
+				kernel(buf, buf, n);
+				HalfConverter<T>::from_float(buf, out + i, n);
+			}
+		}
+	};
+
+	/*vf̓񍀉Z (float֕ϊfloat̃J[lŌvZ)
+	SCALAR: x2XJ[lƂĈ*/
+	template<typename T, int OP, bool SCALAR>
+	struct HalfBinaryKernel {
+		static void run(const T *x1, const T *x2, T *out, int size) {
+			auto kernel = SCALAR ? get_simd_kernels<float>().binary_scalar[OP] : get_simd_kernels<float>().binary[OP];
+			float buf1[HALF_CHUNK];
+			float buf2[HALF_CHUNK];
+			if (SCALAR) buf2[0] = *x2;
+			for (int i = 0; i < size; i += HALF_CHUNK) {
+				int n = std::min(HALF_CHUNK, size - i);
+				HalfConverter<T>::to_float(x1 + i, buf1, n);
+				if (!SCALAR) HalfConverter<T>::to_float(x2 + i, buf2, n);
+				kernel(buf1, buf2, buf1, n);
+				HalfConverter<T>::from_float(buf1, out + i, n);
+			}
+		}
+	};
+
+	/*Wv (float֕ϊfloat̃J[lŌvZAvfloat̂܂ܕԂ)*/
+	template<typename T>
+	struct HalfReduceKernel {
+		template<float(*F)(const float *, int), class C>
+		static float reduce(const T *in, int size, C combine) {
+			float buf[HALF_CHUNK];
+			float result = 0;
+			for (int i = 0; i < size; i += HALF_CHUNK) {
+				int n = std::min(HALF_CHUNK, size - i);
+				HalfConverter<T>::to_float(in + i, buf, n);
+				float x = F(buf, n);
+				result = i == 0 ? x : combine(result, x);
+			}
+			return result;
+		}
+		static float sum(const T *in, int size) { return reduce<&call_sum>(in, size, [](float x1, float x2) { return x1 + x2; }); }
+		static float sum_kahan(const T *in, int size) {
+			/*`N̍v␳tł܂Ƃ߂*/
+			float buf[HALF_CHUNK];
+			float result = 0;
+			float c = 0;
+			for (int i = 0; i < size; i += HALF_CHUNK) {
+				int n = std::min(HALF_CHUNK, size - i);
+				HalfConverter<T>::to_float(in + i, buf, n);
+				float x = call_sum_kahan(buf, n);
+				float t = result + x;
+				if (std::abs(result) >= std::abs(x)) c += (result - t) + x;
+				else c += (x - t) + result;
+				result = t;
+			}
+			return result + c;
+		}
+		static T min(const T *in, int size) { return (T)reduce<&call_min>(in, size, [](float x1, float x2) { return std::min(x1, x2); }); }
+		static T max(const T *in, int size) { return (T)reduce<&call_max>(in, size, [](float x1, float x2) { return std::max(x1, x2); }); }
+	private:
+		static float call_sum(const float *in, int size) { return get_simd_kernels<float>().sum(in, size); }
+		static float call_sum_kahan(const float *in, int size) { return get_simd_kernels<float>().sum_kahan(in, size); }
+		static float call_min(const float *in, int size) { return get_simd_kernels<float>().min(in, size); }
+		static float call_max(const float *in, int size) { return get_simd_kernels<float>().max(in, size); }
+	};
+
+	template<typename T, int... U, int... B>
+	void register_half_kernels(SimdKernelTable<T>& table, SimdLevel level, std::integer_sequence<int, U...>, std::integer_sequence<int, B...>) {
+		table.level = level;
+		table.sum = &HalfReduceKernel<T>::sum;
+		table.sum_kahan = &HalfReduceKernel<T>::sum_kahan;
+		table.min = &HalfReduceKernel<T>::min;
+		table.max = &HalfReduceKernel<T>::max;
+		int unary[] = { (table.unary[U] = &HalfUnaryKernel<T, U>::run, 0)... };
+		int binary[] = { (table.binary[B] = &HalfBinaryKernel<T, B, false>::run, table.binary_scalar[B] = &HalfBinaryKernel<T, B, true>::run, 0)... };
+		(void)unary;
+		(void)binary;
+	}
+
+	/*16rbg_̃J[l̕\ (float̃J[lgꍇ̂)*/
+	template<typename T>
+	struct SimdHalfKernelFactory {
+		static SimdKernelTable<T> create(SimdLevel level) {
+			SimdKernelTable<T> table;
+			SimdLevel float_level = SimdKernelFactory<float>::create(level).level;
+			if (float_level == SIMD_LEVEL_NONE) return table;
+			register_half_kernels(table, float_level, std::make_integer_sequence<int, SIMD_UNARY_NUM>(), std::make_integer_sequence<int, SIMD_BINARY_NUM>());
+			return table;
+		}
+	};
+	template<>
+	struct SimdKernelFactory<bfloat16> :public SimdHalfKernelFactory<bfloat16> { };
+	template<>
+	struct SimdKernelFactory<half> :public SimdHalfKernelFactory<half> { };
+
+	/*
+	16rbg_̍sς̏o
+	A, B̓pbNfloat֕ϊfloatŌvZ (floatŗݐ)Ao̓^Cۂ߂C֏
+	k̃ubNɕꍇ͓r̗ݐςfloat̍Ɨ̈ (m x n) Ŏ
+	Gs[ÕoCAXƊ֐floatœKpAmask͊ۂ߂o͂珑
+	*/
+	template<typename S>
+	class GemmHalfOutput {
+	public:
+		GemmHalfOutput(int m, int n, bool multiple_k_blocks, S *c, int ldc, const GemmEpilogue<S>& epilogue)
+			: bias_buf(epilogue.bias != nullptr ? n : 0), acc_buf(multiple_k_blocks ? (size_t)m * n : 0),
+			c(c), ldc(ldc), n(n), mask(epilogue.mask), ldm(epilogue.ldm), kernel(GemmEpilogueKernel<float>::get()) {
+			float_epilogue.activation = epilogue.activation;
+			if (epilogue.bias != nullptr) {
+				HalfConverter<S>::to_float(epilogue.bias, bias_buf.get(), n);
+				float_epilogue.bias = bias_buf.get();
+			}
+			has_epilogue = !float_epilogue.is_empty();
+			acc = acc_buf.get();
+		}
+		/*si̗ j`j + count - 1  src (o̓^C1s) 
+		first: ŏkubN, last: ŌkubN*/
+		void write(int i, int j, int count, const float *src, bool first, bool last) const {
+			float *acc_row = acc + (size_t)i * n + j;
+			if (!last) {
+				if (first) for (int x = 0; x < count; x++) acc_row[x] = src[x];
+				else for (int x = 0; x < count; x++) acc_row[x] += src[x];
+				return;
+			}
+			float out[GemmBlock<float>::NR];
+			if (first) for (int x = 0; x < count; x++) out[x] = src[x];
+			else for (int x = 0; x < count; x++) out[x] = acc_row[x] + src[x];
+			if (has_epilogue) kernel(float_epilogue, i, j, count, out, out, false);
+			S *row = c + (size_t)i * ldc + j;
+			HalfConverter<S>::from_float(out, row, count);
+			if (mask == nullptr) return;
+			uint64_t bits = 0;
+			for (int x = 0; x < count; x++) bits |= (uint64_t)((float)row[x] > 0.0f) << x;
+			bitmask_store(mask + (size_t)i * ldm, j, bits, count);
+		}
+	private:
+		GemmBuffer<float> bias_buf;
+		GemmBuffer<float> acc_buf;
+		S *c;
+		int ldc;
+		int n;
+		uint64_t *mask;
+		int ldm;
+		GemmEpilogueKernel<float>::func kernel;
+		GemmEpilogue<float> float_epilogue;
+		bool has_epilogue;
+		float *acc;
+	};
+	template<>
+	class GemmOutput<float, bfloat16> :public GemmHalfOutput<bfloat16> {
+	public:
+		using GemmHalfOutput<bfloat16>::GemmHalfOutput;
+	};
+	template<>
+	class GemmOutput<float, half> :public GemmHalfOutput<half> {
+	public:
+		using GemmHalfOutput<half>::GemmHalfOutput;
+	};
+	/*sς̃pbN̕ϊ (SIMD߂ł܂Ƃ߂float֕ϊ)*/
+	template<>
+	struct GemmPackConverter<float, bfloat16> {
+		static void run(const bfloat16 *in, float *out, int count) { HalfConverter<bfloat16>::to_float(in, out, count); }
+	};
+	template<>
+	struct GemmPackConverter<float, half> {
+		static void run(const half *in, float *out, int count) { HalfConverter<half>::to_float(in, out, count); }
+	};
+	template<>
+	struct GemmCompute<bfloat16> { using type = float; };
+	template<>
+	struct GemmCompute<half> { using type = float; };
+
+}
+
+namespace std {
+
+	/*16rbg_̐l͈̔*/
+	template<>
+	class numeric_limits<FastContainer::bfloat16> :public numeric_limits<float> {
+	public:
+		static constexpr int digits = 8;
+		static constexpr int digits10 = 2;
+		static FastContainer::bfloat16 min() { return FastContainer::bfloat16::from_bits(0x0080); }
+		static FastContainer::bfloat16 max() { return FastContainer::bfloat16::from_bits(0x7f7f); }
+		static FastContainer::bfloat16 lowest() { return FastContainer::bfloat16::from_bits(0xff7f); }
+		static FastContainer::bfloat16 epsilon() { return FastContainer::bfloat16::from_bits(0x3c00); }
+		static FastContainer::bfloat16 infinity() { return FastContainer::bfloat16::from_bits(0x7f80); }
+		static FastContainer::bfloat16 quiet_NaN() { return FastContainer::bfloat16::from_bits(0x7fc0); }
+	};
+	template<>
+	class numeric_limits<FastContainer::half> :public numeric_limits<float> {
+	public:
+		static constexpr int digits = 11;
+		static constexpr int digits10 = 3;
+		static constexpr int min_exponent = -13;
+		static constexpr int max_exponent = 16;
+		static FastContainer::half min() { return FastContainer::half::from_bits(0x0400); }
+		static FastContainer::half max() { return FastContainer::half::from_bits(0x7bff); }
+		static FastContainer::half lowest() { return FastContainer::half::from_bits(0xfbff); }
+		static FastContainer::half epsilon() { return FastContainer::half::from_bits(0x1400); }
+		static FastContainer::half infinity() { return FastContainer::half::from_bits(0x7c00); }
+		static FastContainer::half quiet_NaN() { return FastContainer::half::from_bits(0x7e00); }
+	};
+
+}
@@ -10,6 +10,8 @@ namespace FastContainer {
 	template<typename T>
 	class FastMatrix {
 	public:
+		using value_type = T;
+
 		FastMatrix() { }
 		FastMatrix(int row, int col) { resize(row, col); }
 		FastMatrix(std::vector<T> vec, int row) {
@@ -17,14 +19,15 @@ namespace FastContainer {
 			column_size = vec.size() / row_size;
 			size = row_size * column_size;
 			if (size != vec.size()) throw fast_container_exception();
-			entity = vec;
+			entity.assign(vec.begin(), vec.end());
 		}
-		FastMatrix(FastVector<T> vec, int row) {
+		/*xNg[row]s̍sƂăRs[ (Rs[Ɍ`ςɂ FastVector::reshape_view g)*/
+		FastMatrix(const FastVector<T>& vec, int row) {
 			row_size = row;
 			column_size = vec.get_size() / row_size;
 			size = row_size * column_size;
 			if (size != vec.get_size()) throw fast_container_exception();
-			entity = vec.get_entity();
+			entity.assign(vec.get_data(), vec.get_data() + size);
 		}
 		FastMatrix(std::vector<std::vector<T>> mat) {
 			resize(mat.size(), mat[0].size());
@@ -36,8 +39,23 @@ namespace FastContainer {
 				}
 			}
 		}
+		/*]Đ*/
+		template<class E>
+		FastMatrix(const Expression<E>& expr) {
+			resize(expr.self().get_row_size(), expr.self().get_column_size());
+			if (size) evaluate_expression(expr, &entity[0]);
+		}
 		~FastMatrix() { }
 
+		/*]đ (`Ȃ̈ėp)*/
+		template<class E>
+		FastMatrix<T>& operator=(const Expression<E>& expr) {
+			const E& e = expr.self();
+			if (row_size != e.get_row_size() || column_size != e.get_column_size()) return *this = FastMatrix<T>(expr);
+			if (size) evaluate_expression(expr, &entity[0]);
+			return *this;
+		}
+
 		void resize(int row, int col) {
 			row_size = row;
 			column_size = col;
@@ -45,12 +63,35 @@ namespace FastContainer {
 			entity.resize(size);
 		}
 
-		std::vector<T> get_entity() { return entity; }
-		int get_row_size() { return row_size; }
-		int get_column_size() { return column_size; }
-		int get_size() { return size; }
+		/*̈p row x col ̍s𐶐 (Rs[Ȃ)*/
+		static FastMatrix<T> from_storage(FastStorage<T>&& storage, int row, int col) {
+			if ((size_t)row * col != storage.size()) throw fast_container_exception();
+			FastMatrix<T> result;
+			result.entity = std::move(storage);
+			result.row_size = row;
+			result.column_size = col;
+			result.size = row * col;
+			return result;
+		}
+		/*̈n (Rs[Ȃ ̍s͋ɂȂ)*/
+		FastStorage<T> release_storage() {
+			FastStorage<T> result = std::move(entity);
+			entity.clear();
+			row_size = 0;
+			column_size = 0;
+			size = 0;
+			return result;
+		}
+
+		const FastStorage<T>& get_entity() const { return entity; }
+		T *get_data() { return entity.data(); }
+		const T *get_data() const { return entity.data(); }
+		int get_row_size() const { return row_size; }
+		int get_column_size() const { return column_size; }
+		int get_size() const { return size; }
 
 		T& operator[](int idx) { return entity[idx]; }
+		const T& operator[](int idx) const { return entity[idx]; }
 		T& operator()(int row, int col) { return entity[row * column_size + col]; }
 
 		auto begin() { return entity.begin(); }
@@ -58,32 +99,136 @@ namespace FastContainer {
 		auto end() { return entity.end(); }
 		auto end() const { return entity.end(); }
 
+		/*r[ƂĎQ (Rs[Ȃ)*/
+		FastMatrixView<T> view() { return FastMatrixView<T>(*this); }
+		/*ǂݎp̃r[ƂĎQ (Rs[Ȃ)*/
+		FastMatrixView<T> view() const { return FastMatrixView<T>(*this); }
+		/*[row]s̍sƂăr[ŎQ (O(1)Ō`ς)*/
+		FastMatrixView<T> reshape_view(int row) { return view().reshape(row); }
+		/*s[begin][count]sr[ƂĎQ*/
+		FastMatrixView<T> rows_view(int begin, int count) { return view().rows(begin, count); }
+		/*[begin][count]r[ƂĎQ*/
+		FastMatrixView<T> columns_view(int begin, int count) { return view().columns(begin, count); }
+		/*s[row]r[ƂĎQ*/
+		FastVectorView<T> row_view(int row) { return view().row(row); }
+		/*[col]r[ƂĎQ*/
+		FastVectorView<T> column_view(int col) { return view().column(col); }
+
 		/*FastVector֕ϊ*/
 		FastVector<T> to_FastVector() {
 			FastVector<T> result(entity);
 			return result;
 		}
 
+		/*vf̌^ϊ (16rbg_Ƃ̕ϊfloatoR)*/
+		template<typename U>
+		FastMatrix<U> cast() const {
+			FastMatrix<U> result;
+			cast_to(result);
+			return result;
+		}
+		/*vf̌^ϊresult֏ (`Ⴆresult̑傫ς)*/
+		template<typename U>
+		void cast_to(FastMatrix<U>& result) const {
+			if (result.get_row_size() != row_size || result.get_column_size() != column_size) result.resize(row_size, column_size);
+			parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) result[i] = (U)(Accumulate<T>)entity[i];
+			}, SIMD_GRAIN);
+		}
+		/*this += alpha * mat (mat͗vf̌^قȂĂ悢 xwK̃}X^[d݂̍XVp)*/
+		template<typename U>
+		FastMatrix<T>& axpy_cast(T alpha, const FastMatrix<U>& mat) {
+			if (row_size != mat.get_row_size()) throw fast_container_exception();
+			if (column_size != mat.get_column_size()) throw fast_container_exception();
+			parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) entity[i] += alpha * (T)(Accumulate<U>)mat[i];
+			}, SIMD_GRAIN);
+			return *this;
+		}
+		/*SvfL (inf, NaN܂܂Ȃ) */
+		bool is_finite() const {
+			std::atomic<bool> result(true);
+			parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					if (!std::isfinite((Accumulate<T>)entity[i])) {
+						result = false;
+						return;
+					}
+				}
+			}, SIMD_GRAIN);
+			return result;
+		}
+
+		/* (̈ėp) [hؑ*/
+		FastMatrix<T>& operator+=(const FastMatrix<T>& mat) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_combo_inplace)([](T x1, T x2) restrict(cpu, amp) { return x1 + x2; }, mat); }
+		FastMatrix<T>& operator-=(const FastMatrix<T>& mat) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_combo_inplace)([](T x1, T x2) restrict(cpu, amp) { return x1 - x2; }, mat); }
+		FastMatrix<T>& operator*=(const FastMatrix<T>& mat) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_combo_inplace)([](T x1, T x2) restrict(cpu, amp) { return x1 * x2; }, mat); }
+		FastMatrix<T>& operator/=(const FastMatrix<T>& mat) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_combo_inplace)([](T x1, T x2) restrict(cpu, amp) { return x1 / x2; }, mat); }
+		FastMatrix<T>& operator+=(T val) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_inplace)([=](T x) restrict(cpu, amp) { return x + val; }); }
+		FastMatrix<T>& operator-=(T val) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_inplace)([=](T x) restrict(cpu, amp) { return x - val; }); }
+		FastMatrix<T>& operator*=(T val) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_inplace)([=](T x) restrict(cpu, amp) { return x * val; }); }
+		FastMatrix<T>& operator/=(T val) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_inplace)([=](T x) restrict(cpu, amp) { return x / val; }); }
+		/*]ĕ*/
+		template<class E>
+		FastMatrix<T>& operator+=(const Expression<E>& expr) { return *this = BinaryExpression<AddOperation, ContainerExpression<FastMatrix<T>>, E>(*this, expr.self()); }
+		template<class E>
+		FastMatrix<T>& operator-=(const Expression<E>& expr) { return *this = BinaryExpression<SubOperation, ContainerExpression<FastMatrix<T>>, E>(*this, expr.self()); }
+		template<class E>
+		FastMatrix<T>& operator*=(const Expression<E>& expr) { return *this = BinaryExpression<MulOperation, ContainerExpression<FastMatrix<T>>, E>(*this, expr.self()); }
+		template<class E>
+		FastMatrix<T>& operator/=(const Expression<E>& expr) { return *this = BinaryExpression<DivOperation, ContainerExpression<FastMatrix<T>>, E>(*this, expr.self()); }
+
+		/*this += alpha * mat [hؑ*/
+		FastMatrix<T>& axpy(T alpha, const FastMatrix<T>& mat) { return SWITCH_FAST_CONTAONER_FUNCTION(axpy)(alpha, mat); }
+		/*this += alpha * mat*/
+		FastMatrix<T>& axpy_com(T alpha, const FastMatrix<T>& mat) { return apply_combo_inplace_com([=](T x1, T x2) { return x1 + alpha * x2; }, mat); }
+		/*this += alpha * mat AMP*/
+		FastMatrix<T>& axpy_amp(T alpha, const FastMatrix<T>& mat) { return apply_combo_inplace_amp([=](T x1, T x2) restrict(amp) { return x1 + alpha * x2; }, mat); }
+		/*this += alpha * mat PPL*/
+		FastMatrix<T>& axpy_ppl(T alpha, const FastMatrix<T>& mat) { return apply_combo_inplace_ppl([=](T x1, T x2) { return x1 + alpha * x2; }, mat); }
+		/*this += alpha * mat STD*/
+		FastMatrix<T>& axpy_std(T alpha, const FastMatrix<T>& mat) { return apply_combo_inplace_std([=](T x1, T x2) { return x1 + alpha * x2; }, mat); }
+
+		/*this *= alpha [hؑ*/
+		FastMatrix<T>& scale_inplace(T alpha) { return SWITCH_FAST_CONTAONER_FUNCTION(scale_inplace)(alpha); }
+		/*this *= alpha*/
+		FastMatrix<T>& scale_inplace_com(T alpha) { return apply_inplace_com([=](T x) { return alpha * x; }); }
+		/*this *= alpha AMP*/
+		FastMatrix<T>& scale_inplace_amp(T alpha) { return apply_inplace_amp([=](T x) restrict(amp) { return alpha * x; }); }
+		/*this *= alpha PPL*/
+		FastMatrix<T>& scale_inplace_ppl(T alpha) { return apply_inplace_ppl([=](T x) { return alpha * x; }); }
+		/*this *= alpha STD*/
+		FastMatrix<T>& scale_inplace_std(T alpha) { return apply_inplace_std([=](T x) { return alpha * x; }); }
+
+		/*֐Kpď㏑ [hؑ
+		func: T(*func)(T x) (AMP[hł restrict(amp) Kv)*/
+		template<class F>
+		FastMatrix<T>& apply_inplace(F func) { return SWITCH_FAST_CONTAONER_FUNCTION(apply_inplace)(func); }
+
 		/*̂܂ܕԂ*/
 		FastMatrix<T> identity() { return *this; }
 
 		/*Βl [hؑ*/
 		FastMatrix<T> abs() { return SWITCH_FAST_CONTAONER_FUNCTION(abs)(); }
 		/*Βl*/
-		FastMatrix<T> abs_com() { return apply_com_func([](T x) { return std::abs(x); }); }
+		FastMatrix<T> abs_com() { return apply_com_func(SIMD_ABS, [](T x) { return std::abs(x); }); }
 		/*Βl AMP*/
 		FastMatrix<T> abs_amp() { return apply_amp_func([](T x) restrict(amp) { return concurrency::fast_math::fabs(x); }); }
 		/*Βl PPL*/
-		FastMatrix<T> abs_ppl() { return apply_ppl_func([](T x) { return std::abs(x); }); }
+		FastMatrix<T> abs_ppl() { return apply_ppl_func(SIMD_ABS, [](T x) { return std::abs(x); }); }
+		/*Βl STD*/
+		FastMatrix<T> abs_std() { return apply_std_func(SIMD_ABS, [](T x) { return std::abs(x); }); }
 
 		/*Log e [hؑ*/
 		FastMatrix<T> log() { return SWITCH_FAST_CONTAONER_FUNCTION(log)(); }
 		/*Log e*/
-		FastMatrix<T> log_com() { return apply_com_func([](T x) { return std::log(x); }); }
+		FastMatrix<T> log_com() { return apply_com_func(SIMD_LOG, [](T x) { return std::log(x); }); }
 		/*Log e AMP*/
 		FastMatrix<T> log_amp() { return apply_amp_func([](T x) restrict(amp) { return concurrency::fast_math::log(x); }); }
 		/*Log e PPL*/
-		FastMatrix<T> log_ppl() { return apply_ppl_func([](T x) { return std::log(x); }); }
+		FastMatrix<T> log_ppl() { return apply_ppl_func(SIMD_LOG, [](T x) { return std::log(x); }); }
+		/*Log e STD*/
+		FastMatrix<T> log_std() { return apply_std_func(SIMD_LOG, [](T x) { return std::log(x); }); }
 
 		/*Log 10 [hؑ*/
 		FastMatrix<T> log10() { return SWITCH_FAST_CONTAONER_FUNCTION(log10)(); }
@@ -93,15 +238,19 @@ namespace FastContainer {
 		FastMatrix<T> log10_amp() { return apply_amp_func([](T x) restrict(amp) { return concurrency::fast_math::log10(x); }); }
 		/*Log 10*/
 		FastMatrix<T> log10_ppl() { return apply_ppl_func([](T x) { return std::log10(x); }); }
+		/*Log 10 STD*/
+		FastMatrix<T> log10_std() { return apply_std_func([](T x) { return std::log10(x); }); }
 
 		/*2捪 [hؑ*/
 		FastMatrix<T> sqrt() { return SWITCH_FAST_CONTAONER_FUNCTION(sqrt)(); }
 		/*2捪*/
-		FastMatrix<T> sqrt_com() { return apply_com_func([](T x) { return std::sqrt(x); }); }
+		FastMatrix<T> sqrt_com() { return apply_com_func(SIMD_SQRT, [](T x) { return std::sqrt(x); }); }
 		/*2捪 AMP*/
 		FastMatrix<T> sqrt_amp() { return apply_amp_func([](T x) restrict(amp) { return concurrency::fast_math::sqrt(x); }); }
 		/*2捪 PPL*/
-		FastMatrix<T> sqrt_ppl() { return apply_ppl_func([](T x) { return std::sqrt(x); }); }
+		FastMatrix<T> sqrt_ppl() { return apply_ppl_func(SIMD_SQRT, [](T x) { return std::sqrt(x); }); }
+		/*2捪 STD*/
+		FastMatrix<T> sqrt_std() { return apply_std_func(SIMD_SQRT, [](T x) { return std::sqrt(x); }); }
 
 		/*K [hؑ*/
 		FastMatrix<T> pow(T exp) { return SWITCH_FAST_CONTAONER_FUNCTION(pow)(exp); }
@@ -111,33 +260,70 @@ namespace FastContainer {
 		FastMatrix<T> pow_amp(T exp) { return apply_amp_func([=](T x) restrict(amp) { return concurrency::fast_math::pow(x, exp); }); }
 		/*K PPL*/
 		FastMatrix<T> pow_ppl(T exp) { return apply_ppl_func([=](T x) { return std::pow(x, exp); }); }
+		/*K STD*/
+		FastMatrix<T> pow_std(T exp) { return apply_std_func([=](T x) { return std::pow(x, exp); }); }
 
 		/*e^x [hؑ*/
 		FastMatrix<T> exp() { return SWITCH_FAST_CONTAONER_FUNCTION(exp)(); }
 		/*e^x*/
-		FastMatrix<T> exp_com() { return apply_com_func([](T x) { return std::exp(x); }); }
+		FastMatrix<T> exp_com() { return apply_com_func(SIMD_EXP, [](T x) { return std::exp(x); }); }
 		/*e^x AMP*/
 		FastMatrix<T> exp_amp() { return apply_amp_func([](T x) restrict(amp) { return concurrency::fast_math::exp(x); }); }
 		/*e^x PPL*/
-		FastMatrix<T> exp_ppl() { return apply_ppl_func([](T x) { return std::exp(x); }); }
+		FastMatrix<T> exp_ppl() { return apply_ppl_func(SIMD_EXP, [](T x) { return std::exp(x); }); }
+		/*e^x STD*/
+		FastMatrix<T> exp_std() { return apply_std_func(SIMD_EXP, [](T x) { return std::exp(x); }); }
 
 		/*VOCh֐ [hؑ*/
 		FastMatrix<T> sigmoid() { return SWITCH_FAST_CONTAONER_FUNCTION(sigmoid)(); }
 		/*VOCh֐*/
-		FastMatrix<T> sigmoid_com() { return apply_com_func([](T x) { return (T)1 / (1 + std::exp(-x)); }); }
+		FastMatrix<T> sigmoid_com() { return apply_com_func(SIMD_SIGMOID, [](T x) { return (T)1 / (1 + std::exp(-x)); }); }
 		/*VOCh֐ AMP*/
 		FastMatrix<T> sigmoid_amp() { return apply_amp_func([](T x) restrict(amp) { return (T)1 / (1 + concurrency::fast_math::exp(-x)); }); }
 		/*VOCh֐ PPL*/
-		FastMatrix<T> sigmoid_ppl() { return apply_ppl_func([](T x) { return (T)1 / (1 + std::exp(-x)); }); }
+		FastMatrix<T> sigmoid_ppl() { return apply_ppl_func(SIMD_SIGMOID, [](T x) { return (T)1 / (1 + std::exp(-x)); }); }
+		/*VOCh֐ STD*/
+		FastMatrix<T> sigmoid_std() { return apply_std_func(SIMD_SIGMOID, [](T x) { return (T)1 / (1 + std::exp(-x)); }); }
+
+		/*VOCh֐Kpď㏑ [hؑ*/
+		FastMatrix<T>& sigmoid_inplace() { return SWITCH_FAST_CONTAONER_FUNCTION(sigmoid_inplace)(); }
+		/*VOCh֐Kpď㏑*/
+		FastMatrix<T>& sigmoid_inplace_com() {
+			SerialExecutor exec;
+			return apply_simd_inplace(SIMD_SIGMOID, [](T x) { return (T)1 / (1 + std::exp(-x)); }, exec);
+		}
+		/*VOCh֐Kpď㏑ AMP*/
+		FastMatrix<T>& sigmoid_inplace_amp() { return apply_inplace_amp([](T x) restrict(amp) { return (T)1 / (1 + concurrency::fast_math::exp(-x)); }); }
+		/*VOCh֐Kpď㏑ PPL*/
+		FastMatrix<T>& sigmoid_inplace_ppl() {
+			PplExecutor exec;
+			return apply_simd_inplace(SIMD_SIGMOID, [](T x) { return (T)1 / (1 + std::exp(-x)); }, exec);
+		}
+		/*VOCh֐Kpď㏑ STD*/
+		FastMatrix<T>& sigmoid_inplace_std() { return apply_simd_inplace(SIMD_SIGMOID, [](T x) { return (T)1 / (1 + std::exp(-x)); }, ThreadPool::get_instance()); }
+
+		/*VOCh֐̋t`d this *= y * (1 - y) [hؑ
+		y: VOCh֐̏o (̍s炸1̑ŏ㏑)*/
+		FastMatrix<T>& sigmoid_backward_inplace(const FastMatrix<T>& y) { return SWITCH_FAST_CONTAONER_FUNCTION(sigmoid_backward_inplace)(y); }
+		/*VOCh֐̋t`d this *= y * (1 - y)*/
+		FastMatrix<T>& sigmoid_backward_inplace_com(const FastMatrix<T>& y) { return apply_combo_inplace_com([](T x1, T x2) { return x1 * (x2 * ((T)1 - x2)); }, y); }
+		/*VOCh֐̋t`d this *= y * (1 - y) AMP*/
+		FastMatrix<T>& sigmoid_backward_inplace_amp(const FastMatrix<T>& y) { return apply_combo_inplace_amp([](T x1, T x2) restrict(amp) { return x1 * (x2 * ((T)1 - x2)); }, y); }
+		/*VOCh֐̋t`d this *= y * (1 - y) PPL*/
+		FastMatrix<T>& sigmoid_backward_inplace_ppl(const FastMatrix<T>& y) { return apply_combo_inplace_ppl([](T x1, T x2) { return x1 * (x2 * ((T)1 - x2)); }, y); }
+		/*VOCh֐̋t`d this *= y * (1 - y) STD*/
+		FastMatrix<T>& sigmoid_backward_inplace_std(const FastMatrix<T>& y) { return apply_combo_inplace_std([](T x1, T x2) { return x1 * (x2 * ((T)1 - x2)); }, y); }
 
 		/*ReLU֐ [hؑ*/
 		FastMatrix<T> relu() { return SWITCH_FAST_CONTAONER_FUNCTION(relu)(); }
 		/*ReLU֐*/
-		FastMatrix<T> relu_com() { return apply_com_func([](T x) { return x > 0 ? x : 0; }); }
+		FastMatrix<T> relu_com() { return apply_com_func(SIMD_RELU, [](T x) { return x > 0 ? x : (T)0; }); }
 		/*ReLU֐ AMP*/
-		FastMatrix<T> relu_amp() { return apply_amp_func([](T x) restrict(amp) { return x > 0 ? x : 0; }); }
+		FastMatrix<T> relu_amp() { return apply_amp_func([](T x) restrict(amp) { return x > 0 ? x : (T)0; }); }
 		/*ReLU֐ PPL*/
-		FastMatrix<T> relu_ppl() { return apply_ppl_func([](T x) { return x > 0 ? x : 0; }); }
+		FastMatrix<T> relu_ppl() { return apply_ppl_func(SIMD_RELU, [](T x) { return x > 0 ? x : (T)0; }); }
+		/*ReLU֐ STD*/
+		FastMatrix<T> relu_std() { return apply_std_func(SIMD_RELU, [](T x) { return x > 0 ? x : (T)0; }); }
 
 		/*K [hؑ*/
 		FastMatrix<T> normalization() { return SWITCH_FAST_CONTAONER_FUNCTION(normalization)(); }
@@ -156,6 +342,11 @@ namespace FastContainer {
 			T max = get_max();
 			return apply_ppl_func([=](T x) { return x / max; });
 		}
+		/*K STD*/
+		FastMatrix<T> normalization_std() {
+			T max = get_max();
+			return apply_std_func([=](T x) { return x / max; });
+		}
 
 		/*\tg}bNX֐ [hؑ*/
 		FastMatrix<T> softmax() { return SWITCH_FAST_CONTAONER_FUNCTION(softmax)(); }
@@ -163,19 +354,29 @@ namespace FastContainer {
 		FastMatrix<T> softmax_com() {
 			T max = get_max();
 			auto buf = apply_com_func([=](T x) { return std::exp(x - max); });
-			return buf.div_by_columns_com(buf.sum_by_rows_com());
+			auto sum = buf.sum_by_rows_com();
+			return buf.div_by_columns_com(sum);
 		}
 		/*\tg}bNX֐ AMP*/
 		FastMatrix<T> softmax_amp() {
 			T max = get_max();
 			auto buf = apply_amp_func([=](T x) restrict(amp) { return concurrency::fast_math::exp(x - max); });
-			return buf.div_by_columns_amp(buf.sum_by_rows_amp());
+			auto sum = buf.sum_by_rows_amp();
+			return buf.div_by_columns_amp(sum);
 		}
 		/*\tg}bNX֐ PPL*/
 		FastMatrix<T> softmax_ppl() {
 			T max = get_max();
 			auto buf = apply_ppl_func([=](T x) { return std::exp(x - max); });
-			return buf.div_by_columns_ppl(buf.sum_by_rows_ppl());
+			auto sum = buf.sum_by_rows_ppl();
+			return buf.div_by_columns_ppl(sum);
+		}
+		/*\tg}bNX֐ STD*/
+		FastMatrix<T> softmax_std() {
+			T max = get_max();
+			auto buf = apply_std_func([=](T x) { return std::exp(x - max); });
+			auto sum = buf.sum_by_rows_std();
+			return buf.div_by_columns_std(sum);
 		}
 
 		/*l [hؑ
@@ -194,6 +395,10 @@ namespace FastContainer {
 		func: (T)(*func)(T x)*/
 		template<class F>
 		FastMatrix<T> num_diff_ppl(F func, T delta = 0.0001) { return apply_ppl_func([=](T x) { return (func(x + delta) - func(x - delta)) / (2 * delta); }); }
+		/*l STD
+		func: (T)(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> num_diff_std(F func, T delta = 0.0001) { return apply_std_func([=](T x) { return (func(x + delta) - func(x - delta)) / (2 * delta); }); }
 
 		/*es֑ΏۂZ [hؑ*/
 		FastMatrix<T> add_by_rows(FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_FUNCTION(add_by_rows)(vec); }
@@ -203,6 +408,50 @@ namespace FastContainer {
 		FastMatrix<T> add_by_rows_amp(FastVector<T>& vec) { return apply_amp_combo_func_by_rows([](T x1, T x2) restrict(amp) {return x1 + x2; }, vec); }
 		/*es֑ΏۂZ PPL*/
 		FastMatrix<T> add_by_rows_ppl(FastVector<T>& vec) { return apply_ppl_combo_func_by_rows([](T x1, T x2) {return x1 + x2; }, vec); }
+		/*es֑ΏۂZ STD*/
+		FastMatrix<T> add_by_rows_std(FastVector<T>& vec) { return apply_std_combo_func_by_rows([](T x1, T x2) {return x1 + x2; }, vec); }
+
+		/*es֑ΏۂZď㏑ [hؑ*/
+		FastMatrix<T>& add_by_rows_inplace(FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_FUNCTION(add_by_rows_inplace)(vec); }
+		/*es֑ΏۂZď㏑*/
+		FastMatrix<T>& add_by_rows_inplace_com(FastVector<T>& vec) {
+			if (column_size != vec.get_size()) throw fast_container_exception();
+			for (int i = 0; i < row_size; i++) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; j++) entity[offset + j] += vec[j];
+			}
+			return *this;
+		}
+		/*es֑ΏۂZď㏑ AMP*/
+		FastMatrix<T>& add_by_rows_inplace_amp(FastVector<T>& vec) {
+			if (column_size != vec.get_size()) throw fast_container_exception();
+			if (size == 0) return *this;
+			concurrency::array_view<T, 2> av_entity(row_size, column_size, &entity[0]);
+			concurrency::array_view<const T, 1> av_vec(column_size, &vec[0]);
+			concurrency::parallel_for_each(av_entity.extent, [=](concurrency::index<2> idx) restrict(amp) {
+				av_entity[idx] += av_vec[idx[1]];
+			});
+			av_entity.synchronize();
+			return *this;
+		}
+		/*es֑ΏۂZď㏑ PPL*/
+		FastMatrix<T>& add_by_rows_inplace_ppl(FastVector<T>& vec) {
+			if (column_size != vec.get_size()) throw fast_container_exception();
+			concurrency::parallel_for<int>(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; j++) entity[offset + j] += vec[j];
+			});
+			return *this;
+		}
+		/*es֑ΏۂZď㏑ STD*/
+		FastMatrix<T>& add_by_rows_inplace_std(FastVector<T>& vec) {
+			if (column_size != vec.get_size()) throw fast_container_exception();
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; j++) entity[offset + j] += vec[j];
+			});
+			return *this;
+		}
 
 		/*e֑ΏۂZ [hؑ*/
 		FastMatrix<T> add_by_columns(FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_FUNCTION(add_by_columns)(vec); }
@@ -212,6 +461,8 @@ namespace FastContainer {
 		FastMatrix<T> add_by_columns_amp(FastVector<T>& vec) { return apply_amp_combo_func_by_columns([](T x1, T x2) restrict(amp) {return x1 + x2; }, vec); }
 		/*e֑ΏۂZ PPL*/
 		FastMatrix<T> add_by_columns_ppl(FastVector<T>& vec) { return apply_ppl_combo_func_by_columns([](T x1, T x2) {return x1 + x2; }, vec); }
+		/*e֑ΏۂZ STD*/
+		FastMatrix<T> add_by_columns_std(FastVector<T>& vec) { return apply_std_combo_func_by_columns([](T x1, T x2) {return x1 + x2; }, vec); }
 
 		/*esΏۂZ [hؑ*/
 		FastMatrix<T> sub_by_rows(FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_FUNCTION(sub_by_rows)(vec); }
@@ -221,6 +472,8 @@ namespace FastContainer {
 		FastMatrix<T> sub_by_rows_amp(FastVector<T>& vec) { return apply_amp_combo_func_by_rows([](T x1, T x2) restrict(amp) {return x1 - x2; }, vec); }
 		/*esΏۂZ PPL*/
 		FastMatrix<T> sub_by_rows_ppl(FastVector<T>& vec) { return apply_ppl_combo_func_by_rows([](T x1, T x2) {return x1 - x2; }, vec); }
+		/*esΏۂZ STD*/
+		FastMatrix<T> sub_by_rows_std(FastVector<T>& vec) { return apply_std_combo_func_by_rows([](T x1, T x2) {return x1 - x2; }, vec); }
 
 		/*e񂩂ΏۂZ [hؑ*/
 		FastMatrix<T> sub_by_columns(FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_FUNCTION(sub_by_columns)(vec); }
@@ -230,6 +483,8 @@ namespace FastContainer {
 		FastMatrix<T> sub_by_columns_amp(FastVector<T>& vec) { return apply_amp_combo_func_by_columns([](T x1, T x2) restrict(amp) {return x1 - x2; }, vec); }
 		/*e񂩂ΏۂZ PPL*/
 		FastMatrix<T> sub_by_columns_ppl(FastVector<T>& vec) { return apply_ppl_combo_func_by_columns([](T x1, T x2) {return x1 - x2; }, vec); }
+		/*e񂩂ΏۂZ STD*/
+		FastMatrix<T> sub_by_columns_std(FastVector<T>& vec) { return apply_std_combo_func_by_columns([](T x1, T x2) {return x1 - x2; }, vec); }
 
 		/*es֑ΏۂZ [hؑ*/
 		FastMatrix<T> mul_by_rows(FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_FUNCTION(mul_by_rows)(vec); }
@@ -239,6 +494,8 @@ namespace FastContainer {
 		FastMatrix<T> mul_by_rows_amp(FastVector<T>& vec) { return apply_amp_combo_func_by_rows([](T x1, T x2) restrict(amp) {return x1 * x2; }, vec); }
 		/*es֑ΏۂZ PPL*/
 		FastMatrix<T> mul_by_rows_ppl(FastVector<T>& vec) { return apply_ppl_combo_func_by_rows([](T x1, T x2) {return x1 * x2; }, vec); }
+		/*es֑ΏۂZ STD*/
+		FastMatrix<T> mul_by_rows_std(FastVector<T>& vec) { return apply_std_combo_func_by_rows([](T x1, T x2) {return x1 * x2; }, vec); }
 
 		/*e֑ΏۂZ [hؑ*/
 		FastMatrix<T> mul_by_columns(FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_FUNCTION(mul_by_columns)(vec); }
@@ -248,6 +505,8 @@ namespace FastContainer {
 		FastMatrix<T> mul_by_columns_amp(FastVector<T>& vec) { return apply_amp_combo_func_by_columns([](T x1, T x2) restrict(amp) {return x1 * x2; }, vec); }
 		/*e֑ΏۂZ PPL*/
 		FastMatrix<T> mul_by_columns_ppl(FastVector<T>& vec) { return apply_ppl_combo_func_by_columns([](T x1, T x2) {return x1 * x2; }, vec); }
+		/*e֑ΏۂZ STD*/
+		FastMatrix<T> mul_by_columns_std(FastVector<T>& vec) { return apply_std_combo_func_by_columns([](T x1, T x2) {return x1 * x2; }, vec); }
 
 		/*esΏۂZ [hؑ*/
 		FastMatrix<T> div_by_rows(FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_FUNCTION(div_by_rows)(vec); }
@@ -257,6 +516,8 @@ namespace FastContainer {
 		FastMatrix<T> div_by_rows_amp(FastVector<T>& vec) { return apply_amp_combo_func_by_rows([](T x1, T x2) restrict(amp) {return x1 / x2; }, vec); }
 		/*esΏۂZ PPL*/
 		FastMatrix<T> div_by_rows_ppl(FastVector<T>& vec) { return apply_ppl_combo_func_by_rows([](T x1, T x2) {return x1 / x2; }, vec); }
+		/*esΏۂZ STD*/
+		FastMatrix<T> div_by_rows_std(FastVector<T>& vec) { return apply_std_combo_func_by_rows([](T x1, T x2) {return x1 / x2; }, vec); }
 
 		/*e񂩂ΏۂZ [hؑ*/
 		FastMatrix<T> div_by_columns(FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_FUNCTION(div_by_columns)(vec); }
@@ -266,6 +527,8 @@ namespace FastContainer {
 		FastMatrix<T> div_by_columns_amp(FastVector<T>& vec) { return apply_amp_combo_func_by_columns([](T x1, T x2) restrict(amp) {return x1 / x2; }, vec); }
 		/*e񂩂ΏۂZ PPL*/
 		FastMatrix<T> div_by_columns_ppl(FastVector<T>& vec) { return apply_ppl_combo_func_by_columns([](T x1, T x2) {return x1 / x2; }, vec); }
+		/*e񂩂ΏۂZ STD*/
+		FastMatrix<T> div_by_columns_std(FastVector<T>& vec) { return apply_std_combo_func_by_columns([](T x1, T x2) {return x1 / x2; }, vec); }
 
 		/*Ggs[덷 [hؑ*/
 		T cross_entropy_error(FastMatrix<T>& teacher, T delta = 0.0000001) { return SWITCH_FAST_CONTAONER_FUNCTION(cross_entropy_error)(teacher, delta); }
@@ -284,6 +547,11 @@ namespace FastContainer {
 			auto buf = apply_ppl_combo_func([=](T x1, T x2) { return (T)-1 * x2 * std::log(x1 + delta) + (1 - x2) * std::log(1 - x1 + delta); }, teacher);
 			return buf.sum() / row_size;
 		}
+		/*Ggs[덷 STD*/
+		T cross_entropy_error_std(FastMatrix<T>& teacher, T delta = 0.0000001) {
+			auto buf = apply_std_combo_func([=](T x1, T x2) { return (T)-1 * x2 * std::log(x1 + delta) + (1 - x2) * std::log(1 - x1 + delta); }, teacher);
+			return buf.sum() / row_size;
+		}
 
 		/*Ggs[덷 ޖ [hؑ*/
 		T cross_entropy_error_class(FastMatrix<T>& teacher, T delta = 0.0000001) { return SWITCH_FAST_CONTAONER_FUNCTION(cross_entropy_error_class)(teacher, delta); }
@@ -302,41 +570,207 @@ namespace FastContainer {
 			auto buf = apply_ppl_combo_func([=](T x1, T x2) { return (T)-1 * x2 * std::log(x1 + delta); }, teacher);
 			return buf.sum() / row_size;
 		}
-
-		/*ŏl*/
-		T get_min() {
-			T result = entity[0];
-			for (auto x : entity) result = min(result, x);
-			return result;
-		}
-		/*ől*/
-		T get_max() {
-			T result = entity[0];
-			for (auto x : entity) result = max(result, x);
-			return result;
+		/*Ggs[덷 ޖ STD*/
+		T cross_entropy_error_class_std(FastMatrix<T>& teacher, T delta = 0.0000001) {
+			auto buf = apply_std_combo_func([=](T x1, T x2) { return (T)-1 * x2 * std::log(x1 + delta); }, teacher);
+			return buf.sum() / row_size;
 		}
-		/*ől̃CfbNX*/
-		T get_argmax() {
-			int result = 0;
-			int i = 0;
-			T max = entity[i];
-			for (auto x : entity) {
-				if (max < x) {
-					max = x;
-					result = i;
+
+		/*\tg}bNX֐ƌGgs[덷 ޖ sɂ܂Ƃ߂ČvZ [hؑ
+		teacher: tf[^, prob: \tg}bNX֐̏o͐, grad: 덷̌z (prob - teacher) * grad_scale / s ̏o͐
+		grad_scale: zɊ|{ (XP[O T֊ۂ߂OAccumulate<T>Ŋ|)
+		߂l: Ggs[덷 (log-sum-expŌvZ邽delta͕sv)*/
+		T softmax_cross_entropy(const FastMatrix<T>& teacher, FastMatrix<T>& prob, FastMatrix<T>& grad, Accumulate<T> grad_scale = 1) { return SWITCH_FAST_CONTAONER_FUNCTION(softmax_cross_entropy)(teacher, prob, grad, grad_scale); }
+		/*\tg}bNX֐ƌGgs[덷 ޖ*/
+		T softmax_cross_entropy_com(const FastMatrix<T>& teacher, FastMatrix<T>& prob, FastMatrix<T>& grad, Accumulate<T> grad_scale = 1) {
+			SerialExecutor exec;
+			return softmax_cross_entropy_rows(teacher, prob, grad, exec, grad_scale);
+		}
+		/*\tg}bNX֐ƌGgs[덷 ޖ AMP*/
+		T softmax_cross_entropy_amp(const FastMatrix<T>& teacher, FastMatrix<T>& prob, FastMatrix<T>& grad, Accumulate<T> grad_scale = 1) {
+			if (row_size != teacher.row_size) throw fast_container_exception();
+			if (column_size != teacher.column_size) throw fast_container_exception();
+			prob.resize(row_size, column_size);
+			grad.resize(row_size, column_size);
+			if (size == 0) return 0;
+			FastVector<T> loss(row_size);
+			concurrency::array_view<const T, 2> av_entity(row_size, column_size, &entity[0]);
+			concurrency::array_view<const T, 2> av_teacher(row_size, column_size, &teacher[0]);
+			concurrency::array_view<T, 2> av_prob(row_size, column_size, &prob[0]);
+			concurrency::array_view<T, 2> av_grad(row_size, column_size, &grad[0]);
+			concurrency::array_view<T, 1> av_loss(row_size, &loss[0]);
+			av_prob.discard_data();
+			av_grad.discard_data();
+			av_loss.discard_data();
+			int b_col = column_size;
+			T scale = (T)(grad_scale / row_size);
+			concurrency::parallel_for_each(av_loss.extent, [=](concurrency::index<1> idx) restrict(amp) {
+				int row = idx[0];
+				T max = av_entity[row][0];
+				for (int i = 1; i < b_col; i++) {
+					if (max < av_entity[row][i]) max = av_entity[row][i];
 				}
-				++i;
-			}
-			return result;
+				T sum = 0;
+				for (int i = 0; i < b_col; i++) {
+					T e = concurrency::fast_math::exp(av_entity[row][i] - max);
+					av_prob[row][i] = e;
+					sum += e;
+				}
+				T lse = max + concurrency::fast_math::log(sum);
+				T buf = 0;
+				for (int i = 0; i < b_col; i++) {
+					T t = av_teacher[row][i];
+					T p = av_prob[row][i] / sum;
+					buf += t * (lse - av_entity[row][i]);
+					av_prob[row][i] = p;
+					av_grad[row][i] = (p - t) * scale;
+				}
+				av_loss[idx] = buf;
+			});
+			av_prob.synchronize();
+			av_grad.synchronize();
+			av_loss.synchronize();
+			return loss.sum() / row_size;
+		}
+		/*\tg}bNX֐ƌGgs[덷 ޖ PPL*/
+		T softmax_cross_entropy_ppl(const FastMatrix<T>& teacher, FastMatrix<T>& prob, FastMatrix<T>& grad, Accumulate<T> grad_scale = 1) {
+			PplExecutor exec;
+			return softmax_cross_entropy_rows(teacher, prob, grad, exec, grad_scale);
+		}
+		/*\tg}bNX֐ƌGgs[덷 ޖ STD*/
+		T softmax_cross_entropy_std(const FastMatrix<T>& teacher, FastMatrix<T>& prob, FastMatrix<T>& grad, Accumulate<T> grad_scale = 1) { return softmax_cross_entropy_rows(teacher, prob, grad, ThreadPool::get_instance(), grad_scale); }
+		/*\tg}bNX֐ƌGgs[덷 ޖ sɕ
+		(1s͍őlAexp ƍvAKƌz3̑ŁA2ڈȍ~̓LbVōς)
+		exec: s*/
+		template<class E>
+		T softmax_cross_entropy_rows(const FastMatrix<T>& teacher, FastMatrix<T>& prob, FastMatrix<T>& grad, E& exec, Accumulate<T> grad_scale = 1) {
+			if (row_size != teacher.row_size) throw fast_container_exception();
+			if (column_size != teacher.column_size) throw fast_container_exception();
+			prob.resize(row_size, column_size);
+			grad.resize(row_size, column_size);
+			if (size == 0) return 0;
+			int block_num = std::min(row_size, exec.get_concurrency() * 4);
+			std::vector<Accumulate<T>> loss(block_num);
+			Accumulate<T> scale = grad_scale / row_size;
+			exec.parallel_for_range(0, block_num, [&](int block_begin, int block_end) {
+				for (int b = block_begin; b < block_end; b++) {
+					int row_begin = (int)((long long)row_size * b / block_num);
+					int row_end = (int)((long long)row_size * (b + 1) / block_num);
+					Accumulate<T> buf = 0;
+					for (int row = row_begin; row < row_end; row++) {
+						int offset = row * column_size;
+						const T *x = &entity[offset];
+						const T *t = &teacher.entity[offset];
+						T *p = &prob.entity[offset];
+						T *g = &grad.entity[offset];
+						Accumulate<T> max = x[0];
+						for (int i = 1; i < column_size; i++) max = std::max(max, (Accumulate<T>)x[i]);
+						Accumulate<T> sum = 0;
+						for (int i = 0; i < column_size; i++) {
+							Accumulate<T> e = std::exp(x[i] - max);
+							p[i] = e;
+							sum += e;
+						}
+						Accumulate<T> lse = max + std::log(sum);
+						Accumulate<T> inv = (Accumulate<T>)1 / sum;
+						for (int i = 0; i < column_size; i++) {
+							buf += t[i] * (lse - x[i]);
+							Accumulate<T> prob = p[i] * inv;
+							p[i] = prob;
+							g[i] = (prob - t[i]) * scale;
+						}
+					}
+					loss[b] = buf;
+				}
+			});
+			Accumulate<T> result = 0;
+			for (auto x : loss) result += x;
+			return (T)(result / row_size);
 		}
+
+		/*ŏl [hؑ*/
+		T get_min() const { return SWITCH_FAST_CONTAONER_FUNCTION(get_min)(); }
+		/*ŏl*/
+		T get_min_com() const {
+			SerialExecutor exec;
+			return reduce_min(get_data(), size, exec);
+		}
+		/*ŏl AMP (zXgŏWv)*/
+		T get_min_amp() const {
+			PplExecutor exec;
+			return reduce_min(get_data(), size, exec);
+		}
+		/*ŏl PPL*/
+		T get_min_ppl() const {
+			PplExecutor exec;
+			return reduce_min(get_data(), size, exec);
+		}
+		/*ŏl STD*/
+		T get_min_std() const { return reduce_min(get_data(), size, ThreadPool::get_instance()); }
+		/*ől [hؑ*/
+		T get_max() const { return SWITCH_FAST_CONTAONER_FUNCTION(get_max)(); }
+		/*ől*/
+		T get_max_com() const {
+			SerialExecutor exec;
+			return reduce_max(get_data(), size, exec);
+		}
+		/*ől AMP (zXgŏWv)*/
+		T get_max_amp() const {
+			PplExecutor exec;
+			return reduce_max(get_data(), size, exec);
+		}
+		/*ől PPL*/
+		T get_max_ppl() const {
+			PplExecutor exec;
+			return reduce_max(get_data(), size, exec);
+		}
+		/*ől STD*/
+		T get_max_std() const { return reduce_max(get_data(), size, ThreadPool::get_instance()); }
+		/*ől̃CfbNX (ől΍ŏ̂) [hؑ*/
+		int get_argmax() const { return SWITCH_FAST_CONTAONER_FUNCTION(get_argmax)(); }
+		/*ől̃CfbNX (ől΍ŏ̂)*/
+		int get_argmax_com() const {
+			SerialExecutor exec;
+			return reduce_argmax(get_data(), size, exec);
+		}
+		/*ől̃CfbNX (ől΍ŏ̂) AMP (zXgŏWv)*/
+		int get_argmax_amp() const {
+			PplExecutor exec;
+			return reduce_argmax(get_data(), size, exec);
+		}
+		/*ől̃CfbNX (ől΍ŏ̂) PPL*/
+		int get_argmax_ppl() const {
+			PplExecutor exec;
+			return reduce_argmax(get_data(), size, exec);
+		}
+		/*ől̃CfbNX (ől΍ŏ̂) STD*/
+		int get_argmax_std() const { return reduce_argmax(get_data(), size, ThreadPool::get_instance()); }
+		/*v [hؑ*/
+		T sum() const { return SWITCH_FAST_CONTAONER_FUNCTION(sum)(); }
 		/*v*/
-		T sum() {
-			T result = 0;
-			for (auto x : entity) result += x;
-			return result;
+		T sum_com() const {
+			SerialExecutor exec;
+			return reduce_sum(get_data(), size, exec);
+		}
+		/*v AMP (zXgŏWv)*/
+		T sum_amp() const {
+			PplExecutor exec;
+			return reduce_sum(get_data(), size, exec);
+		}
+		/*v PPL*/
+		T sum_ppl() const {
+			PplExecutor exec;
+			return reduce_sum(get_data(), size, exec);
+		}
+		/*v STD*/
+		T sum_std() const { return reduce_sum(get_data(), size, ThreadPool::get_instance()); }
+		/*␳t̍v (v̌vZ̐ݒɊ֌WȂKahan@)*/
+		T sum_kahan() const {
+			PplExecutor exec;
+			return reduce_sum(get_data(), size, exec, REDUCE_KAHAN);
 		}
 		/**/
-		T mean() {
+		T mean() const {
 			return sum() / size;
 		}
 
@@ -351,7 +785,7 @@ namespace FastContainer {
 				for (int j = 0; j < column_size; j++) {
 					T b_result = result[i];
 					T b_entity = entity[offset + j];
-					result[i] = min(b_result, b_entity);
+					result[i] = std::min(b_result, b_entity);
 				}
 			}
 			return result;
@@ -368,7 +802,7 @@ namespace FastContainer {
 				for (int i = 0; i < b_col; i++) {
 					T b_result = av_result[idx];
 					T b_entity = av_entity[idx[0]][i];
-					av_result[idx] = min(b_result, b_entity);
+					av_result[idx] = b_entity < b_result ? b_entity : b_result;
 				}
 			});
 			av_result.synchronize();
@@ -383,7 +817,21 @@ namespace FastContainer {
 				for (int j = 0; j < column_size; j++) {
 					T b_result = result[i];
 					T b_entity = entity[offset + j];
-					result[i] = min(b_result, b_entity);
+					result[i] = std::min(b_result, b_entity);
+				}
+			});
+			return result;
+		}
+		/*s̍ŏl STD*/
+		FastVector<T> min_by_rows_std() {
+			FastVector<T> result(row_size);
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				result[i] = entity[offset];
+				for (int j = 0; j < column_size; j++) {
+					T b_result = result[i];
+					T b_entity = entity[offset + j];
+					result[i] = std::min(b_result, b_entity);
 				}
 			});
 			return result;
@@ -399,7 +847,7 @@ namespace FastContainer {
 				for (int j = 0; j < row_size; j++) {
 					T b_result = result[i];
 					T b_entity = entity[j * column_size + i];
-					result[i] = min(b_result, b_entity);
+					result[i] = std::min(b_result, b_entity);
 				}
 			}
 			return result;
@@ -416,7 +864,7 @@ namespace FastContainer {
 				for (int i = 0; i < b_row; i++) {
 					T b_result = av_result[idx];
 					T b_entity = av_entity[i][idx[0]];
-					av_result[idx] = min(b_result, b_entity);
+					av_result[idx] = b_entity < b_result ? b_entity : b_result;
 				}
 			});
 			av_result.synchronize();
@@ -430,7 +878,20 @@ namespace FastContainer {
 				for (int j = 0; j < row_size; j++) {
 					T b_result = result[i];
 					T b_entity = entity[j * column_size + i];
-					result[i] = min(b_result, b_entity);
+					result[i] = std::min(b_result, b_entity);
+				}
+			});
+			return result;
+		}
+		/*񖈂̍ŏl STD*/
+		FastVector<T> min_by_columns_std() {
+			FastVector<T> result(column_size);
+			parallel_for(0, column_size, [&](int i) {
+				result[i] = entity[i];
+				for (int j = 0; j < row_size; j++) {
+					T b_result = result[i];
+					T b_entity = entity[j * column_size + i];
+					result[i] = std::min(b_result, b_entity);
 				}
 			});
 			return result;
@@ -447,7 +908,7 @@ namespace FastContainer {
 				for (int j = 0; j < column_size; j++) {
 					T b_result = result[i];
 					T b_entity = entity[offset + j];
-					result[i] = max(b_result, b_entity);
+					result[i] = std::max(b_result, b_entity);
 				}
 			}
 			return result;
@@ -464,7 +925,7 @@ namespace FastContainer {
 				for (int i = 0; i < b_col; i++) {
 					T b_result = av_result[idx];
 					T b_entity = av_entity[idx[0]][i];
-					av_result[idx] = max(b_result, b_entity);
+					av_result[idx] = b_result < b_entity ? b_entity : b_result;
 				}
 			});
 			av_result.synchronize();
@@ -479,7 +940,21 @@ namespace FastContainer {
 				for (int j = 0; j < column_size; j++) {
 					T b_result = result[i];
 					T b_entity = entity[offset + j];
-					result[i] = max(b_result, b_entity);
+					result[i] = std::max(b_result, b_entity);
+				}
+			});
+			return result;
+		}
+		/*s̍ől STD*/
+		FastVector<T> max_by_rows_std() {
+			FastVector<T> result(row_size);
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				result[i] = entity[offset];
+				for (int j = 0; j < column_size; j++) {
+					T b_result = result[i];
+					T b_entity = entity[offset + j];
+					result[i] = std::max(b_result, b_entity);
 				}
 			});
 			return result;
@@ -495,7 +970,7 @@ namespace FastContainer {
 				for (int j = 0; j < row_size; j++) {
 					T b_result = result[i];
 					T b_entity = entity[j * column_size + i];
-					result[i] = max(b_result, b_entity);
+					result[i] = std::max(b_result, b_entity);
 				}
 			}
 			return result;
@@ -512,7 +987,7 @@ namespace FastContainer {
 				for (int i = 0; i < b_row; i++) {
 					T b_result = av_result[idx];
 					T b_entity = av_entity[i][idx[0]];
-					av_result[idx] = max(b_result, b_entity);
+					av_result[idx] = b_result < b_entity ? b_entity : b_result;
 				}
 			});
 			av_result.synchronize();
@@ -526,17 +1001,30 @@ namespace FastContainer {
 				for (int j = 0; j < row_size; j++) {
 					T b_result = result[i];
 					T b_entity = entity[j * column_size + i];
-					result[i] = max(b_result, b_entity);
+					result[i] = std::max(b_result, b_entity);
+				}
+			});
+			return result;
+		}
+		/*񖈂̍ől STD*/
+		FastVector<T> max_by_columns_std() {
+			FastVector<T> result(column_size);
+			parallel_for(0, column_size, [&](int i) {
+				result[i] = entity[i];
+				for (int j = 0; j < row_size; j++) {
+					T b_result = result[i];
+					T b_entity = entity[j * column_size + i];
+					result[i] = std::max(b_result, b_entity);
 				}
 			});
 			return result;
 		}
 
 		/*s̍ől̃CfbNX [hؑ*/
-		FastVector<T> argmax_by_rows() { return SWITCH_FAST_CONTAONER_FUNCTION(argmax_by_rows)(); }
+		FastVector<int> argmax_by_rows() { return SWITCH_FAST_CONTAONER_FUNCTION(argmax_by_rows)(); }
 		/*s̍ől̃CfbNX*/
-		FastVector<T> argmax_by_rows_com() {
-			FastVector<T> result(row_size);
+		FastVector<int> argmax_by_rows_com() {
+			FastVector<int> result(row_size);
 			for (int i = 0; i < row_size; i++) {
 				int offset = i * column_size;
 				T max = entity[offset];
@@ -551,10 +1039,10 @@ namespace FastContainer {
 			return result;
 		}
 		/*s̍ől̃CfbNX AMP*/
-		FastVector<T> argmax_by_rows_amp() {
-			FastVector<T> result(row_size);
+		FastVector<int> argmax_by_rows_amp() {
+			FastVector<int> result(row_size);
 			concurrency::array_view<const T, 2> av_entity(row_size, column_size, &entity[0]);
-			concurrency::array_view<T, 1> av_result(row_size, &result[0]);
+			concurrency::array_view<int, 1> av_result(row_size, &result[0]);
 			int b_col = column_size;
 			av_result.discard_data();
 			concurrency::parallel_for_each(av_result.extent, [=](concurrency::index<1> idx) restrict(amp) {
@@ -572,8 +1060,8 @@ namespace FastContainer {
 			return result;
 		}
 		/*s̍ől̃CfbNX PPL*/
-		FastVector<T> argmax_by_rows_ppl() {
-			FastVector<T> result(row_size);
+		FastVector<int> argmax_by_rows_ppl() {
+			FastVector<int> result(row_size);
 			concurrency::parallel_for<int>(0, row_size, [&](int i) {
 				int offset = i * column_size;
 				T max = entity[offset];
@@ -587,12 +1075,28 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*s̍ől̃CfbNX STD*/
+		FastVector<int> argmax_by_rows_std() {
+			FastVector<int> result(row_size);
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				T max = entity[offset];
+				for (int j = 0; j < column_size; j++) {
+					T b_entity = entity[offset + j];
+					if (max < b_entity) {
+						max = b_entity;
+						result[i] = j;
+					}
+				}
+			});
+			return result;
+		}
 
 		/*񖈂̍ől̃CfbNX [hؑ*/
-		FastVector<T> argmax_by_columns() { return SWITCH_FAST_CONTAONER_FUNCTION(argmax_by_columns)(); }
+		FastVector<int> argmax_by_columns() { return SWITCH_FAST_CONTAONER_FUNCTION(argmax_by_columns)(); }
 		/*񖈂̍ől̃CfbNX*/
-		FastVector<T> argmax_by_columns_com() {
-			FastVector<T> result(column_size);
+		FastVector<int> argmax_by_columns_com() {
+			FastVector<int> result(column_size);
 			for (int i = 0; i < column_size; i++) {
 				T max = entity[i];
 				for (int j = 0; j < row_size; j++) {
@@ -606,10 +1110,10 @@ namespace FastContainer {
 			return result;
 		}
 		/*񖈂̍ől̃CfbNX AMP*/
-		FastVector<T> argmax_by_columns_amp() {
-			FastVector<T> result(column_size);
+		FastVector<int> argmax_by_columns_amp() {
+			FastVector<int> result(column_size);
 			concurrency::array_view<const T, 2> av_entity(row_size, column_size, &entity[0]);
-			concurrency::array_view<T, 1> av_result(column_size, &result[0]);
+			concurrency::array_view<int, 1> av_result(column_size, &result[0]);
 			int b_row = row_size;
 			av_result.discard_data();
 			concurrency::parallel_for_each(av_result.extent, [=](concurrency::index<1> idx) restrict(amp) {
@@ -627,8 +1131,8 @@ namespace FastContainer {
 			return result;
 		}
 		/*񖈂̍ől̃CfbNX PPL*/
-		FastVector<T> argmax_by_columns_ppl() {
-			FastVector<T> result(column_size);
+		FastVector<int> argmax_by_columns_ppl() {
+			FastVector<int> result(column_size);
 			concurrency::parallel_for<int>(0, column_size, [&](int i) {
 				T max = entity[i];
 				for (int j = 0; j < row_size; j++) {
@@ -641,6 +1145,21 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*񖈂̍ől̃CfbNX STD*/
+		FastVector<int> argmax_by_columns_std() {
+			FastVector<int> result(column_size);
+			parallel_for(0, column_size, [&](int i) {
+				T max = entity[i];
+				for (int j = 0; j < row_size; j++) {
+					T b_entity = entity[j * column_size + i];
+					if (max < b_entity) {
+						max = b_entity;
+						result[i] = j;
+					}
+				}
+			});
+			return result;
+		}
 
 		/*s̍v [hؑ*/
 		FastVector<T> sum_by_rows() { return SWITCH_FAST_CONTAONER_FUNCTION(sum_by_rows)(); }
@@ -682,22 +1201,63 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*s̍v STD*/
+		FastVector<T> sum_by_rows_std() {
+			FastVector<T> result(row_size);
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; j++) {
+					result[i] += entity[offset + j];
+				}
+			});
+			return result;
+		}
 
 		/*񖈂̍v [hؑ*/
 		FastVector<T> sum_by_columns() { return SWITCH_FAST_CONTAONER_FUNCTION(sum_by_columns)(); }
 		/*񖈂̍v*/
 		FastVector<T> sum_by_columns_com() {
-			FastVector<T> result(column_size);
+			FastVector<T> result;
+			sum_by_columns_to_com(result);
+			return result;
+		}
+		/*񖈂̍v AMP*/
+		FastVector<T> sum_by_columns_amp() {
+			FastVector<T> result;
+			sum_by_columns_to_amp(result);
+			return result;
+		}
+		/*񖈂̍v PPL*/
+		FastVector<T> sum_by_columns_ppl() {
+			FastVector<T> result;
+			sum_by_columns_to_ppl(result);
+			return result;
+		}
+		/*񖈂̍v STD*/
+		FastVector<T> sum_by_columns_std() {
+			FastVector<T> result;
+			sum_by_columns_to_std(result);
+			return result;
+		}
+
+		/*񖈂̍vo͐֏ [hؑ
+		result: o͐ (傫ႦΕύXA傫Ȃ̈ėp)*/
+		void sum_by_columns_to(FastVector<T>& result) { SWITCH_FAST_CONTAONER_FUNCTION(sum_by_columns_to)(result); }
+		/*񖈂̍vo͐֏*/
+		void sum_by_columns_to_com(FastVector<T>& result) {
+			result.resize(column_size);
 			for (int i = 0; i < column_size; i++) {
+				Accumulate<T> sum = 0;
 				for (int j = 0; j < row_size; j++) {
-					result[i] += entity[j * column_size + i];
+					sum += entity[j * column_size + i];
 				}
+				result[i] = sum;
 			}
-			return result;
 		}
-		/*񖈂̍v AMP*/
-		FastVector<T> sum_by_columns_amp() {
-			FastVector<T> result(column_size);
+		/*񖈂̍vo͐֏ AMP*/
+		void sum_by_columns_to_amp(FastVector<T>& result) {
+			result.resize(column_size);
+			if (column_size == 0) return;
 			concurrency::array_view<const T, 2> av_entity(row_size, column_size, &entity[0]);
 			concurrency::array_view<T, 1> av_result(column_size, &result[0]);
 			int b_row = row_size;
@@ -709,17 +1269,28 @@ namespace FastContainer {
 				}
 			});
 			av_result.synchronize();
-			return result;
 		}
-		/*񖈂̍v PPL*/
-		FastVector<T> sum_by_columns_ppl() {
-			FastVector<T> result(column_size);
+		/*񖈂̍vo͐֏ PPL*/
+		void sum_by_columns_to_ppl(FastVector<T>& result) {
+			result.resize(column_size);
 			concurrency::parallel_for<int>(0, column_size, [&](int i) {
+				Accumulate<T> sum = 0;
 				for (int j = 0; j < row_size; j++) {
-					result[i] += entity[j * column_size + i];
+					sum += entity[j * column_size + i];
 				}
+				result[i] = sum;
+			});
+		}
+		/*񖈂̍vo͐֏ STD*/
+		void sum_by_columns_to_std(FastVector<T>& result) {
+			result.resize(column_size);
+			parallel_for(0, column_size, [&](int i) {
+				Accumulate<T> sum = 0;
+				for (int j = 0; j < row_size; j++) {
+					sum += entity[j * column_size + i];
+				}
+				result[i] = sum;
 			});
-			return result;
 		}
 
 		/*s̕ [hؑ*/
@@ -765,6 +1336,18 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*s̕ STD*/
+		FastVector<T> mean_by_rows_std() {
+			FastVector<T> result(row_size);
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; j++) {
+					result[i] += entity[offset + j];
+				}
+				result[i] /= column_size;
+			});
+			return result;
+		}
 
 		/*񖈂̕ [hؑ*/
 		FastVector<T> mean_by_columns() { return SWITCH_FAST_CONTAONER_FUNCTION(mean_by_columns)(); }
@@ -807,75 +1390,356 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*񖈂̕ STD*/
+		FastVector<T> mean_by_columns_std() {
+			FastVector<T> result(column_size);
+			parallel_for(0, column_size, [&](int i) {
+				for (int j = 0; j < row_size; j++) {
+					result[i] += entity[j * column_size + i];
+				}
+				result[i] /= row_size;
+			});
+			return result;
+		}
 
 		/* [hؑ*/
 		FastMatrix<T> dot(FastMatrix<T>& mat) { return SWITCH_FAST_CONTAONER_FUNCTION(dot)(mat); }
+		/*r[Ƃ̓ [hؑ*/
+		FastMatrix<T> dot(const FastMatrixView<T>& mat) { return view().dot(mat); }
 		/**/
-		FastMatrix<T> dot_com(FastMatrix<T>& mat) {
-			if (column_size != mat.get_row_size()) throw fast_container_exception();
-			int mat_col = mat.get_column_size();
-			FastMatrix<T> result(row_size, mat_col);
-			for (int i = 0; i < row_size; i++) {
-				int res_offset = i * mat_col;
-				int ent_pos = i * column_size;
-				int mat_offset = 0;
-				for (int k = 0; k < column_size; k++, ent_pos++, mat_offset += mat_col) {
-					for (int j = 0; j < mat_col; j++) {
-						result[res_offset + j] += entity[ent_pos] * mat[mat_offset + j];
-					}
-				}
-			}
-			return result;
-		}
+		FastMatrix<T> dot_com(FastMatrix<T>& mat) { return dot_com(mat, false, false); }
 		/* AMP*/
-		FastMatrix<T> dot_amp(FastMatrix<T>& mat) {
-			if (column_size != mat.get_row_size()) throw fast_container_exception();
-			int col = mat.get_column_size();
-			int mid = column_size;
-			FastMatrix<T> result(row_size, col);
-			concurrency::array_view<const T, 2> av_entity(row_size, mid, &entity[0]);
-			concurrency::array_view<const T, 2> av_mat(mid, col, &mat[0]);
-			concurrency::array_view<T, 2> av_result(row_size, col, &result[0]);
+		FastMatrix<T> dot_amp(FastMatrix<T>& mat) { return dot_amp(mat, false, false); }
+		/* PPL*/
+		FastMatrix<T> dot_ppl(FastMatrix<T>& mat) { return dot_ppl(mat, false, false); }
+		/* STD*/
+		FastMatrix<T> dot_std(FastMatrix<T>& mat) { return dot_std(mat, false, false); }
+
+		/*]uw肵 [hؑ
+		reverse_this: g]uĊ|, reverse_mat: Ώۂ]uĊ|
+		(]us͍炸Ɍ̔zû܂ܓǂ)*/
+		FastMatrix<T> dot(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat) { return SWITCH_FAST_CONTAONER_FUNCTION(dot)(mat, reverse_this, reverse_mat); }
+		/*]uw肵*/
+		FastMatrix<T> dot_com(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat) {
+			SerialExecutor exec;
+			return dot_gemm(mat, reverse_this, reverse_mat, exec);
+		}
+		/*]uw肵 AMP*/
+		FastMatrix<T> dot_amp(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat) {
+			int row = reverse_this ? column_size : row_size;
+			int mid = reverse_this ? row_size : column_size;
+			int col = reverse_mat ? mat.get_row_size() : mat.get_column_size();
+			if (mid != (reverse_mat ? mat.get_column_size() : mat.get_row_size())) throw fast_container_exception();
+			FastMatrix<T> result(row, col);
+			concurrency::array_view<const T, 2> av_entity(row_size, column_size, &entity[0]);
+			concurrency::array_view<const T, 2> av_mat(mat.get_row_size(), mat.get_column_size(), &mat[0]);
+			concurrency::array_view<T, 2> av_result(row, col, &result[0]);
 			av_result.discard_data();
 			concurrency::parallel_for_each(av_result.extent, [=](concurrency::index<2> idx) restrict(amp) {
-				av_result[idx] = 0;
+				T sum = 0;
 				for (int i = 0; i < mid; i++) {
-					av_result[idx] += av_entity[idx[0]][i] * av_mat[i][idx[1]];
+					T x1 = reverse_this ? av_entity[i][idx[0]] : av_entity[idx[0]][i];
+					T x2 = reverse_mat ? av_mat[idx[1]][i] : av_mat[i][idx[1]];
+					sum += x1 * x2;
 				}
+				av_result[idx] = sum;
 			});
 			av_result.synchronize();
 			return result;
 		}
-		/* PPL*/
-		FastMatrix<T> dot_ppl(FastMatrix<T>& mat) {
-			if (column_size != mat.get_row_size()) throw fast_container_exception();
+		/*]uw肵 PPL*/
+		FastMatrix<T> dot_ppl(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat) {
+			PplExecutor exec;
+			return dot_gemm(mat, reverse_this, reverse_mat, exec);
+		}
+		/*]uw肵 STD*/
+		FastMatrix<T> dot_std(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat) { return dot_gemm(mat, reverse_this, reverse_mat, ThreadPool::get_instance()); }
+		/*]uw肵 ubNs
+		exec: s*/
+		template<class E>
+		FastMatrix<T> dot_gemm(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat, E& exec) {
+			FastMatrix<T> result;
+			dot_gemm_to(mat, reverse_this, reverse_mat, result, exec);
+			return result;
+		}
+
+		/*]uw肵ςo͐֏ [hؑ
+		result: o͐ (`ႦΕύXA`Ȃ̈ėp)*/
+		void dot_to(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat, FastMatrix<T>& result) { SWITCH_FAST_CONTAONER_FUNCTION(dot_to)(mat, reverse_this, reverse_mat, result); }
+		/*]uw肵ςo͐֏*/
+		void dot_to_com(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat, FastMatrix<T>& result) {
+			SerialExecutor exec;
+			dot_gemm_to(mat, reverse_this, reverse_mat, result, exec);
+		}
+		/*]uw肵ςo͐֏ AMP*/
+		void dot_to_amp(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat, FastMatrix<T>& result) { result = dot_amp(mat, reverse_this, reverse_mat); }
+		/*]uw肵ςo͐֏ PPL*/
+		void dot_to_ppl(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat, FastMatrix<T>& result) {
+			PplExecutor exec;
+			dot_gemm_to(mat, reverse_this, reverse_mat, result, exec);
+		}
+		/*]uw肵ςo͐֏ STD*/
+		void dot_to_std(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat, FastMatrix<T>& result) { dot_gemm_to(mat, reverse_this, reverse_mat, result, ThreadPool::get_instance()); }
+		/*]uw肵ςo͐֏ ubNs
+		exec: s*/
+		template<class E>
+		void dot_gemm_to(FastMatrix<T>& mat, bool reverse_this, bool reverse_mat, FastMatrix<T>& result, E& exec) {
+			int row = reverse_this ? column_size : row_size;
+			int mid = reverse_this ? row_size : column_size;
+			int col = reverse_mat ? mat.get_row_size() : mat.get_column_size();
+			if (mid != (reverse_mat ? mat.get_column_size() : mat.get_row_size())) throw fast_container_exception();
+			if (&result == this || &result == &mat) throw fast_container_exception();
+			if (result.row_size != row || result.column_size != col) result.resize(row, col);
+			if (result.size == 0) return;
+			if (mid == 0) {
+				std::fill(result.entity.begin(), result.entity.end(), (T)0);
+				return;
+			}
 			int mat_col = mat.get_column_size();
-			FastMatrix<T> result(row_size, mat_col);
-			concurrency::parallel_for<int>(0, row_size, [&](int i) {
-				int res_offset = i * mat_col;
-				int ent_pos = i * column_size;
-				int mat_offset = 0;
-				for (int k = 0; k < column_size; k++, ent_pos++, mat_offset += mat_col) {
-					for (int j = 0; j < mat_col; j++) {
-						result[res_offset + j] += entity[ent_pos] * mat[mat_offset + j];
-					}
+			gemm(row, col, mid,
+				&entity[0], reverse_this ? 1 : column_size, reverse_this ? column_size : 1,
+				&mat[0], reverse_mat ? 1 : mat_col, reverse_mat ? mat_col : 1,
+				&result[0], col, exec);
+		}
+
+		/*
+		ςɃoCAX̉ZƊ֐𑱂ČvZAo͐֏ [hؑ
+		(sς̃Gs[OƂďo̓^CɓKp̂ŁAo͂1񂾂)
+		bias: esɑxNg (͏o̗͂)
+		activation: ֐
+		result: o͐ (`ႦΕύXA`Ȃ̈ėp)
+		mask: nullptrłȂΊ̏o̗͂vf̃rbg1AȊO0ɂ (ReLŰt`dp `ႦΕύX)
+		*/
+		void dot_activation_to(FastMatrix<T>& mat, const FastVector<T>& bias, GemmActivation activation, FastMatrix<T>& result, FastBitMask *mask = nullptr) { SWITCH_FAST_CONTAONER_FUNCTION(dot_activation_to)(mat, bias, activation, result, mask); }
+		/*ςɃoCAX̉ZƊ֐𑱂ČvZAo͐֏*/
+		void dot_activation_to_com(FastMatrix<T>& mat, const FastVector<T>& bias, GemmActivation activation, FastMatrix<T>& result, FastBitMask *mask = nullptr) {
+			SerialExecutor exec;
+			dot_activation_to(mat, bias, activation, result, mask, exec);
+		}
+		/*ςɃoCAX̉ZƊ֐𑱂ČvZAo͐֏ AMP (zXgŌvZ)*/
+		void dot_activation_to_amp(FastMatrix<T>& mat, const FastVector<T>& bias, GemmActivation activation, FastMatrix<T>& result, FastBitMask *mask = nullptr) {
+			PplExecutor exec;
+			dot_activation_to(mat, bias, activation, result, mask, exec);
+		}
+		/*ςɃoCAX̉ZƊ֐𑱂ČvZAo͐֏ PPL*/
+		void dot_activation_to_ppl(FastMatrix<T>& mat, const FastVector<T>& bias, GemmActivation activation, FastMatrix<T>& result, FastBitMask *mask = nullptr) {
+			PplExecutor exec;
+			dot_activation_to(mat, bias, activation, result, mask, exec);
+		}
+		/*ςɃoCAX̉ZƊ֐𑱂ČvZAo͐֏ STD*/
+		void dot_activation_to_std(FastMatrix<T>& mat, const FastVector<T>& bias, GemmActivation activation, FastMatrix<T>& result, FastBitMask *mask = nullptr) {
+			dot_activation_to(mat, bias, activation, result, mask, ThreadPool::get_instance());
+		}
+		/*ςɃoCAX̉ZƊ֐𑱂ČvZAo͐֏
+		exec: s*/
+		template<class E>
+		void dot_activation_to(FastMatrix<T>& mat, const FastVector<T>& bias, GemmActivation activation, FastMatrix<T>& result, FastBitMask *mask, E& exec) {
+			int col = mat.get_column_size();
+			if (column_size != mat.get_row_size()) throw fast_container_exception();
+			if (bias.get_size() != col) throw fast_container_exception();
+			if (&result == this || &result == &mat) throw fast_container_exception();
+			if (result.row_size != row_size || result.column_size != col) result.resize(row_size, col);
+			if (mask != nullptr && (mask->get_row_size() != row_size || mask->get_column_size() != col)) mask->resize(row_size, col);
+			if (result.size == 0) return;
+			GemmEpilogue<T> epilogue;
+			epilogue.bias = bias.get_data();
+			epilogue.activation = activation;
+			if (mask != nullptr) {
+				epilogue.mask = mask->get_data();
+				epilogue.ldm = mask->get_words_per_row();
+			}
+			gemm(row_size, col, column_size, get_data(), column_size, 1, mat.get_data(), col, 1, result.get_data(), col, epilogue, exec);
+		}
+
+		/*
+		Leaky ReLU result = x > 0 ? x : slope * x vZAx > 0 ̗vf̃rbgmask֏ [hؑ
+		(o͂ƃ}XN1̑ŏ slope = 0 ȂReLU)
+		result: o͐ (gł悢 `ႦΕύX)
+		mask: t`dp̃}XN (`ႦΕύX)
+		*/
+		void leaky_relu_mask_to(FastMatrix<T>& result, FastBitMask& mask, T slope = 0) { SWITCH_FAST_CONTAONER_FUNCTION(leaky_relu_mask_to)(result, mask, slope); }
+		/*Leaky ReLU vZă}XN*/
+		void leaky_relu_mask_to_com(FastMatrix<T>& result, FastBitMask& mask, T slope = 0) {
+			SerialExecutor exec;
+			leaky_relu_mask_to(result, mask, slope, exec);
+		}
+		/*Leaky ReLU vZă}XN AMP (zXgŌvZ)*/
+		void leaky_relu_mask_to_amp(FastMatrix<T>& result, FastBitMask& mask, T slope = 0) {
+			PplExecutor exec;
+			leaky_relu_mask_to(result, mask, slope, exec);
+		}
+		/*Leaky ReLU vZă}XN PPL*/
+		void leaky_relu_mask_to_ppl(FastMatrix<T>& result, FastBitMask& mask, T slope = 0) {
+			PplExecutor exec;
+			leaky_relu_mask_to(result, mask, slope, exec);
+		}
+		/*Leaky ReLU vZă}XN STD*/
+		void leaky_relu_mask_to_std(FastMatrix<T>& result, FastBitMask& mask, T slope = 0) { leaky_relu_mask_to(result, mask, slope, ThreadPool::get_instance()); }
+		/*Leaky ReLU vZă}XN
+		exec: s*/
+		template<class E>
+		void leaky_relu_mask_to(FastMatrix<T>& result, FastBitMask& mask, T slope, E& exec) {
+			leaky_relu_mask_rows(result, mask, nullptr, slope, exec);
+		}
+		/*vf̌X slopes (gƓ`)  Leaky ReLU vZă}XN (RReLUp) [hؑ*/
+		void leaky_relu_mask_to(FastMatrix<T>& result, FastBitMask& mask, const FastMatrix<T>& slopes) { SWITCH_FAST_CONTAONER_FUNCTION(leaky_relu_mask_to)(result, mask, slopes); }
+		/*vf̌X Leaky ReLU vZă}XN*/
+		void leaky_relu_mask_to_com(FastMatrix<T>& result, FastBitMask& mask, const FastMatrix<T>& slopes) {
+			SerialExecutor exec;
+			leaky_relu_mask_to(result, mask, slopes, exec);
+		}
+		/*vf̌X Leaky ReLU vZă}XN AMP (zXgŌvZ)*/
+		void leaky_relu_mask_to_amp(FastMatrix<T>& result, FastBitMask& mask, const FastMatrix<T>& slopes) {
+			PplExecutor exec;
+			leaky_relu_mask_to(result, mask, slopes, exec);
+		}
+		/*vf̌X Leaky ReLU vZă}XN PPL*/
+		void leaky_relu_mask_to_ppl(FastMatrix<T>& result, FastBitMask& mask, const FastMatrix<T>& slopes) {
+			PplExecutor exec;
+			leaky_relu_mask_to(result, mask, slopes, exec);
+		}
+		/*vf̌X Leaky ReLU vZă}XN STD*/
+		void leaky_relu_mask_to_std(FastMatrix<T>& result, FastBitMask& mask, const FastMatrix<T>& slopes) { leaky_relu_mask_to(result, mask, slopes, ThreadPool::get_instance()); }
+		/*vf̌X Leaky ReLU vZă}XN
+		exec: s*/
+		template<class E>
+		void leaky_relu_mask_to(FastMatrix<T>& result, FastBitMask& mask, const FastMatrix<T>& slopes, E& exec) {
+			if (slopes.row_size != row_size || slopes.column_size != column_size) throw fast_container_exception();
+			leaky_relu_mask_rows(result, mask, slopes.get_data(), (T)0, exec);
+		}
+		/*
+		Leaky ReLU ̋t`d result = }XÑrbg1Ȃ玩gA0Ȃ slope * g [hؑ
+		mask: leaky_relu_mask_to() ŏ񂾃}XN (gƓ`)
+		result: o͐ (gł悢 `ႦΕύX)
+		*/
+		void leaky_relu_backward_to(const FastBitMask& mask, FastMatrix<T>& result, T slope = 0) { SWITCH_FAST_CONTAONER_FUNCTION(leaky_relu_backward_to)(mask, result, slope); }
+		/*Leaky ReLU ̋t`d*/
+		void leaky_relu_backward_to_com(const FastBitMask& mask, FastMatrix<T>& result, T slope = 0) {
+			SerialExecutor exec;
+			leaky_relu_backward_to(mask, result, slope, exec);
+		}
+		/*Leaky ReLU ̋t`d AMP (zXgŌvZ)*/
+		void leaky_relu_backward_to_amp(const FastBitMask& mask, FastMatrix<T>& result, T slope = 0) {
+			PplExecutor exec;
+			leaky_relu_backward_to(mask, result, slope, exec);
+		}
+		/*Leaky ReLU ̋t`d PPL*/
+		void leaky_relu_backward_to_ppl(const FastBitMask& mask, FastMatrix<T>& result, T slope = 0) {
+			PplExecutor exec;
+			leaky_relu_backward_to(mask, result, slope, exec);
+		}
+		/*Leaky ReLU ̋t`d STD*/
+		void leaky_relu_backward_to_std(const FastBitMask& mask, FastMatrix<T>& result, T slope = 0) { leaky_relu_backward_to(mask, result, slope, ThreadPool::get_instance()); }
+		/*Leaky ReLU ̋t`d
+		exec: s*/
+		template<class E>
+		void leaky_relu_backward_to(const FastBitMask& mask, FastMatrix<T>& result, T slope, E& exec) {
+			leaky_relu_backward_rows(mask, result, nullptr, slope, exec);
+		}
+		/*vf̌X slopes (`dƓl)  Leaky ReLU ̋t`dvZ (RReLUp) [hؑ*/
+		void leaky_relu_backward_to(const FastBitMask& mask, FastMatrix<T>& result, const FastMatrix<T>& slopes) { SWITCH_FAST_CONTAONER_FUNCTION(leaky_relu_backward_to)(mask, result, slopes); }
+		/*vf̌X Leaky ReLU ̋t`dvZ*/
+		void leaky_relu_backward_to_com(const FastBitMask& mask, FastMatrix<T>& result, const FastMatrix<T>& slopes) {
+			SerialExecutor exec;
+			leaky_relu_backward_to(mask, result, slopes, exec);
+		}
+		/*vf̌X Leaky ReLU ̋t`dvZ AMP (zXgŌvZ)*/
+		void leaky_relu_backward_to_amp(const FastBitMask& mask, FastMatrix<T>& result, const FastMatrix<T>& slopes) {
+			PplExecutor exec;
+			leaky_relu_backward_to(mask, result, slopes, exec);
+		}
+		/*vf̌X Leaky ReLU ̋t`dvZ PPL*/
+		void leaky_relu_backward_to_ppl(const FastBitMask& mask, FastMatrix<T>& result, const FastMatrix<T>& slopes) {
+			PplExecutor exec;
+			leaky_relu_backward_to(mask, result, slopes, exec);
+		}
+		/*vf̌X Leaky ReLU ̋t`dvZ STD*/
+		void leaky_relu_backward_to_std(const FastBitMask& mask, FastMatrix<T>& result, const FastMatrix<T>& slopes) { leaky_relu_backward_to(mask, result, slopes, ThreadPool::get_instance()); }
+		/*vf̌X Leaky ReLU ̋t`dvZ
+		exec: s*/
+		template<class E>
+		void leaky_relu_backward_to(const FastBitMask& mask, FastMatrix<T>& result, const FastMatrix<T>& slopes, E& exec) {
+			if (slopes.row_size != row_size || slopes.column_size != column_size) throw fast_container_exception();
+			leaky_relu_backward_rows(mask, result, slopes.get_data(), (T)0, exec);
+		}
+
+		/*
+		sς܂Ƃ߂ČvZ results[i] = mats1[i]Emats2[i] (reverse1, reverse2 ͓]uĊ|)
+		ȍsς͑S1̕񃋁[vŐU蕪̂ŁA1 dot() 葬
+		*/
+		static void dot_batched(const std::vector<FastMatrix<T>>& mats1, const std::vector<FastMatrix<T>>& mats2, std::vector<FastMatrix<T>>& results, bool reverse1 = false, bool reverse2 = false) {
+			dot_batched(mats1, mats2, results, reverse1, reverse2, ThreadPool::get_instance());
+		}
+		/*sς܂Ƃ߂ČvZ
+		exec: s*/
+		template<class E>
+		static void dot_batched(const std::vector<FastMatrix<T>>& mats1, const std::vector<FastMatrix<T>>& mats2, std::vector<FastMatrix<T>>& results, bool reverse1, bool reverse2, E& exec) {
+			if (mats1.size() != mats2.size()) throw fast_container_exception();
+			if (&results == &mats1 || &results == &mats2) throw fast_container_exception();
+			int count = (int)mats1.size();
+			if ((int)results.size() != count) results.resize(count);
+			std::vector<GemmBatchItem<T>> items;
+			items.reserve(count);
+			for (int i = 0; i < count; i++) {
+				const FastMatrix<T>& x1 = mats1[i];
+				const FastMatrix<T>& x2 = mats2[i];
+				FastMatrix<T>& y = results[i];
+				int row = reverse1 ? x1.column_size : x1.row_size;
+				int mid = reverse1 ? x1.row_size : x1.column_size;
+				int col = reverse2 ? x2.row_size : x2.column_size;
+				if (mid != (reverse2 ? x2.column_size : x2.row_size)) throw fast_container_exception();
+				if (y.row_size != row || y.column_size != col) y.resize(row, col);
+				if (y.size == 0) continue;
+				if (mid == 0) {
+					std::fill(y.entity.begin(), y.entity.end(), (T)0);
+					continue;
 				}
-			});
-			return result;
+				items.push_back(GemmBatchItem<T>{ row, col, mid,
+					x1.get_data(), reverse1 ? 1 : x1.column_size, reverse1 ? x1.column_size : 1,
+					x2.get_data(), reverse2 ? 1 : x2.column_size, reverse2 ? x2.column_size : 1,
+					y.get_data(), col });
+			}
+			gemm_batched(items.data(), (int)items.size(), exec);
+		}
+
+		/*
+		cɐς񂾍s̍sς܂Ƃ߂ČvZ
+		this: batch m x k cɐς (batch * m) x k
+		mat: batch k x n cɐς (batch * k) x n
+		߂l: batch m x n cɐς (batch * m) x n
+		*/
+		FastMatrix<T> dot_batched(const FastMatrix<T>& mat, int batch) const {
+			FastMatrix<T> result;
+			dot_batched_to(mat, batch, result);
+			return result;
+		}
+		/*cɐς񂾍s̍sς܂Ƃ߂ČvZAresult֏ (`Ⴆresult̑傫ς)*/
+		void dot_batched_to(const FastMatrix<T>& mat, int batch, FastMatrix<T>& result) const { dot_batched_to(mat, batch, result, ThreadPool::get_instance()); }
+		/*cɐς񂾍s̍sς܂Ƃ߂ČvZAresult֏
+		exec: s*/
+		template<class E>
+		void dot_batched_to(const FastMatrix<T>& mat, int batch, FastMatrix<T>& result, E& exec) const {
+			if (batch <= 0 || row_size % batch != 0 || mat.row_size % batch != 0) throw fast_container_exception();
+			int m = row_size / batch;
+			int k = column_size;
+			int n = mat.column_size;
+			if (mat.row_size / batch != k) throw fast_container_exception();
+			if (&result == this || &result == &mat) throw fast_container_exception();
+			if (result.row_size != row_size || result.column_size != n) result.resize(row_size, n);
+			if (result.size == 0) return;
+			if (k == 0) {
+				std::fill(result.entity.begin(), result.entity.end(), (T)0);
+				return;
+			}
+			gemm_strided_batched(batch, m, n, k, get_data(), k, 1, (size_t)m * k, mat.get_data(), n, 1, (size_t)k * n, result.get_data(), n, (size_t)m * n, exec);
 		}
 
 		/*]us [hؑ*/
 		FastMatrix<T> reverse() { return SWITCH_FAST_CONTAONER_FUNCTION(reverse)(); }
 		/*]us*/
 		FastMatrix<T> reverse_com() {
-			FastMatrix<T> result(column_size, row_size);
-			for (int i = 0; i < row_size; i++) {
-				int offset = i * column_size;
-				for (int j = 0; j < column_size; j++) {
-					result(j, i) = entity[offset + j];
-				}
-			}
-			return result;
+			SerialExecutor exec;
+			return reverse_tiled(exec);
 		}
 		/*]us AMP*/
 		FastMatrix<T> reverse_amp() {
@@ -891,11 +1755,50 @@ namespace FastContainer {
 		}
 		/*]us PPL*/
 		FastMatrix<T> reverse_ppl() {
+			PplExecutor exec;
+			return reverse_tiled(exec);
+		}
+		/*]us STD*/
+		FastMatrix<T> reverse_std() { return reverse_tiled(ThreadPool::get_instance()); }
+		/*]us ^C
+		exec: s*/
+		template<class E>
+		FastMatrix<T> reverse_tiled(E& exec) const {
 			FastMatrix<T> result(column_size, row_size);
-			concurrency::parallel_for<int>(0, size, [&](int i) {
-				result[i] = entity[(i % row_size) * column_size + i / row_size];
-			});
-			return result;
+			if (size == 0) return result;
+			transpose(row_size, column_size, &entity[0], column_size, &result[0], row_size, exec);
+			return result;
+		}
+
+		/*]uď㏑ [hؑ*/
+		FastMatrix<T>& reverse_inplace() { return SWITCH_FAST_CONTAONER_FUNCTION(reverse_inplace)(); }
+		/*]uď㏑*/
+		FastMatrix<T>& reverse_inplace_com() {
+			SerialExecutor exec;
+			return reverse_inplace_tiled(exec);
+		}
+		/*]uď㏑ AMP*/
+		FastMatrix<T>& reverse_inplace_amp() {
+			*this = reverse_amp();
+			return *this;
+		}
+		/*]uď㏑ PPL*/
+		FastMatrix<T>& reverse_inplace_ppl() {
+			PplExecutor exec;
+			return reverse_inplace_tiled(exec);
+		}
+		/*]uď㏑ STD*/
+		FastMatrix<T>& reverse_inplace_std() { return reverse_inplace_tiled(ThreadPool::get_instance()); }
+		/*]uď㏑ ^C (s͍Ɨ̈g킸Ɍ)
+		exec: s*/
+		template<class E>
+		FastMatrix<T>& reverse_inplace_tiled(E& exec) {
+			if (row_size == column_size) {
+				if (size != 0) transpose_inplace(row_size, &entity[0], column_size, exec);
+				return *this;
+			}
+			*this = reverse_tiled(exec);
+			return *this;
 		}
 
 		/*ws擾 [hؑ*/
@@ -931,6 +1834,15 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*ws擾 STD*/
+		FastVector<T> row_std(int row) {
+			if (row > row_size) throw fast_container_exception();
+			FastVector<T> result(column_size);
+			parallel_for(0, column_size, [&](int i) {
+				result[i] = entity[row * column_size + i];
+			});
+			return result;
+		}
 
 		/*w擾 [hؑ*/
 		FastVector<T> column(int col) { return SWITCH_FAST_CONTAONER_FUNCTION(column)(col); }
@@ -965,6 +1877,15 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*w擾 STD*/
+		FastVector<T> column_std(int col) {
+			if (col > column_size) throw fast_container_exception();
+			FastVector<T> result(row_size);
+			parallel_for(0, row_size, [&](int i) {
+				result[i] = entity[i * column_size + col];
+			});
+			return result;
+		}
 
 		/*s[0]`[row]܂ł擾 [hؑ*/
 		FastMatrix<T> take_rows(int row) { return SWITCH_FAST_CONTAONER_FUNCTION(take_rows)(row); }
@@ -1002,6 +1923,16 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*s[0]`[row]܂ł擾 STD*/
+		FastMatrix<T> take_rows_std(int row) {
+			if (row > row_size) throw fast_container_exception();
+			int res_size = row * column_size;
+			FastMatrix<T> result(row, column_size);
+			parallel_for(0, res_size, [&](int i) {
+				result[i] = entity[i];
+			});
+			return result;
+		}
 
 		/*s[row]`[end]܂ł擾 [hؑ*/
 		FastMatrix<T> skip_rows(int row) { return SWITCH_FAST_CONTAONER_FUNCTION(skip_rows)(row); }
@@ -1045,6 +1976,18 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*s[row]`[end]܂ł擾 STD*/
+		FastMatrix<T> skip_rows_std(int row) {
+			if (row >= row_size) throw fast_container_exception();
+			int res_row = row_size - row;
+			int res_size = res_row * column_size;
+			int skip_size = row * column_size;
+			FastMatrix<T> result(res_row, column_size);
+			parallel_for(0, res_size, [&](int i) {
+				result[i] = entity[skip_size + i];
+			});
+			return result;
+		}
 
 		/*[0]`[col]܂ł擾 [hؑ*/
 		FastMatrix<T> take_columns(int col) { return SWITCH_FAST_CONTAONER_FUNCTION(take_columns)(col); }
@@ -1087,13 +2030,26 @@ namespace FastContainer {
 			});
 			return result;
 		}
-
-		/*[col]`[end]܂ł擾 [hؑ*/
-		FastMatrix<T> skip_columns(int col) { return SWITCH_FAST_CONTAONER_FUNCTION(skip_columns)(col); }
-		/*[col]`[end]܂ł擾*/
-		FastMatrix<T> skip_columns_com(int col) {
-			if (col >= column_size) throw fast_container_exception();
-			int res_col = column_size - col;
+		/*[0]`[col]܂ł擾 STD*/
+		FastMatrix<T> take_columns_std(int col) {
+			if (col > column_size) throw fast_container_exception();
+			FastMatrix<T> result(row_size, col);
+			parallel_for(0, row_size, [&](int i) {
+				int res_offset = i * col;
+				int ent_offset = i * column_size;
+				for (int j = 0; j < col; j++) {
+					result[res_offset + j] = entity[ent_offset + j];
+				}
+			});
+			return result;
+		}
+
+		/*[col]`[end]܂ł擾 [hؑ*/
+		FastMatrix<T> skip_columns(int col) { return SWITCH_FAST_CONTAONER_FUNCTION(skip_columns)(col); }
+		/*[col]`[end]܂ł擾*/
+		FastMatrix<T> skip_columns_com(int col) {
+			if (col >= column_size) throw fast_container_exception();
+			int res_col = column_size - col;
 			FastMatrix<T> result(row_size, res_col);
 			for (int i = 0; i < row_size; i++) {
 				int res_offset = i * res_col;
@@ -1132,6 +2088,20 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*[col]`[end]܂ł擾 STD*/
+		FastMatrix<T> skip_columns_std(int col) {
+			if (col >= column_size) throw fast_container_exception();
+			int res_col = column_size - col;
+			FastMatrix<T> result(row_size, res_col);
+			parallel_for(0, row_size, [&](int i) {
+				int res_offset = i * res_col;
+				int ent_offset = i * column_size + col;
+				for (int j = 0; j < res_col; j++) {
+					result[res_offset + j] = entity[ent_offset + j];
+				}
+			});
+			return result;
+		}
 
 		/*ob`̎擾 [hؑ*/
 		FastMatrix<T> batch(FastVector<int>& mask) { return SWITCH_FAST_CONTAONER_FUNCTION(batch)(mask); }
@@ -1175,20 +2145,45 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*ob`̎擾 STD*/
+		FastMatrix<T> batch_std(FastVector<int>& mask) {
+			if (row_size < mask.get_size()) throw fast_container_exception();
+			int row = mask.get_size();
+			int res_size = row * column_size;
+			FastMatrix<T> result(row, column_size);
+			parallel_for(0, res_size, [&](int i) {
+				result[i] = entity[mask[i / column_size] * column_size + (i % column_size)];
+			});
+			return result;
+		}
 
 		/*_ȃob`̎擾 [hؑ*/
 		FastMatrix<T> random_batch(int size) { return SWITCH_FAST_CONTAONER_FUNCTION(random_batch)(size); }
 		/*_ȃob`̎擾*/
-		FastMatrix<T> random_batch_com(int size) { return batch_com(FastVector<int>::int_hash_random(size, 0, row_size - 1)); }
+		FastMatrix<T> random_batch_com(int size) {
+			auto mask = FastVector<int>::int_hash_random(size, 0, row_size - 1);
+			return batch_com(mask);
+		}
 		/*_ȃob`̎擾 AMP*/
-		FastMatrix<T> random_batch_amp(int size) { return batch_amp(FastVector<int>::int_hash_random(size, 0, row_size - 1)); }
+		FastMatrix<T> random_batch_amp(int size) {
+			auto mask = FastVector<int>::int_hash_random(size, 0, row_size - 1);
+			return batch_amp(mask);
+		}
 		/*_ȃob`̎擾 PPL*/
-		FastMatrix<T> random_batch_ppl(int size) { return batch_ppl(FastVector<int>::int_hash_random(size, 0, row_size - 1)); }
+		FastMatrix<T> random_batch_ppl(int size) {
+			auto mask = FastVector<int>::int_hash_random(size, 0, row_size - 1);
+			return batch_ppl(mask);
+		}
+		/*_ȃob`̎擾 STD*/
+		FastMatrix<T> random_batch_std(int size) {
+			auto mask = FastVector<int>::int_hash_random(size, 0, row_size - 1);
+			return batch_std(mask);
+		}
 
 		/*֐Kp
 		func: T(*func)(T x)*/
 		template<class F>
-		FastMatrix<T> apply_com_func(F func) {
+		FastMatrix<T> apply_com_func(F func) const {
 			FastMatrix<T> result(row_size, column_size);
 			auto ent_itr = entity.begin();
 			for (auto&& y : result.entity) {
@@ -1200,7 +2195,7 @@ namespace FastContainer {
 		/*֐Kp AMP
 		func: T(*func)(T x) restrict(amp)*/
 		template<class F>
-		FastMatrix<T> apply_amp_func(F func) {
+		FastMatrix<T> apply_amp_func(F func) const {
 			FastMatrix<T> result(row_size, column_size);
 			concurrency::array_view<const T, 1> av_entity(size, &entity[0]);
 			concurrency::array_view<T, 1> av_result(size, &result[0]);
@@ -1214,7 +2209,7 @@ namespace FastContainer {
 		/*֐Kp PPL
 		func: T(*func)(T x)*/
 		template<class F>
-		FastMatrix<T> apply_ppl_func(F func) {
+		FastMatrix<T> apply_ppl_func(F func) const {
 			FastMatrix<T> result(row_size, column_size);
 			concurrency::parallel_for<int>(0, row_size, [&](int i) {
 				int offset = i * column_size;
@@ -1225,18 +2220,32 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*֐Kp STD
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_std_func(F func) const {
+			FastMatrix<T> result(row_size, column_size);
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; ++j) {
+					int pos = offset + j;
+					result[pos] = func(entity[pos]);
+				}
+			});
+			return result;
+		}
 
 		/*֐Kp
 		func: T(*func)(T x1, T x2)*/
 		template<class F>
-		FastMatrix<T> apply_com_combo_func(F func, FastMatrix<T>& target) {
+		FastMatrix<T> apply_com_combo_func(F func, const FastMatrix<T>& target) const {
 			if (row_size != target.row_size) throw fast_container_exception();
 			if (column_size != target.column_size) throw fast_container_exception();
 			FastMatrix<T> result(row_size, column_size);
 			auto ent_itr = entity.begin();
 			auto trg_itr = target.begin();
 			for (auto&& y : result.entity) {
-				y = func(*ent_itr, trg_itr);
+				y = func(*ent_itr, *trg_itr);
 				++ent_itr;
 				++trg_itr;
 			}
@@ -1245,7 +2254,7 @@ namespace FastContainer {
 		/*֐Kp AMP
 		func: T(*func)(T x1, T x2) restrict(amp)*/
 		template<class F>
-		FastMatrix<T> apply_amp_combo_func(F func, FastMatrix<T>& target) {
+		FastMatrix<T> apply_amp_combo_func(F func, const FastMatrix<T>& target) const {
 			if (row_size != target.row_size) throw fast_container_exception();
 			if (column_size != target.column_size) throw fast_container_exception();
 			FastMatrix<T> result(row_size, column_size);
@@ -1261,7 +2270,7 @@ namespace FastContainer {
 		/*֐Kp PPL
 		func: T(*func)(T x1, T x2)*/
 		template<class F>
-		FastMatrix<T> apply_ppl_combo_func(F func, FastMatrix<T>& target) {
+		FastMatrix<T> apply_ppl_combo_func(F func, const FastMatrix<T>& target) const {
 			if (row_size != target.row_size) throw fast_container_exception();
 			if (column_size != target.column_size) throw fast_container_exception();
 			FastMatrix<T> result(row_size, column_size);
@@ -1274,11 +2283,259 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*֐Kp STD
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastMatrix<T> apply_std_combo_func(F func, const FastMatrix<T>& target) const {
+			if (row_size != target.row_size) throw fast_container_exception();
+			if (column_size != target.column_size) throw fast_container_exception();
+			FastMatrix<T> result(row_size, column_size);
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; ++j) {
+					int pos = offset + j;
+					result[pos] = func(entity[pos], target[pos]);
+				}
+			});
+			return result;
+		}
+
+		/*֐Kp (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_com_func(SimdUnaryOp op, F func) const {
+			SerialExecutor exec;
+			return apply_simd_func(op, func, exec);
+		}
+		/*֐Kp PPL (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_ppl_func(SimdUnaryOp op, F func) const {
+			PplExecutor exec;
+			return apply_simd_func(op, func, exec);
+		}
+		/*֐Kp STD (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_std_func(SimdUnaryOp op, F func) const { return apply_simd_func(op, func, ThreadPool::get_instance()); }
+		/*֐Kp AUTO (vfŒsXbhsI)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_auto_func(SimdUnaryOp op, F func) const {
+			AutoExecutor exec(DISPATCH_OP_ELEMENTWISE, size);
+			return apply_simd_func(op, func, exec);
+		}
+		/*֐Kp SIMD
+		exec: s*/
+		template<class F, class E>
+		FastMatrix<T> apply_simd_func(SimdUnaryOp op, F func, E& exec) const {
+			FastMatrix<T> result(row_size, column_size);
+			if (size == 0) return result;
+			if (simd_unary(op, &entity[0], &result[0], size, exec)) return result;
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) result[i] = func(entity[i]);
+			}, SIMD_GRAIN);
+			return result;
+		}
+		/*֐Kpď㏑ SIMD
+		exec: s*/
+		template<class F, class E>
+		FastMatrix<T>& apply_simd_inplace(SimdUnaryOp op, F func, E& exec) {
+			if (size == 0) return *this;
+			if (simd_unary(op, &entity[0], &entity[0], size, exec)) return *this;
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) entity[i] = func(entity[i]);
+			}, SIMD_GRAIN);
+			return *this;
+		}
+
+		/*XJ[lƂ̊֐Kp (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_com_func(SimdBinaryOp op, T val, F func) const {
+			SerialExecutor exec;
+			return apply_simd_func(op, val, func, exec);
+		}
+		/*XJ[lƂ̊֐Kp PPL (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_ppl_func(SimdBinaryOp op, T val, F func) const {
+			PplExecutor exec;
+			return apply_simd_func(op, val, func, exec);
+		}
+		/*XJ[lƂ̊֐Kp STD (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_std_func(SimdBinaryOp op, T val, F func) const { return apply_simd_func(op, val, func, ThreadPool::get_instance()); }
+		/*XJ[lƂ̊֐Kp AUTO (vfŒsXbhsI)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_auto_func(SimdBinaryOp op, T val, F func) const {
+			AutoExecutor exec(DISPATCH_OP_ELEMENTWISE, size);
+			return apply_simd_func(op, val, func, exec);
+		}
+		/*XJ[lƂ̊֐Kp SIMD
+		exec: s*/
+		template<class F, class E>
+		FastMatrix<T> apply_simd_func(SimdBinaryOp op, T val, F func, E& exec) const {
+			FastMatrix<T> result(row_size, column_size);
+			if (size == 0) return result;
+			if (simd_binary_scalar(op, &entity[0], val, &result[0], size, exec)) return result;
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) result[i] = func(entity[i]);
+			}, SIMD_GRAIN);
+			return result;
+		}
+
+		/*֐Kp (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastMatrix<T> apply_com_combo_func(SimdBinaryOp op, F func, const FastMatrix<T>& target) const {
+			SerialExecutor exec;
+			return apply_simd_combo_func(op, func, target, exec);
+		}
+		/*֐Kp PPL (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastMatrix<T> apply_ppl_combo_func(SimdBinaryOp op, F func, const FastMatrix<T>& target) const {
+			PplExecutor exec;
+			return apply_simd_combo_func(op, func, target, exec);
+		}
+		/*֐Kp STD (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastMatrix<T> apply_std_combo_func(SimdBinaryOp op, F func, const FastMatrix<T>& target) const { return apply_simd_combo_func(op, func, target, ThreadPool::get_instance()); }
+		/*֐Kp AUTO (vfŒsXbhsI)
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastMatrix<T> apply_auto_combo_func(SimdBinaryOp op, F func, const FastMatrix<T>& target) const {
+			AutoExecutor exec(DISPATCH_OP_ELEMENTWISE, size);
+			return apply_simd_combo_func(op, func, target, exec);
+		}
+		/*֐Kp SIMD
+		exec: s*/
+		template<class F, class E>
+		FastMatrix<T> apply_simd_combo_func(SimdBinaryOp op, F func, const FastMatrix<T>& target, E& exec) const {
+			if (row_size != target.row_size) throw fast_container_exception();
+			if (column_size != target.column_size) throw fast_container_exception();
+			FastMatrix<T> result(row_size, column_size);
+			if (size == 0) return result;
+			if (simd_binary(op, &entity[0], &target[0], &result[0], size, exec)) return result;
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) result[i] = func(entity[i], target[i]);
+			}, SIMD_GRAIN);
+			return result;
+		}
+
+		/*֐Kpď㏑
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T>& apply_inplace_com(F func) {
+			for (auto&& y : entity) y = func(y);
+			return *this;
+		}
+		/*֐Kpď㏑ AMP
+		func: T(*func)(T x) restrict(amp)*/
+		template<class F>
+		FastMatrix<T>& apply_inplace_amp(F func) {
+			if (size == 0) return *this;
+			concurrency::array_view<T, 1> av_entity(size, &entity[0]);
+			concurrency::parallel_for_each(av_entity.extent, [=](concurrency::index<1> idx) restrict(amp) {
+				av_entity[idx] = func(av_entity[idx]);
+			});
+			av_entity.synchronize();
+			return *this;
+		}
+		/*֐Kpď㏑ PPL
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T>& apply_inplace_ppl(F func) {
+			concurrency::parallel_for<int>(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; ++j) {
+					int pos = offset + j;
+					entity[pos] = func(entity[pos]);
+				}
+			});
+			return *this;
+		}
+		/*֐Kpď㏑ STD
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T>& apply_inplace_std(F func) {
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; ++j) {
+					int pos = offset + j;
+					entity[pos] = func(entity[pos]);
+				}
+			});
+			return *this;
+		}
+
+		/*֐Kpď㏑
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastMatrix<T>& apply_combo_inplace_com(F func, const FastMatrix<T>& target) {
+			if (row_size != target.row_size) throw fast_container_exception();
+			if (column_size != target.column_size) throw fast_container_exception();
+			auto trg_itr = target.begin();
+			for (auto&& y : entity) {
+				y = func(y, *trg_itr);
+				++trg_itr;
+			}
+			return *this;
+		}
+		/*֐Kpď㏑ AMP
+		func: T(*func)(T x1, T x2) restrict(amp)*/
+		template<class F>
+		FastMatrix<T>& apply_combo_inplace_amp(F func, const FastMatrix<T>& target) {
+			if (row_size != target.row_size) throw fast_container_exception();
+			if (column_size != target.column_size) throw fast_container_exception();
+			if (size == 0) return *this;
+			concurrency::array_view<T, 1> av_entity(size, &entity[0]);
+			concurrency::array_view<const T, 1> av_target(size, &target[0]);
+			concurrency::parallel_for_each(av_entity.extent, [=](concurrency::index<1> idx) restrict(amp) {
+				av_entity[idx] = func(av_entity[idx], av_target[idx]);
+			});
+			av_entity.synchronize();
+			return *this;
+		}
+		/*֐Kpď㏑ PPL
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastMatrix<T>& apply_combo_inplace_ppl(F func, const FastMatrix<T>& target) {
+			if (row_size != target.row_size) throw fast_container_exception();
+			if (column_size != target.column_size) throw fast_container_exception();
+			concurrency::parallel_for<int>(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; ++j) {
+					int pos = offset + j;
+					entity[pos] = func(entity[pos], target[pos]);
+				}
+			});
+			return *this;
+		}
+		/*֐Kpď㏑ STD
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastMatrix<T>& apply_combo_inplace_std(F func, const FastMatrix<T>& target) {
+			if (row_size != target.row_size) throw fast_container_exception();
+			if (column_size != target.column_size) throw fast_container_exception();
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; ++j) {
+					int pos = offset + j;
+					entity[pos] = func(entity[pos], target[pos]);
+				}
+			});
+			return *this;
+		}
 
 		/*sɊ֐Kp
 		func: T(*func)(T x1, T x2)*/
 		template<class F>
-		FastMatrix<T> apply_com_combo_func_by_rows(F func, FastVector<T>& target) {
+		FastMatrix<T> apply_com_combo_func_by_rows(F func, const FastVector<T>& target) const {
 			if (column_size != target.get_size()) throw fast_container_exception();
 			FastMatrix<T> result(row_size, column_size);
 			auto ent_itr = entity.begin();
@@ -1287,15 +2544,14 @@ namespace FastContainer {
 			for (auto&& y : result.entity) {
 				y = func(*ent_itr, *trg_itr);
 				++ent_itr;
-				if (trg_itr != trg_end) ++trg_itr;
-				else trg_itr = target.begin();
+				if (++trg_itr == trg_end) trg_itr = target.begin();
 			}
 			return result;
 		}
 		/*sɊ֐Kp AMP
 		func: T(*func)(T x1, T x2) restrict(amp)*/
 		template<class F>
-		FastMatrix<T> apply_amp_combo_func_by_rows(F func, FastVector<T>& target) {
+		FastMatrix<T> apply_amp_combo_func_by_rows(F func, const FastVector<T>& target) const {
 			if (column_size != target.get_size()) throw fast_container_exception();
 			FastMatrix<T> result(row_size, column_size);
 			concurrency::array_view<const T, 2> av_entity(row_size, column_size, &entity[0]);
@@ -1311,7 +2567,7 @@ namespace FastContainer {
 		/*sɊ֐Kp PPL
 		func: T(*func)(T x1, T x2)*/
 		template<class F>
-		FastMatrix<T> apply_ppl_combo_func_by_rows(F func, FastVector<T>& target) {
+		FastMatrix<T> apply_ppl_combo_func_by_rows(F func, const FastVector<T>& target) const {
 			if (column_size != target.get_size()) throw fast_container_exception();
 			FastMatrix<T> result(row_size, column_size);
 			concurrency::parallel_for<int>(0, row_size, [&](int i) {
@@ -1323,11 +2579,26 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*sɊ֐Kp STD
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastMatrix<T> apply_std_combo_func_by_rows(F func, const FastVector<T>& target) const {
+			if (column_size != target.get_size()) throw fast_container_exception();
+			FastMatrix<T> result(row_size, column_size);
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; ++j) {
+					int pos = offset + j;
+					result[pos] = func(entity[pos], target[j]);
+				}
+			});
+			return result;
+		}
 
 		/*񖈂Ɋ֐Kp
 		func: T(*func)(T x1, T x2)*/
 		template<class F>
-		FastMatrix<T> apply_com_combo_func_by_columns(F func, FastVector<T>& target) {
+		FastMatrix<T> apply_com_combo_func_by_columns(F func, const FastVector<T>& target) const {
 			if (row_size != target.get_size()) throw fast_container_exception();
 			FastMatrix<T> result(row_size, column_size);
 			auto ent_itr = entity.begin();
@@ -1347,7 +2618,7 @@ namespace FastContainer {
 		/*񖈂Ɋ֐Kp AMP
 		func: T(*func)(T x1, T x2) restrict(amp)*/
 		template<class F>
-		FastMatrix<T> apply_amp_combo_func_by_columns(F func, FastVector<T>& target) {
+		FastMatrix<T> apply_amp_combo_func_by_columns(F func, const FastVector<T>& target) const {
 			if (row_size != target.get_size()) throw fast_container_exception();
 			FastMatrix<T> result(row_size, column_size);
 			concurrency::array_view<const T, 2> av_entity(row_size, column_size, &entity[0]);
@@ -1363,7 +2634,7 @@ namespace FastContainer {
 		/*񖈂Ɋ֐Kp PPL
 		func: T(*func)(T x1, T x2)*/
 		template<class F>
-		FastMatrix<T> apply_ppl_combo_func_by_columns(F func, FastVector<T>& target) {
+		FastMatrix<T> apply_ppl_combo_func_by_columns(F func, const FastVector<T>& target) const {
 			if (row_size != target.get_size()) throw fast_container_exception();
 			FastMatrix<T> result(row_size, column_size);
 			concurrency::parallel_for<int>(0, row_size, [&](int i) {
@@ -1375,6 +2646,21 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*񖈂Ɋ֐Kp STD
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastMatrix<T> apply_std_combo_func_by_columns(F func, const FastVector<T>& target) const {
+			if (row_size != target.get_size()) throw fast_container_exception();
+			FastMatrix<T> result(row_size, column_size);
+			parallel_for(0, row_size, [&](int i) {
+				int offset = i * column_size;
+				for (int j = 0; j < column_size; ++j) {
+					int pos = offset + j;
+					result[pos] = func(entity[pos], target[i]);
+				}
+			});
+			return result;
+		}
 
 		/*(row,column) [[values1],[values2],...]*/
 		std::string to_string() {
@@ -1397,57 +2683,126 @@ namespace FastContainer {
 		/*_FastMatrix𐶐*/
 		static FastMatrix<T> real_random_com(int row, int col, T min = -1, T max = 1) {
 			FastMatrix<T> result(row, col);
-			RealRandom<T> rnd(min, max);
-			for (auto&& y : result) y = rnd.generate();
+			SerialExecutor exec;
+			random_uniform(result.get_data(), result.size, min, max, next_random_seed(), exec);
 			return result;
 		}
 		/*_FastMatrix𐶐 PPL*/
 		static FastMatrix<T> real_random_ppl(int row, int col, T min = -1, T max = 1) {
 			FastMatrix<T> result(row, col);
-			RealRandom<T> rnd(min, max);
-			concurrency::parallel_for<int>(0, result.size, [&](int i) {
-				result[i] = rnd.generate();
-			});
+			PplExecutor exec;
+			random_uniform(result.get_data(), result.size, min, max, next_random_seed(), exec);
+			return result;
+		}
+		/*_FastMatrix𐶐 STD*/
+		static FastMatrix<T> real_random_std(int row, int col, T min = -1, T max = 1) {
+			FastMatrix<T> result(row, col);
+			random_uniform(result.get_data(), result.size, min, max, next_random_seed(), ThreadPool::get_instance());
 			return result;
 		}
 		/*_FastMatrix𐶐*/
 		static FastMatrix<T> int_random_com(int row, int col, int min = -1, int max = 1) {
 			FastMatrix<T> result(row, col);
-			IntRandom rnd(min, max);
-			for (auto&& y : result) y = rnd.generate();
+			SerialExecutor exec;
+			random_int(result.get_data(), result.size, min, max, next_random_seed(), exec);
 			return result;
 		}
 		/*_FastMatrix𐶐 PPL*/
 		static FastMatrix<T> int_random_ppl(int row, int col, int min = -1, int max = 1) {
 			FastMatrix<T> result(row, col);
-			IntRandom rnd(min, max);
-			concurrency::parallel_for<int>(0, result.size, [&](int i) {
-				result[i] = rnd.generate();
-			});
+			PplExecutor exec;
+			random_int(result.get_data(), result.size, min, max, next_random_seed(), exec);
+			return result;
+		}
+		/*_FastMatrix𐶐 STD*/
+		static FastMatrix<T> int_random_std(int row, int col, int min = -1, int max = 1) {
+			FastMatrix<T> result(row, col);
+			random_int(result.get_data(), result.size, min, max, next_random_seed(), ThreadPool::get_instance());
 			return result;
 		}
 		/*:mean, W΍:sd ̃_FastMatrix𐶐*/
 		static FastMatrix<T> normal_random_com(int row, int col, T mean = 0, T sd = 1) {
 			FastMatrix<T> result(row, col);
-			NormalRandom<T> rnd(mean, sd);
-			for (auto&& y : result) y = rnd.generate();
+			SerialExecutor exec;
+			random_normal(result.get_data(), result.size, mean, sd, next_random_seed(), exec);
 			return result;
 		}
 		/*:mean, W΍:sd ̃_FastMatrix𐶐 PPL*/
 		static FastMatrix<T> normal_random_ppl(int row, int col, T mean = 0, T sd = 1) {
 			FastMatrix<T> result(row, col);
-			NormalRandom<T> rnd(mean, sd);
-			concurrency::parallel_for<int>(0, result.size, [&](int i) {
-				result[i] = rnd.generate();
-			});
+			PplExecutor exec;
+			random_normal(result.get_data(), result.size, mean, sd, next_random_seed(), exec);
 			return result;
 		}
+		/*:mean, W΍:sd ̃_FastMatrix𐶐 STD*/
+		static FastMatrix<T> normal_random_std(int row, int col, T mean = 0, T sd = 1) {
+			FastMatrix<T> result(row, col);
+			random_normal(result.get_data(), result.size, mean, sd, next_random_seed(), ThreadPool::get_instance());
+			return result;
+		}
+		/*
+		g min`max ̈lŖ߂ (̈ėpASIMDł܂Ƃ߂Đ)
+		seed: ̎ (ȂsɊւ炸l)
+		exec: s
+		*/
+		template<class E>
+		FastMatrix<T>& fill_real_random(T min, T max, uint64_t seed, E& exec) {
+			random_uniform(get_data(), size, min, max, seed, exec);
+			return *this;
+		}
+		/*g min`max ̈lŖ߂*/
+		FastMatrix<T>& fill_real_random(T min = -1, T max = 1) { return fill_real_random(min, max, next_random_seed(), ThreadPool::get_instance()); }
+		/*
+		g :mean, W΍:sd ̐KŖ߂ (̈ėpASIMDł܂Ƃ߂Đ)
+		seed: ̎ (ȂsɊւ炸l)
+		exec: s
+		*/
+		template<class E>
+		FastMatrix<T>& fill_normal_random(T mean, T sd, uint64_t seed, E& exec) {
+			random_normal(get_data(), size, mean, sd, seed, exec);
+			return *this;
+		}
+		/*g :mean, W΍:sd ̐KŖ߂*/
+		FastMatrix<T>& fill_normal_random(T mean = 0, T sd = 1) { return fill_normal_random(mean, sd, next_random_seed(), ThreadPool::get_instance()); }
 
 	private:
-		std::vector<T> entity;
-		int row_size;
-		int column_size;
-		int size;
+		/*Leaky ReLU ƃ}XNsɌvZ (}XN̊es͌̋En܂̂ōsɕ񉻂ł)*/
+		template<class E>
+		void leaky_relu_mask_rows(FastMatrix<T>& result, FastBitMask& mask, const T *slopes, T slope, E& exec) {
+			if (&result != this && (result.row_size != row_size || result.column_size != column_size)) result.resize(row_size, column_size);
+			if (mask.get_row_size() != row_size || mask.get_column_size() != column_size) mask.resize(row_size, column_size);
+			auto kernel = ReluMaskKernel<T>::get_forward();
+			int col = column_size;
+			const T *in = get_data();
+			T *out = result.get_data();
+			exec.parallel_for_range(0, row_size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					size_t offset = (size_t)i * col;
+					kernel(in + offset, slopes != nullptr ? slopes + offset : nullptr, slope, out + offset, mask.get_row(i), col);
+				}
+			}, std::max(1, SIMD_GRAIN / std::max(1, col)));
+		}
+		/*Leaky ReLU ̋t`dsɌvZ*/
+		template<class E>
+		void leaky_relu_backward_rows(const FastBitMask& mask, FastMatrix<T>& result, const T *slopes, T slope, E& exec) {
+			if (mask.get_row_size() != row_size || mask.get_column_size() != column_size) throw fast_container_exception();
+			if (&result != this && (result.row_size != row_size || result.column_size != column_size)) result.resize(row_size, column_size);
+			auto kernel = ReluMaskKernel<T>::get_backward();
+			int col = column_size;
+			const T *grad = get_data();
+			T *out = result.get_data();
+			exec.parallel_for_range(0, row_size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					size_t offset = (size_t)i * col;
+					kernel(grad + offset, slopes != nullptr ? slopes + offset : nullptr, slope, mask.get_row(i), out + offset, col);
+				}
+			}, std::max(1, SIMD_GRAIN / std::max(1, col)));
+		}
+
+		FastStorage<T> entity;
+		int row_size = 0;
+		int column_size = 0;
+		int size = 0;
 
 	};
 
@@ -1455,197 +2810,327 @@ namespace FastContainer {
 #ifdef FAST_CONTAONER_OPERATOR_OVERLOAD_COM_MODE
 
 	template<typename T>
-	FastMatrix<T> operator+(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_com_combo_func([](T x1, T x2) {return x1 + x2; }, mat2); }
+	FastMatrix<T> operator+(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_com_combo_func(SIMD_ADD, [](T x1, T x2) {return x1 + x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator-(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_com_combo_func([](T x1, T x2) {return x1 - x2; }, mat2); }
+	FastMatrix<T> operator-(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_com_combo_func(SIMD_SUB, [](T x1, T x2) {return x1 - x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator*(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_com_combo_func([](T x1, T x2) {return x1 * x2; }, mat2); }
+	FastMatrix<T> operator*(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_com_combo_func(SIMD_MUL, [](T x1, T x2) {return x1 * x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator/(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_com_combo_func([](T x1, T x2) {return x1 / x2; }, mat2); }
+	FastMatrix<T> operator/(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_com_combo_func(SIMD_DIV, [](T x1, T x2) {return x1 / x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator==(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_com_combo_func([](T x1, T x2) {return x1 == x2; }, mat2); }
+	FastMatrix<T> operator==(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_com_combo_func(SIMD_EQ, [](T x1, T x2) {return x1 == x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator!=(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_com_combo_func([](T x1, T x2) {return x1 != x2; }, mat2); }
+	FastMatrix<T> operator!=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_com_combo_func(SIMD_NE, [](T x1, T x2) {return x1 != x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator>(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_com_combo_func([](T x1, T x2) {return x1 > x2; }, mat2); }
+	FastMatrix<T> operator>(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_com_combo_func(SIMD_GT, [](T x1, T x2) {return x1 > x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator<(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_com_combo_func([](T x1, T x2) {return x1 < x2; }, mat2); }
+	FastMatrix<T> operator<(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_com_combo_func(SIMD_LT, [](T x1, T x2) {return x1 < x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator>=(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_com_combo_func([](T x1, T x2) {return x1 >= x2; }, mat2); }
+	FastMatrix<T> operator>=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_com_combo_func(SIMD_GE, [](T x1, T x2) {return x1 >= x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator<=(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_com_combo_func([](T x1, T x2) {return x1 <= x2; }, mat2); }
+	FastMatrix<T> operator<=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_com_combo_func(SIMD_LE, [](T x1, T x2) {return x1 <= x2; }, mat2); }
 
 	template<typename T>
-	FastMatrix<T> operator+(T val, FastMatrix<T>& mat) { return mat.apply_com_func([=](T x) {return val + x; }); }
+	FastMatrix<T> operator+(T val, const FastMatrix<T>& mat) { return mat.apply_com_func(SIMD_ADD, val, [=](T x) {return val + x; }); }
 	template<typename T>
-	FastMatrix<T> operator-(T val, FastMatrix<T>& mat) { return mat.apply_com_func([=](T x) {return val - x; }); }
+	FastMatrix<T> operator-(T val, const FastMatrix<T>& mat) { return mat.apply_com_func(SIMD_RSUB, val, [=](T x) {return val - x; }); }
 	template<typename T>
-	FastMatrix<T> operator*(T val, FastMatrix<T>& mat) { return mat.apply_com_func([=](T x) {return val * x; }); }
+	FastMatrix<T> operator*(T val, const FastMatrix<T>& mat) { return mat.apply_com_func(SIMD_MUL, val, [=](T x) {return val * x; }); }
 	template<typename T>
-	FastMatrix<T> operator/(T val, FastMatrix<T>& mat) { return mat.apply_com_func([=](T x) {return val / x; }); }
+	FastMatrix<T> operator/(T val, const FastMatrix<T>& mat) { return mat.apply_com_func(SIMD_RDIV, val, [=](T x) {return val / x; }); }
 	template<typename T>
-	FastMatrix<T> operator==(T val, FastMatrix<T>& mat) { return mat.apply_com_func([=](T x) {return val == x; }); }
+	FastMatrix<T> operator==(T val, const FastMatrix<T>& mat) { return mat.apply_com_func(SIMD_EQ, val, [=](T x) {return val == x; }); }
 	template<typename T>
-	FastMatrix<T> operator!=(T val, FastMatrix<T>& mat) { return mat.apply_com_func([=](T x) {return val != x; }); }
+	FastMatrix<T> operator!=(T val, const FastMatrix<T>& mat) { return mat.apply_com_func(SIMD_NE, val, [=](T x) {return val != x; }); }
 	template<typename T>
-	FastMatrix<T> operator>(T val, FastMatrix<T>& mat) { return mat.apply_com_func([=](T x) {return val > x; }); }
+	FastMatrix<T> operator>(T val, const FastMatrix<T>& mat) { return mat.apply_com_func(SIMD_LT, val, [=](T x) {return val > x; }); }
 	template<typename T>
-	FastMatrix<T> operator<(T val, FastMatrix<T>& mat) { return mat.apply_com_func([=](T x) {return val < x; }); }
+	FastMatrix<T> operator<(T val, const FastMatrix<T>& mat) { return mat.apply_com_func(SIMD_GT, val, [=](T x) {return val < x; }); }
 	template<typename T>
-	FastMatrix<T> operator>=(T val, FastMatrix<T>& mat) { return mat.apply_com_func([=](T x) {return val >= x; }); }
+	FastMatrix<T> operator>=(T val, const FastMatrix<T>& mat) { return mat.apply_com_func(SIMD_LE, val, [=](T x) {return val >= x; }); }
 	template<typename T>
-	FastMatrix<T> operator<=(T val, FastMatrix<T>& mat) { return mat.apply_com_func([=](T x) {return val <= x; }); }
+	FastMatrix<T> operator<=(T val, const FastMatrix<T>& mat) { return mat.apply_com_func(SIMD_GE, val, [=](T x) {return val <= x; }); }
 
 	template<typename T>
-	FastMatrix<T> operator+(FastMatrix<T>& mat, T val) { return mat.apply_com_func([=](T x) {return x + val; }); }
+	FastMatrix<T> operator+(const FastMatrix<T>& mat, T val) { return mat.apply_com_func(SIMD_ADD, val, [=](T x) {return x + val; }); }
 	template<typename T>
-	FastMatrix<T> operator-(FastMatrix<T>& mat, T val) { return mat.apply_com_func([=](T x) {return x - val; }); }
+	FastMatrix<T> operator-(const FastMatrix<T>& mat, T val) { return mat.apply_com_func(SIMD_SUB, val, [=](T x) {return x - val; }); }
 	template<typename T>
-	FastMatrix<T> operator*(FastMatrix<T>& mat, T val) { return mat.apply_com_func([=](T x) {return x * val; }); }
+	FastMatrix<T> operator*(const FastMatrix<T>& mat, T val) { return mat.apply_com_func(SIMD_MUL, val, [=](T x) {return x * val; }); }
 	template<typename T>
-	FastMatrix<T> operator/(FastMatrix<T>& mat, T val) { return mat.apply_com_func([=](T x) {return x / val; }); }
+	FastMatrix<T> operator/(const FastMatrix<T>& mat, T val) { return mat.apply_com_func(SIMD_DIV, val, [=](T x) {return x / val; }); }
 	template<typename T>
-	FastMatrix<T> operator==(FastMatrix<T>& mat, T val) { return mat.apply_com_func([=](T x) {return x == val; }); }
+	FastMatrix<T> operator==(const FastMatrix<T>& mat, T val) { return mat.apply_com_func(SIMD_EQ, val, [=](T x) {return x == val; }); }
 	template<typename T>
-	FastMatrix<T> operator!=(FastMatrix<T>& mat, T val) { return mat.apply_com_func([=](T x) {return x != val; }); }
+	FastMatrix<T> operator!=(const FastMatrix<T>& mat, T val) { return mat.apply_com_func(SIMD_NE, val, [=](T x) {return x != val; }); }
 	template<typename T>
-	FastMatrix<T> operator>(FastMatrix<T>& mat, T val) { return mat.apply_com_func([=](T x) {return x > val; }); }
+	FastMatrix<T> operator>(const FastMatrix<T>& mat, T val) { return mat.apply_com_func(SIMD_GT, val, [=](T x) {return x > val; }); }
 	template<typename T>
-	FastMatrix<T> operator<(FastMatrix<T>& mat, T val) { return mat.apply_com_func([=](T x) {return x < val; }); }
+	FastMatrix<T> operator<(const FastMatrix<T>& mat, T val) { return mat.apply_com_func(SIMD_LT, val, [=](T x) {return x < val; }); }
 	template<typename T>
-	FastMatrix<T> operator>=(FastMatrix<T>& mat, T val) { return mat.apply_com_func([=](T x) {return x >= val; }); }
+	FastMatrix<T> operator>=(const FastMatrix<T>& mat, T val) { return mat.apply_com_func(SIMD_GE, val, [=](T x) {return x >= val; }); }
 	template<typename T>
-	FastMatrix<T> operator<=(FastMatrix<T>& mat, T val) { return mat.apply_com_func([=](T x) {return x <= val; }); }
+	FastMatrix<T> operator<=(const FastMatrix<T>& mat, T val) { return mat.apply_com_func(SIMD_LE, val, [=](T x) {return x <= val; }); }
 
 #elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_AMP_MODE
 
 	template<typename T>
-	FastMatrix<T> operator+(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 + x2; }, mat2); }
+	FastMatrix<T> operator+(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 + x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator-(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 - x2; }, mat2); }
+	FastMatrix<T> operator-(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 - x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator*(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 * x2; }, mat2); }
+	FastMatrix<T> operator*(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 * x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator/(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 / x2; }, mat2); }
+	FastMatrix<T> operator/(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 / x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator==(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 == x2; }, mat2); }
+	FastMatrix<T> operator==(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 == x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator!=(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 != x2; }, mat2); }
+	FastMatrix<T> operator!=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 != x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator>(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 > x2; }, mat2); }
+	FastMatrix<T> operator>(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 > x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator<(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 < x2; }, mat2); }
+	FastMatrix<T> operator<(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 < x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator>=(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 >= x2; }, mat2); }
+	FastMatrix<T> operator>=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 >= x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator<=(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 <= x2; }, mat2); }
+	FastMatrix<T> operator<=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 <= x2; }, mat2); }
 
 	template<typename T>
-	FastMatrix<T> operator+(T val, FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val + x; }); }
+	FastMatrix<T> operator+(T val, const FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val + x; }); }
 	template<typename T>
-	FastMatrix<T> operator-(T val, FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val - x; }); }
+	FastMatrix<T> operator-(T val, const FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val - x; }); }
 	template<typename T>
-	FastMatrix<T> operator*(T val, FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val * x; }); }
+	FastMatrix<T> operator*(T val, const FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val * x; }); }
 	template<typename T>
-	FastMatrix<T> operator/(T val, FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val / x; }); }
+	FastMatrix<T> operator/(T val, const FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val / x; }); }
 	template<typename T>
-	FastMatrix<T> operator==(T val, FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val == x; }); }
+	FastMatrix<T> operator==(T val, const FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val == x; }); }
 	template<typename T>
-	FastMatrix<T> operator!=(T val, FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val != x; }); }
+	FastMatrix<T> operator!=(T val, const FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val != x; }); }
 	template<typename T>
-	FastMatrix<T> operator>(T val, FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val > x; }); }
+	FastMatrix<T> operator>(T val, const FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val > x; }); }
 	template<typename T>
-	FastMatrix<T> operator<(T val, FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val < x; }); }
+	FastMatrix<T> operator<(T val, const FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val < x; }); }
 	template<typename T>
-	FastMatrix<T> operator>=(T val, FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val >= x; }); }
+	FastMatrix<T> operator>=(T val, const FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val >= x; }); }
 	template<typename T>
-	FastMatrix<T> operator<=(T val, FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val <= x; }); }
+	FastMatrix<T> operator<=(T val, const FastMatrix<T>& mat) { return mat.apply_amp_func([=](T x) restrict(amp) {return val <= x; }); }
 
 	template<typename T>
-	FastMatrix<T> operator+(FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x + val; }); }
+	FastMatrix<T> operator+(const FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x + val; }); }
 	template<typename T>
-	FastMatrix<T> operator-(FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x - val; }); }
+	FastMatrix<T> operator-(const FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x - val; }); }
 	template<typename T>
-	FastMatrix<T> operator*(FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x * val; }); }
+	FastMatrix<T> operator*(const FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x * val; }); }
 	template<typename T>
-	FastMatrix<T> operator/(FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x / val; }); }
+	FastMatrix<T> operator/(const FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x / val; }); }
 	template<typename T>
-	FastMatrix<T> operator==(FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x == val; }); }
+	FastMatrix<T> operator==(const FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x == val; }); }
 	template<typename T>
-	FastMatrix<T> operator!=(FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x != val; }); }
+	FastMatrix<T> operator!=(const FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x != val; }); }
 	template<typename T>
-	FastMatrix<T> operator>(FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x > val; }); }
+	FastMatrix<T> operator>(const FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x > val; }); }
 	template<typename T>
-	FastMatrix<T> operator<(FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x < val; }); }
+	FastMatrix<T> operator<(const FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x < val; }); }
 	template<typename T>
-	FastMatrix<T> operator>=(FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x >= val; }); }
+	FastMatrix<T> operator>=(const FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x >= val; }); }
 	template<typename T>
-	FastMatrix<T> operator<=(FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x <= val; }); }
+	FastMatrix<T> operator<=(const FastMatrix<T>& mat, T val) { return mat.apply_amp_func([=](T x) restrict(amp) {return x <= val; }); }
 
 #elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_PPL_MODE
 
 	template<typename T>
-	FastMatrix<T> operator+(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func([](T x1, T x2) {return x1 + x2; }, mat2); }
+	FastMatrix<T> operator+(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func(SIMD_ADD, [](T x1, T x2) {return x1 + x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator-(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func(SIMD_SUB, [](T x1, T x2) {return x1 - x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator*(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func(SIMD_MUL, [](T x1, T x2) {return x1 * x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator/(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func(SIMD_DIV, [](T x1, T x2) {return x1 / x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator==(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func(SIMD_EQ, [](T x1, T x2) {return x1 == x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator!=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func(SIMD_NE, [](T x1, T x2) {return x1 != x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator>(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func(SIMD_GT, [](T x1, T x2) {return x1 > x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator<(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func(SIMD_LT, [](T x1, T x2) {return x1 < x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator>=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func(SIMD_GE, [](T x1, T x2) {return x1 >= x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator<=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func(SIMD_LE, [](T x1, T x2) {return x1 <= x2; }, mat2); }
+
+	template<typename T>
+	FastMatrix<T> operator+(T val, const FastMatrix<T>& mat) { return mat.apply_ppl_func(SIMD_ADD, val, [=](T x) {return val + x; }); }
+	template<typename T>
+	FastMatrix<T> operator-(T val, const FastMatrix<T>& mat) { return mat.apply_ppl_func(SIMD_RSUB, val, [=](T x) {return val - x; }); }
+	template<typename T>
+	FastMatrix<T> operator*(T val, const FastMatrix<T>& mat) { return mat.apply_ppl_func(SIMD_MUL, val, [=](T x) {return val * x; }); }
+	template<typename T>
+	FastMatrix<T> operator/(T val, const FastMatrix<T>& mat) { return mat.apply_ppl_func(SIMD_RDIV, val, [=](T x) {return val / x; }); }
+	template<typename T>
+	FastMatrix<T> operator==(T val, const FastMatrix<T>& mat) { return mat.apply_ppl_func(SIMD_EQ, val, [=](T x) {return val == x; }); }
+	template<typename T>
+	FastMatrix<T> operator!=(T val, const FastMatrix<T>& mat) { return mat.apply_ppl_func(SIMD_NE, val, [=](T x) {return val != x; }); }
+	template<typename T>
+	FastMatrix<T> operator>(T val, const FastMatrix<T>& mat) { return mat.apply_ppl_func(SIMD_LT, val, [=](T x) {return val > x; }); }
+	template<typename T>
+	FastMatrix<T> operator<(T val, const FastMatrix<T>& mat) { return mat.apply_ppl_func(SIMD_GT, val, [=](T x) {return val < x; }); }
+	template<typename T>
+	FastMatrix<T> operator>=(T val, const FastMatrix<T>& mat) { return mat.apply_ppl_func(SIMD_LE, val, [=](T x) {return val >= x; }); }
+	template<typename T>
+	FastMatrix<T> operator<=(T val, const FastMatrix<T>& mat) { return mat.apply_ppl_func(SIMD_GE, val, [=](T x) {return val <= x; }); }
+
+	template<typename T>
+	FastMatrix<T> operator+(const FastMatrix<T>& mat, T val) { return mat.apply_ppl_func(SIMD_ADD, val, [=](T x) {return x + val; }); }
+	template<typename T>
+	FastMatrix<T> operator-(const FastMatrix<T>& mat, T val) { return mat.apply_ppl_func(SIMD_SUB, val, [=](T x) {return x - val; }); }
+	template<typename T>
+	FastMatrix<T> operator*(const FastMatrix<T>& mat, T val) { return mat.apply_ppl_func(SIMD_MUL, val, [=](T x) {return x * val; }); }
+	template<typename T>
+	FastMatrix<T> operator/(const FastMatrix<T>& mat, T val) { return mat.apply_ppl_func(SIMD_DIV, val, [=](T x) {return x / val; }); }
+	template<typename T>
+	FastMatrix<T> operator==(const FastMatrix<T>& mat, T val) { return mat.apply_ppl_func(SIMD_EQ, val, [=](T x) {return x == val; }); }
+	template<typename T>
+	FastMatrix<T> operator!=(const FastMatrix<T>& mat, T val) { return mat.apply_ppl_func(SIMD_NE, val, [=](T x) {return x != val; }); }
+	template<typename T>
+	FastMatrix<T> operator>(const FastMatrix<T>& mat, T val) { return mat.apply_ppl_func(SIMD_GT, val, [=](T x) {return x > val; }); }
+	template<typename T>
+	FastMatrix<T> operator<(const FastMatrix<T>& mat, T val) { return mat.apply_ppl_func(SIMD_LT, val, [=](T x) {return x < val; }); }
+	template<typename T>
+	FastMatrix<T> operator>=(const FastMatrix<T>& mat, T val) { return mat.apply_ppl_func(SIMD_GE, val, [=](T x) {return x >= val; }); }
+	template<typename T>
+	FastMatrix<T> operator<=(const FastMatrix<T>& mat, T val) { return mat.apply_ppl_func(SIMD_LE, val, [=](T x) {return x <= val; }); }
+
+#elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_STD_MODE
+
+	template<typename T>
+	FastMatrix<T> operator+(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_std_combo_func(SIMD_ADD, [](T x1, T x2) {return x1 + x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator-(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_std_combo_func(SIMD_SUB, [](T x1, T x2) {return x1 - x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator*(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_std_combo_func(SIMD_MUL, [](T x1, T x2) {return x1 * x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator/(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_std_combo_func(SIMD_DIV, [](T x1, T x2) {return x1 / x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator==(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_std_combo_func(SIMD_EQ, [](T x1, T x2) {return x1 == x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator!=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_std_combo_func(SIMD_NE, [](T x1, T x2) {return x1 != x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator>(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_std_combo_func(SIMD_GT, [](T x1, T x2) {return x1 > x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator<(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_std_combo_func(SIMD_LT, [](T x1, T x2) {return x1 < x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator>=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_std_combo_func(SIMD_GE, [](T x1, T x2) {return x1 >= x2; }, mat2); }
+	template<typename T>
+	FastMatrix<T> operator<=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_std_combo_func(SIMD_LE, [](T x1, T x2) {return x1 <= x2; }, mat2); }
+
+	template<typename T>
+	FastMatrix<T> operator+(T val, const FastMatrix<T>& mat) { return mat.apply_std_func(SIMD_ADD, val, [=](T x) {return val + x; }); }
+	template<typename T>
+	FastMatrix<T> operator-(T val, const FastMatrix<T>& mat) { return mat.apply_std_func(SIMD_RSUB, val, [=](T x) {return val - x; }); }
+	template<typename T>
+	FastMatrix<T> operator*(T val, const FastMatrix<T>& mat) { return mat.apply_std_func(SIMD_MUL, val, [=](T x) {return val * x; }); }
+	template<typename T>
+	FastMatrix<T> operator/(T val, const FastMatrix<T>& mat) { return mat.apply_std_func(SIMD_RDIV, val, [=](T x) {return val / x; }); }
+	template<typename T>
+	FastMatrix<T> operator==(T val, const FastMatrix<T>& mat) { return mat.apply_std_func(SIMD_EQ, val, [=](T x) {return val == x; }); }
+	template<typename T>
+	FastMatrix<T> operator!=(T val, const FastMatrix<T>& mat) { return mat.apply_std_func(SIMD_NE, val, [=](T x) {return val != x; }); }
+	template<typename T>
+	FastMatrix<T> operator>(T val, const FastMatrix<T>& mat) { return mat.apply_std_func(SIMD_LT, val, [=](T x) {return val > x; }); }
+	template<typename T>
+	FastMatrix<T> operator<(T val, const FastMatrix<T>& mat) { return mat.apply_std_func(SIMD_GT, val, [=](T x) {return val < x; }); }
+	template<typename T>
+	FastMatrix<T> operator>=(T val, const FastMatrix<T>& mat) { return mat.apply_std_func(SIMD_LE, val, [=](T x) {return val >= x; }); }
+	template<typename T>
+	FastMatrix<T> operator<=(T val, const FastMatrix<T>& mat) { return mat.apply_std_func(SIMD_GE, val, [=](T x) {return val <= x; }); }
+
+	template<typename T>
+	FastMatrix<T> operator+(const FastMatrix<T>& mat, T val) { return mat.apply_std_func(SIMD_ADD, val, [=](T x) {return x + val; }); }
+	template<typename T>
+	FastMatrix<T> operator-(const FastMatrix<T>& mat, T val) { return mat.apply_std_func(SIMD_SUB, val, [=](T x) {return x - val; }); }
+	template<typename T>
+	FastMatrix<T> operator*(const FastMatrix<T>& mat, T val) { return mat.apply_std_func(SIMD_MUL, val, [=](T x) {return x * val; }); }
+	template<typename T>
+	FastMatrix<T> operator/(const FastMatrix<T>& mat, T val) { return mat.apply_std_func(SIMD_DIV, val, [=](T x) {return x / val; }); }
+	template<typename T>
+	FastMatrix<T> operator==(const FastMatrix<T>& mat, T val) { return mat.apply_std_func(SIMD_EQ, val, [=](T x) {return x == val; }); }
+	template<typename T>
+	FastMatrix<T> operator!=(const FastMatrix<T>& mat, T val) { return mat.apply_std_func(SIMD_NE, val, [=](T x) {return x != val; }); }
+	template<typename T>
+	FastMatrix<T> operator>(const FastMatrix<T>& mat, T val) { return mat.apply_std_func(SIMD_GT, val, [=](T x) {return x > val; }); }
+	template<typename T>
+	FastMatrix<T> operator<(const FastMatrix<T>& mat, T val) { return mat.apply_std_func(SIMD_LT, val, [=](T x) {return x < val; }); }
+	template<typename T>
+	FastMatrix<T> operator>=(const FastMatrix<T>& mat, T val) { return mat.apply_std_func(SIMD_GE, val, [=](T x) {return x >= val; }); }
+	template<typename T>
+	FastMatrix<T> operator<=(const FastMatrix<T>& mat, T val) { return mat.apply_std_func(SIMD_LE, val, [=](T x) {return x <= val; }); }
+
+#elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_AUTO_MODE
+
+	template<typename T>
+	FastMatrix<T> operator+(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_auto_combo_func(SIMD_ADD, [](T x1, T x2) {return x1 + x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator-(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func([](T x1, T x2) {return x1 - x2; }, mat2); }
+	FastMatrix<T> operator-(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_auto_combo_func(SIMD_SUB, [](T x1, T x2) {return x1 - x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator*(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func([](T x1, T x2) {return x1 * x2; }, mat2); }
+	FastMatrix<T> operator*(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_auto_combo_func(SIMD_MUL, [](T x1, T x2) {return x1 * x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator/(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func([](T x1, T x2) {return x1 / x2; }, mat2); }
+	FastMatrix<T> operator/(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_auto_combo_func(SIMD_DIV, [](T x1, T x2) {return x1 / x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator==(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func([](T x1, T x2) {return x1 == x2; }, mat2); }
+	FastMatrix<T> operator==(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_auto_combo_func(SIMD_EQ, [](T x1, T x2) {return x1 == x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator!=(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func([](T x1, T x2) {return x1 != x2; }, mat2); }
+	FastMatrix<T> operator!=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_auto_combo_func(SIMD_NE, [](T x1, T x2) {return x1 != x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator>(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func([](T x1, T x2) {return x1 > x2; }, mat2); }
+	FastMatrix<T> operator>(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_auto_combo_func(SIMD_GT, [](T x1, T x2) {return x1 > x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator<(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func([](T x1, T x2) {return x1 < x2; }, mat2); }
+	FastMatrix<T> operator<(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_auto_combo_func(SIMD_LT, [](T x1, T x2) {return x1 < x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator>=(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func([](T x1, T x2) {return x1 >= x2; }, mat2); }
+	FastMatrix<T> operator>=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_auto_combo_func(SIMD_GE, [](T x1, T x2) {return x1 >= x2; }, mat2); }
 	template<typename T>
-	FastMatrix<T> operator<=(FastMatrix<T>& mat1, FastMatrix<T>& mat2) { return mat1.apply_ppl_combo_func([](T x1, T x2) {return x1 <= x2; }, mat2); }
+	FastMatrix<T> operator<=(const FastMatrix<T>& mat1, const FastMatrix<T>& mat2) { return mat1.apply_auto_combo_func(SIMD_LE, [](T x1, T x2) {return x1 <= x2; }, mat2); }
 
 	template<typename T>
-	FastMatrix<T> operator+(T val, FastMatrix<T>& mat) { return mat.apply_ppl_func([=](T x) {return val + x; }); }
+	FastMatrix<T> operator+(T val, const FastMatrix<T>& mat) { return mat.apply_auto_func(SIMD_ADD, val, [=](T x) {return val + x; }); }
 	template<typename T>
-	FastMatrix<T> operator-(T val, FastMatrix<T>& mat) { return mat.apply_ppl_func([=](T x) {return val - x; }); }
+	FastMatrix<T> operator-(T val, const FastMatrix<T>& mat) { return mat.apply_auto_func(SIMD_RSUB, val, [=](T x) {return val - x; }); }
 	template<typename T>
-	FastMatrix<T> operator*(T val, FastMatrix<T>& mat) { return mat.apply_ppl_func([=](T x) {return val * x; }); }
+	FastMatrix<T> operator*(T val, const FastMatrix<T>& mat) { return mat.apply_auto_func(SIMD_MUL, val, [=](T x) {return val * x; }); }
 	template<typename T>
-	FastMatrix<T> operator/(T val, FastMatrix<T>& mat) { return mat.apply_ppl_func([=](T x) {return val / x; }); }
+	FastMatrix<T> operator/(T val, const FastMatrix<T>& mat) { return mat.apply_auto_func(SIMD_RDIV, val, [=](T x) {return val / x; }); }
 	template<typename T>
-	FastMatrix<T> operator==(T val, FastMatrix<T>& mat) { return mat.apply_ppl_func([=](T x) {return val == x; }); }
+	FastMatrix<T> operator==(T val, const FastMatrix<T>& mat) { return mat.apply_auto_func(SIMD_EQ, val, [=](T x) {return val == x; }); }
 	template<typename T>
-	FastMatrix<T> operator!=(T val, FastMatrix<T>& mat) { return mat.apply_ppl_func([=](T x) {return val != x; }); }
+	FastMatrix<T> operator!=(T val, const FastMatrix<T>& mat) { return mat.apply_auto_func(SIMD_NE, val, [=](T x) {return val != x; }); }
 	template<typename T>
-	FastMatrix<T> operator>(T val, FastMatrix<T>& mat) { return mat.apply_ppl_func([=](T x) {return val > x; }); }
+	FastMatrix<T> operator>(T val, const FastMatrix<T>& mat) { return mat.apply_auto_func(SIMD_LT, val, [=](T x) {return val > x; }); }
 	template<typename T>
-	FastMatrix<T> operator<(T val, FastMatrix<T>& mat) { return mat.apply_ppl_func([=](T x) {return val < x; }); }
+	FastMatrix<T> operator<(T val, const FastMatrix<T>& mat) { return mat.apply_auto_func(SIMD_GT, val, [=](T x) {return val < x; }); }
 	template<typename T>
-	FastMatrix<T> operator>=(T val, FastMatrix<T>& mat) { return mat.apply_ppl_func([=](T x) {return val >= x; }); }
+	FastMatrix<T> operator>=(T val, const FastMatrix<T>& mat) { return mat.apply_auto_func(SIMD_LE, val, [=](T x) {return val >= x; }); }
 	template<typename T>
-	FastMatrix<T> operator<=(T val, FastMatrix<T>& mat) { return mat.apply_ppl_func([=](T x) {return val <= x; }); }
+	FastMatrix<T> operator<=(T val, const FastMatrix<T>& mat) { return mat.apply_auto_func(SIMD_GE, val, [=](T x) {return val <= x; }); }
 
 	template<typename T>
-	FastMatrix<T> operator+(FastMatrix<T>& mat, T val) { return mat.apply_ppl_func([=](T x) {return x + val; }); }
+	FastMatrix<T> operator+(const FastMatrix<T>& mat, T val) { return mat.apply_auto_func(SIMD_ADD, val, [=](T x) {return x + val; }); }
 	template<typename T>
-	FastMatrix<T> operator-(FastMatrix<T>& mat, T val) { return mat.apply_ppl_func([=](T x) {return x - val; }); }
+	FastMatrix<T> operator-(const FastMatrix<T>& mat, T val) { return mat.apply_auto_func(SIMD_SUB, val, [=](T x) {return x - val; }); }
 	template<typename T>
-	FastMatrix<T> operator*(FastMatrix<T>& mat, T val) { return mat.apply_ppl_func([=](T x) {return x * val; }); }
+	FastMatrix<T> operator*(const FastMatrix<T>& mat, T val) { return mat.apply_auto_func(SIMD_MUL, val, [=](T x) {return x * val; }); }
 	template<typename T>
-	FastMatrix<T> operator/(FastMatrix<T>& mat, T val) { return mat.apply_ppl_func([=](T x) {return x / val; }); }
+	FastMatrix<T> operator/(const FastMatrix<T>& mat, T val) { return mat.apply_auto_func(SIMD_DIV, val, [=](T x) {return x / val; }); }
 	template<typename T>
-	FastMatrix<T> operator==(FastMatrix<T>& mat, T val) { return mat.apply_ppl_func([=](T x) {return x == val; }); }
+	FastMatrix<T> operator==(const FastMatrix<T>& mat, T val) { return mat.apply_auto_func(SIMD_EQ, val, [=](T x) {return x == val; }); }
 	template<typename T>
-	FastMatrix<T> operator!=(FastMatrix<T>& mat, T val) { return mat.apply_ppl_func([=](T x) {return x != val; }); }
+	FastMatrix<T> operator!=(const FastMatrix<T>& mat, T val) { return mat.apply_auto_func(SIMD_NE, val, [=](T x) {return x != val; }); }
 	template<typename T>
-	FastMatrix<T> operator>(FastMatrix<T>& mat, T val) { return mat.apply_ppl_func([=](T x) {return x > val; }); }
+	FastMatrix<T> operator>(const FastMatrix<T>& mat, T val) { return mat.apply_auto_func(SIMD_GT, val, [=](T x) {return x > val; }); }
 	template<typename T>
-	FastMatrix<T> operator<(FastMatrix<T>& mat, T val) { return mat.apply_ppl_func([=](T x) {return x < val; }); }
+	FastMatrix<T> operator<(const FastMatrix<T>& mat, T val) { return mat.apply_auto_func(SIMD_LT, val, [=](T x) {return x < val; }); }
 	template<typename T>
-	FastMatrix<T> operator>=(FastMatrix<T>& mat, T val) { return mat.apply_ppl_func([=](T x) {return x >= val; }); }
+	FastMatrix<T> operator>=(const FastMatrix<T>& mat, T val) { return mat.apply_auto_func(SIMD_GE, val, [=](T x) {return x >= val; }); }
 	template<typename T>
-	FastMatrix<T> operator<=(FastMatrix<T>& mat, T val) { return mat.apply_ppl_func([=](T x) {return x <= val; }); }
+	FastMatrix<T> operator<=(const FastMatrix<T>& mat, T val) { return mat.apply_auto_func(SIMD_LE, val, [=](T x) {return x <= val; }); }
 
 #endif
 
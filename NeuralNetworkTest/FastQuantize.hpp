@@ -0,0 +1,419 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+/*
+int8̐Ϙa (AVX-512 VNNI) g邩
+(MSVCVS2019ȍ~ sCPUIDŐ؂ւ)
+*/
+#if defined(FAST_CONTAINER_SIMD_AVX512) && (!defined(_MSC_VER) || _MSC_VER >= 1920)
+	#define FAST_CONTAINER_SIMD_VNNI
+#endif
+#define FAST_CONTAINER_TARGET_VNNI "avx512f,avx512bw,avx512vnni,avx2,fma"
+
+namespace FastContainer {
+
+	/*
+	int8̗ʎq
+	Ώ̗ʎq ([_Ȃ)  x  q * scale, q  [-127, 127]
+	*/
+
+	/*int8̐ϘaɎg*/
+	enum Int8Level {
+		INT8_LEVEL_NONE,
+		INT8_LEVEL_AVX2,
+		INT8_LEVEL_VNNI
+	};
+
+	/*CPUAVX-512 VNNI (AVX-512 BW) ɑΉ邩*/
+	inline bool detect_int8_vnni() {
+#ifdef FAST_CONTAINER_SIMD_VNNI
+		int info[4];
+		simd_cpuid(info, 0, 0);
+		if (info[0] < 7) return false;
+		simd_cpuid(info, 7, 0);
+		return (info[1] & (1 << 30)) != 0 && (info[2] & (1 << 11)) != 0;
+#else
+		return false;
+#endif
+	}
+
+	/*gpint8̐Ϙa (set_simd_level̎wɏ])*/
+	inline Int8Level get_int8_level() {
+		static const bool vnni = detect_int8_vnni();
+		SimdLevel level = get_simd_level();
+		if (level >= SIMD_LEVEL_AVX512 && vnni) return INT8_LEVEL_VNNI;
+		if (level >= SIMD_LEVEL_AVX2) return INT8_LEVEL_AVX2;
+		return INT8_LEVEL_NONE;
+	}
+
+	/*ʎq̍ől*/
+	const int INT8_QUANT_MAX = 127;
+	/*int8̍sς̓ϕ̋E (SIMDŒ[Ȃ悤0Ŗ߂)*/
+	const int INT8_DEPTH_ALIGN = 64;
+
+	/*őΒlXP[߂*/
+	inline float int8_scale(float max_abs) {
+		return max_abs > 0 ? max_abs / INT8_QUANT_MAX : 1.0f;
+	}
+	/*x / scale ۂ߂ [-127, 127] Ɏ߂*/
+	inline int8_t quantize_int8(float x) {
+		float r = std::nearbyint(x);
+		if (r > INT8_QUANT_MAX) r = INT8_QUANT_MAX;
+		if (r < -INT8_QUANT_MAX) r = -INT8_QUANT_MAX;
+		return (int8_t)r;
+	}
+
+	/*
+	int8̍sς̉E (d)
+	depth~column̍s (o̓`l) ̃XP[ŗʎqA]ucolumn~depth_paddedŎ
+	*/
+	struct Int8Weight {
+		int depth_size = 0;
+		int column_size = 0;
+		int depth_padded = 0;
+		FastStorage<int8_t> data;
+		/*񖈂̃XP[*/
+		FastStorage<float> scale;
+		/*񖈂̗ʎql̘a (VNNIōӂ𕄍Ȃɂ炵̕␳)*/
+		FastStorage<int32_t> column_sum;
+
+		template<typename T>
+		static Int8Weight quantize(const FastMatrix<T>& w) {
+			Int8Weight result;
+			int depth = w.get_row_size();
+			int col = w.get_column_size();
+			result.depth_size = depth;
+			result.column_size = col;
+			result.depth_padded = (depth + INT8_DEPTH_ALIGN - 1) / INT8_DEPTH_ALIGN * INT8_DEPTH_ALIGN;
+			result.data.assign((size_t)col * result.depth_padded, 0);
+			result.scale.assign(col, 1.0f);
+			result.column_sum.assign(col, 0);
+			parallel_for_range(0, col, [&](int begin, int end) {
+				for (int j = begin; j < end; j++) {
+					float max_abs = 0;
+					for (int d = 0; d < depth; d++) max_abs = std::max(max_abs, std::fabs((float)(Accumulate<T>)w[d * col + j]));
+					float scale = int8_scale(max_abs);
+					float inv = 1.0f / scale;
+					int8_t *out = &result.data[(size_t)j * result.depth_padded];
+					int32_t sum = 0;
+					for (int d = 0; d < depth; d++) {
+						out[d] = quantize_int8((float)(Accumulate<T>)w[d * col + j] * inv);
+						sum += out[d];
+					}
+					result.scale[j] = scale;
+					result.column_sum[j] = sum;
+				}
+			});
+			return result;
+		}
+	};
+
+	/*ʎqlfloat̕тƂĎo (float͂̂܂܁AȊObuf֕ϊ)*/
+	template<typename T>
+	struct Int8Source {
+		static const float *get(const T *in, std::vector<float>& buf, int size) {
+			buf.resize(size);
+			for (int i = 0; i < size; i++) buf[i] = (float)(Accumulate<T>)in[i];
+			return buf.data();
+		}
+	};
+	template<>
+	struct Int8Source<float> {
+		static const float *get(const float *in, std::vector<float>&, int) { return in; }
+	};
+
+	inline void int8_quantize(const float *in, int8_t *out, int size, float mul);
+
+	/*
+	int8̍sς̍ ()
+	row~depth_paddedŎAŜ1̃XP[
+	*/
+	struct Int8Activation {
+		int row_size = 0;
+		int depth_size = 0;
+		int depth_padded = 0;
+		FastStorage<int8_t> data;
+		float scale = 1.0f;
+
+		/*傫ς (lߕ0ۂ߁A`ς0Ŗߒ)*/
+		void resize(int row, int depth) {
+			if (row == row_size && depth == depth_size) return;
+			row_size = row;
+			depth_size = depth;
+			depth_padded = (depth + INT8_DEPTH_ALIGN - 1) / INT8_DEPTH_ALIGN * INT8_DEPTH_ALIGN;
+			data.assign((size_t)row * depth_padded, 0);
+		}
+		int8_t *row_ptr(int row) { return &data[(size_t)row * depth_padded]; }
+		const int8_t *row_ptr(int row) const { return &data[(size_t)row * depth_padded]; }
+
+		/*xXP[scaleŗʎqď*/
+		template<typename T>
+		void quantize(const FastMatrix<T>& x, float scale) {
+			resize(x.get_row_size(), x.get_column_size());
+			this->scale = scale;
+			float inv = 1.0f / scale;
+			int depth = depth_size;
+			parallel_for_range(0, row_size, [&](int begin, int end) {
+				std::vector<float> buf;
+				for (int i = begin; i < end; i++) {
+					const float *in = Int8Source<T>::get(&x[i * depth], buf, depth);
+					int8_quantize(in, row_ptr(i), depth, inv);
+				}
+			}, std::max(1, SIMD_GRAIN / std::max(1, depth)));
+		}
+	};
+
+	/*
+	int8̓ (a2sw4)
+	a0, a1, w[0..3] ͋lߕ݂depth_paddedvfAʂout0[0..3], out1[0..3]
+	*/
+	inline void int8_dot2x4_scalar(const int8_t *a0, const int8_t *a1, const int8_t *const *w, int depth, int32_t *out0, int32_t *out1) {
+		for (int c = 0; c < 4; c++) {
+			int32_t s0 = 0, s1 = 0;
+			for (int d = 0; d < depth; d++) {
+				s0 += (int32_t)a0[d] * w[c][d];
+				s1 += (int32_t)a1[d] * w[c][d];
+			}
+			out0[c] = s0;
+			out1[c] = s1;
+		}
+	}
+
+	/*(x[i] * mul) ʎq*/
+	inline void int8_quantize_scalar(const float *in, int8_t *out, int size, float mul) {
+		for (int i = 0; i < size; i++) out[i] = quantize_int8(in[i] * mul);
+	}
+	/*max(lower, acc[i] * mul[i] + add[i]) ʎq*/
+	inline void int8_requantize_scalar(const int32_t *acc, const float *mul, const float *add, float lower, int8_t *out, int size) {
+		for (int i = 0; i < size; i++) out[i] = quantize_int8(std::max(lower, acc[i] * mul[i] + add[i]));
+	}
+
+#ifdef FAST_CONTAINER_SIMD_AVX2
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_AVX2)
+
+	inline int32_t int8_hsum_avx2(__m256i x) {
+		__m128i r = _mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+		r = _mm_add_epi32(r, _mm_shuffle_epi32(r, 0x4e));
+		r = _mm_add_epi32(r, _mm_shuffle_epi32(r, 0xb1));
+		return _mm_cvtsi128_si32(r);
+	}
+
+	/*|a| (Ȃ)  a ̕ڂ w ̐ςmaddubsŐϘa
+	ʎql [-127, 127] Ȃ̂ŗׂ荇2̐ς̘a16rbgŖOaAʂ͐m*/
+	inline void int8_dot2x4_avx2(const int8_t *a0, const int8_t *a1, const int8_t *const *w, int depth, int32_t *out0, int32_t *out1) {
+		const __m256i ones = _mm256_set1_epi16(1);
+		const int8_t *w0 = w[0], *w1 = w[1], *w2 = w[2], *w3 = w[3];
+		__m256i s00 = _mm256_setzero_si256(), s01 = _mm256_setzero_si256(), s02 = _mm256_setzero_si256(), s03 = _mm256_setzero_si256();
+		__m256i s10 = _mm256_setzero_si256(), s11 = _mm256_setzero_si256(), s12 = _mm256_setzero_si256(), s13 = _mm256_setzero_si256();
+		for (int d = 0; d < depth; d += 32) {
+			__m256i x0 = _mm256_loadu_si256((const __m256i *)(a0 + d));
+			__m256i x1 = _mm256_loadu_si256((const __m256i *)(a1 + d));
+			__m256i u0 = _mm256_abs_epi8(x0);
+			__m256i u1 = _mm256_abs_epi8(x1);
+			__m256i y = _mm256_loadu_si256((const __m256i *)(w0 + d));
+			s00 = _mm256_add_epi32(s00, _mm256_madd_epi16(_mm256_maddubs_epi16(u0, _mm256_sign_epi8(y, x0)), ones));
+			s10 = _mm256_add_epi32(s10, _mm256_madd_epi16(_mm256_maddubs_epi16(u1, _mm256_sign_epi8(y, x1)), ones));
+			y = _mm256_loadu_si256((const __m256i *)(w1 + d));
+			s01 = _mm256_add_epi32(s01, _mm256_madd_epi16(_mm256_maddubs_epi16(u0, _mm256_sign_epi8(y, x0)), ones));
+			s11 = _mm256_add_epi32(s11, _mm256_madd_epi16(_mm256_maddubs_epi16(u1, _mm256_sign_epi8(y, x1)), ones));
+			y = _mm256_loadu_si256((const __m256i *)(w2 + d));
+			s02 = _mm256_add_epi32(s02, _mm256_madd_epi16(_mm256_maddubs_epi16(u0, _mm256_sign_epi8(y, x0)), ones));
+			s12 = _mm256_add_epi32(s12, _mm256_madd_epi16(_mm256_maddubs_epi16(u1, _mm256_sign_epi8(y, x1)), ones));
+			y = _mm256_loadu_si256((const __m256i *)(w3 + d));
+			s03 = _mm256_add_epi32(s03, _mm256_madd_epi16(_mm256_maddubs_epi16(u0, _mm256_sign_epi8(y, x0)), ones));
+			s13 = _mm256_add_epi32(s13, _mm256_madd_epi16(_mm256_maddubs_epi16(u1, _mm256_sign_epi8(y, x1)), ones));
+		}
+		out0[0] = int8_hsum_avx2(s00);
+		out0[1] = int8_hsum_avx2(s01);
+		out0[2] = int8_hsum_avx2(s02);
+		out0[3] = int8_hsum_avx2(s03);
+		out1[0] = int8_hsum_avx2(s10);
+		out1[1] = int8_hsum_avx2(s11);
+		out1[2] = int8_hsum_avx2(s12);
+		out1[3] = int8_hsum_avx2(s13);
+	}
+
+	/*8vf̕_ [-127, 127] Ɏ߂Ċۂ߁Aint8֋l߂*/
+	inline void int8_store8_avx2(__m256 x, int8_t *out) {
+		x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-(float)INT8_QUANT_MAX)), _mm256_set1_ps((float)INT8_QUANT_MAX));
+		__m256i v = _mm256_cvtps_epi32(x);
+		__m128i p = _mm_packs_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+		_mm_storel_epi64((__m128i *)out, _mm_packs_epi16(p, p));
+	}
+	inline void int8_quantize_avx2(const float *in, int8_t *out, int size, float mul) {
+		__m256 m = _mm256_set1_ps(mul);
+		int i = 0;
+		for (; i + 8 <= size; i += 8) int8_store8_avx2(_mm256_mul_ps(_mm256_loadu_ps(in + i), m), out + i);
+		int8_quantize_scalar(in + i, out + i, size - i, mul);
+	}
+	inline void int8_requantize_avx2(const int32_t *acc, const float *mul, const float *add, float lower, int8_t *out, int size) {
+		__m256 l = _mm256_set1_ps(lower);
+		int i = 0;
+		for (; i + 8 <= size; i += 8) {
+			__m256 x = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)(acc + i)));
+			x = _mm256_fmadd_ps(x, _mm256_loadu_ps(mul + i), _mm256_loadu_ps(add + i));
+			int8_store8_avx2(_mm256_max_ps(x, l), out + i);
+		}
+		int8_requantize_scalar(acc + i, mul + i, add + i, lower, out + i, size - i);
+	}
+
+FAST_CONTAINER_TARGET_END
+#endif
+
+#ifdef FAST_CONTAINER_SIMD_VNNI
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_VNNI)
+
+	/*ӂ128𑫂ĕȂɂAvpdpbusdŐϘa (128 * ̘a͌Ăяoň)*/
+	inline void int8_dot2x4_vnni(const int8_t *a0, const int8_t *a1, const int8_t *const *w, int depth, int32_t *out0, int32_t *out1) {
+		const __m512i bias = _mm512_set1_epi8((char)0x80);
+		const int8_t *w0 = w[0], *w1 = w[1], *w2 = w[2], *w3 = w[3];
+		__m512i s00 = _mm512_setzero_si512(), s01 = _mm512_setzero_si512(), s02 = _mm512_setzero_si512(), s03 = _mm512_setzero_si512();
+		__m512i s10 = _mm512_setzero_si512(), s11 = _mm512_setzero_si512(), s12 = _mm512_setzero_si512(), s13 = _mm512_setzero_si512();
+		for (int d = 0; d < depth; d += 64) {
+			__m512i x0 = _mm512_xor_si512(_mm512_loadu_si512((const void *)(a0 + d)), bias);
+			__m512i x1 = _mm512_xor_si512(_mm512_loadu_si512((const void *)(a1 + d)), bias);
+			__m512i y = _mm512_loadu_si512((const void *)(w0 + d));
+			s00 = _mm512_dpbusd_epi32(s00, x0, y);
+			s10 = _mm512_dpbusd_epi32(s10, x1, y);
+			y = _mm512_loadu_si512((const void *)(w1 + d));
+			s01 = _mm512_dpbusd_epi32(s01, x0, y);
+			s11 = _mm512_dpbusd_epi32(s11, x1, y);
+			y = _mm512_loadu_si512((const void *)(w2 + d));
+			s02 = _mm512_dpbusd_epi32(s02, x0, y);
+			s12 = _mm512_dpbusd_epi32(s12, x1, y);
+			y = _mm512_loadu_si512((const void *)(w3 + d));
+			s03 = _mm512_dpbusd_epi32(s03, x0, y);
+			s13 = _mm512_dpbusd_epi32(s13, x1, y);
+		}
+		out0[0] = _mm512_reduce_add_epi32(s00);
+		out0[1] = _mm512_reduce_add_epi32(s01);
+		out0[2] = _mm512_reduce_add_epi32(s02);
+		out0[3] = _mm512_reduce_add_epi32(s03);
+		out1[0] = _mm512_reduce_add_epi32(s10);
+		out1[1] = _mm512_reduce_add_epi32(s11);
+		out1[2] = _mm512_reduce_add_epi32(s12);
+		out1[3] = _mm512_reduce_add_epi32(s13);
+	}
+
+FAST_CONTAINER_TARGET_END
+#endif
+
+	/*(x[i] * mul) ʎq ؑ*/
+	inline void int8_quantize(const float *in, int8_t *out, int size, float mul) {
+#ifdef FAST_CONTAINER_SIMD_AVX2
+		if (get_simd_level() >= SIMD_LEVEL_AVX2) {
+			int8_quantize_avx2(in, out, size, mul);
+			return;
+		}
+#endif
+		int8_quantize_scalar(in, out, size, mul);
+	}
+	/*max(lower, acc[i] * mul[i] + add[i]) ʎq ؑ*/
+	inline void int8_requantize(const int32_t *acc, const float *mul, const float *add, float lower, int8_t *out, int size) {
+#ifdef FAST_CONTAINER_SIMD_AVX2
+		if (get_simd_level() >= SIMD_LEVEL_AVX2) {
+			int8_requantize_avx2(acc, mul, add, lower, out, size);
+			return;
+		}
+#endif
+		int8_requantize_scalar(acc, mul, add, lower, out, size);
+	}
+
+	/*
+	int8~int8int32̍s
+	a: row~depth, w: depth~column (Int8Weight)
+	epilogue(row, acc): srowint32̌acc[column] 󂯎Č㏈ (ėʎqA֐Ȃ)
+	*/
+	template<class F>
+	void gemm_int8(const Int8Activation& a, const Int8Weight& w, F epilogue) {
+		if (a.depth_size != w.depth_size) throw fast_container_exception();
+		int row = a.row_size;
+		int col = w.column_size;
+		int depth = w.depth_padded;
+		Int8Level level = get_int8_level();
+		//1s̐Ϙả񐔂񉻂̗x߂ (2svẐŋ)
+		int grain = std::max(2, (int)(SIMD_GRAIN * 16 / std::max(1LL, (long long)col * depth)));
+		grain += grain & 1;
+		parallel_for_range(0, row, [&](int begin, int end) {
+			std::vector<int32_t> acc0(col + 4), acc1(col + 4);
+			for (int i = begin; i < end; i += 2) {
+				//[̍s͓s2vZĕЕ̂Ă
+				const int8_t *x0 = a.row_ptr(i);
+				const int8_t *x1 = i + 1 < end ? a.row_ptr(i + 1) : x0;
+				for (int j = 0; j < col; j += 4) {
+					//[̗͐擪̗Ŗ߂ČvZAʂ̂Ă
+					const int8_t *ws[4];
+					for (int c = 0; c < 4; c++) ws[c] = &w.data[(size_t)(j + c < col ? j + c : j) * depth];
+					switch (level) {
+#ifdef FAST_CONTAINER_SIMD_VNNI
+					case INT8_LEVEL_VNNI:
+						int8_dot2x4_vnni(x0, x1, ws, depth, &acc0[j], &acc1[j]);
+						for (int c = j; c < std::min(j + 4, col); c++) {
+							acc0[c] -= 128 * w.column_sum[c];
+							acc1[c] -= 128 * w.column_sum[c];
+						}
+						break;
+#endif
+#ifdef FAST_CONTAINER_SIMD_AVX2
+					case INT8_LEVEL_AVX2:
+						int8_dot2x4_avx2(x0, x1, ws, depth, &acc0[j], &acc1[j]);
+						break;
+#endif
+					default:
+						int8_dot2x4_scalar(x0, x1, ws, depth, &acc0[j], &acc1[j]);
+						break;
+					}
+				}
+				epilogue(i, acc0.data());
+				if (i + 1 < end) epilogue(i + 1, acc1.data());
+			}
+		}, grain);
+	}
+
+	/*
+	ʎqAtBϊ y = xEw + b
+	relu: o͂ReLUZ
+	*/
+	struct Int8Affine {
+		Int8Weight weight;
+		/*o̓`l̉Zl*/
+		FastStorage<float> bias;
+		/*͂̃XP[ (Lu[VŌ߂)*/
+		float input_scale = 1.0f;
+		bool relu = false;
+
+		/*ʂXP[output_scaleōėʎqint8ŏ (̑w̓)*/
+		void forward(const Int8Activation& x, Int8Activation& y, float output_scale) const {
+			int col = weight.column_size;
+			y.resize(x.row_size, col);
+			y.scale = output_scale;
+			FastStorage<float> mul(col);
+			FastStorage<float> add(col);
+			for (int j = 0; j < col; j++) {
+				mul[j] = x.scale * weight.scale[j] / output_scale;
+				add[j] = bias[j] / output_scale;
+			}
+			float lower = relu ? 0.0f : -(float)INT8_QUANT_MAX;
+			gemm_int8(x, weight, [&](int i, const int32_t *acc) {
+				int8_requantize(acc, mul.data(), add.data(), lower, y.row_ptr(i), col);
+			});
+		}
+		/*ʂtʎqTŏ (Ō̑w)*/
+		template<typename T>
+		void forward(const Int8Activation& x, FastMatrix<T>& y) const {
+			int col = weight.column_size;
+			if (y.get_row_size() != x.row_size || y.get_column_size() != col) y.resize(x.row_size, col);
+			FastStorage<float> mul(col);
+			for (int j = 0; j < col; j++) mul[j] = x.scale * weight.scale[j];
+			bool r = relu;
+			gemm_int8(x, weight, [&](int i, const int32_t *acc) {
+				for (int j = 0; j < col; j++) {
+					float v = acc[j] * mul[j] + bias[j];
+					y(i, j) = (T)(r ? std::max(v, 0.0f) : v);
+				}
+			});
+		}
+	};
+
+}
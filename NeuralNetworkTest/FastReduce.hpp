@@ -0,0 +1,209 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	v̌vZ
+	REDUCE_SIMD: SIMDWX^ŗݐ ()
+	REDUCE_PAIRWISE: ėݐ (덷 O(log n))
+	REDUCE_KAHAN: ␳tŗݐ (덷 O(1)Ałx)
+	*/
+	enum ReduceMode {
+		REDUCE_SIMD,
+		REDUCE_PAIRWISE,
+		REDUCE_KAHAN
+	};
+
+	/*1ubN̗vf (ubN̓̕XbhɈˑȂ̂Ōʂ͍Č)*/
+	const int REDUCE_GRAIN = 16384;
+	/*vłȉɂȂ璼ڗݐ*/
+	const int REDUCE_PAIRWISE_BLOCK = 256;
+
+	inline std::atomic<int>& get_reduce_mode_state() {
+		static std::atomic<int> mode((int)REDUCE_SIMD);
+		return mode;
+	}
+
+	/*gp̍v̌vZ*/
+	inline ReduceMode get_reduce_mode() { return (ReduceMode)get_reduce_mode_state().load(std::memory_order_relaxed); }
+
+	/*v̌vZύX*/
+	inline void set_reduce_mode(ReduceMode mode) { get_reduce_mode_state().store((int)mode, std::memory_order_relaxed); }
+
+	/*vݐς^*/
+	template<typename T>
+	using Accumulate = typename AccumulateType<T>::type;
+
+	/*v (SIMDgȂꍇ͏ɗݐ)*/
+	template<typename T>
+	Accumulate<T> reduce_sum_simple(const T *in, int size) {
+		auto kernel = get_simd_kernels<T>().sum;
+		if (kernel != nullptr) return kernel(in, size);
+		Accumulate<T> result = 0;
+		for (int i = 0; i < size; i++) result += in[i];
+		return result;
+	}
+
+	/*␳t̍v (Neumaier@)*/
+	template<typename T>
+	Accumulate<T> reduce_sum_kahan(const T *in, int size) {
+		auto kernel = get_simd_kernels<T>().sum_kahan;
+		if (kernel != nullptr) return kernel(in, size);
+		Accumulate<T> result = 0;
+		Accumulate<T> c = 0;
+		for (int i = 0; i < size; i++) {
+			Accumulate<T> x = in[i];
+			Accumulate<T> t = result + x;
+			if (std::abs(result) >= std::abs(x)) c += (result - t) + x;
+			else c += (x - t) + result;
+			result = t;
+		}
+		return result + c;
+	}
+
+	/*v*/
+	template<typename T>
+	Accumulate<T> reduce_sum_pairwise(const T *in, int size) {
+		if (size <= REDUCE_PAIRWISE_BLOCK) return reduce_sum_simple(in, size);
+		int mid = (size / 2 + 15) & ~15;
+		return reduce_sum_pairwise(in, mid) + reduce_sum_pairwise(in + mid, size - mid);
+	}
+
+	/*1ubN̍v*/
+	template<typename T>
+	Accumulate<T> reduce_sum_block(const T *in, int size, ReduceMode mode) {
+		switch (mode) {
+		case REDUCE_PAIRWISE: return reduce_sum_pairwise(in, size);
+		case REDUCE_KAHAN: return reduce_sum_kahan(in, size);
+		default: return reduce_sum_simple(in, size);
+		}
+	}
+
+	/*ubN̕ʂ؏ɂ܂Ƃ߂*/
+	template<typename T, class F>
+	T reduce_tree(std::vector<T>& partial, F func) {
+		for (size_t width = 1; width < partial.size(); width *= 2) {
+			for (size_t i = 0; i + width < partial.size(); i += width * 2) {
+				partial[i] = func(partial[i], partial[i + width]);
+			}
+		}
+		return partial[0];
+	}
+
+	/*ubNɕŏWvĖ؏ɂ܂Ƃ߂
+	block_func: R(*block_func)(const T *in, int size), combine_func: R(*combine_func)(R x1, R x2)
+	exec: s*/
+	template<typename T, class F, class C, class E>
+	auto reduce_blocks(const T *in, int size, F block_func, C combine_func, E& exec) -> decltype(block_func(in, size)) {
+		using R = decltype(block_func(in, size));
+		if (size <= REDUCE_GRAIN) return block_func(in, size);
+		int block_num = (size + REDUCE_GRAIN - 1) / REDUCE_GRAIN;
+		std::vector<R> partial(block_num);
+		exec.parallel_for_range(0, block_num, [&](int begin, int end) {
+			for (int b = begin; b < end; b++) {
+				int first = b * REDUCE_GRAIN;
+				partial[b] = block_func(in + first, std::min(REDUCE_GRAIN, size - first));
+			}
+		}, 1);
+		return reduce_tree(partial, combine_func);
+	}
+
+	/*v (16rbg_floatŗݐςčŌɊۂ߂)
+	exec: s*/
+	template<typename T, class E>
+	T reduce_sum(const T *in, int size, E& exec, ReduceMode mode = get_reduce_mode()) {
+		using A = Accumulate<T>;
+		if (mode != REDUCE_KAHAN) {
+			return (T)reduce_blocks(in, size, [=](const T *ptr, int n) { return reduce_sum_block(ptr, n, mode); },
+				[](A x1, A x2) { return x1 + x2; }, exec);
+		}
+		/*ʂ␳tł܂Ƃ߂*/
+		if (size <= REDUCE_GRAIN) return (T)reduce_sum_kahan(in, size);
+		int block_num = (size + REDUCE_GRAIN - 1) / REDUCE_GRAIN;
+		std::vector<A> partial(block_num);
+		exec.parallel_for_range(0, block_num, [&](int begin, int end) {
+			for (int b = begin; b < end; b++) {
+				int first = b * REDUCE_GRAIN;
+				partial[b] = reduce_sum_kahan(in + first, std::min(REDUCE_GRAIN, size - first));
+			}
+		}, 1);
+		return (T)reduce_sum_kahan(&partial[0], block_num);
+	}
+
+	/*ŏl
+	exec: s*/
+	template<typename T, class E>
+	T reduce_min(const T *in, int size, E& exec) {
+		if (size <= 0) throw fast_container_exception();
+		return reduce_blocks(in, size, [](const T *ptr, int n) {
+			auto kernel = get_simd_kernels<T>().min;
+			if (kernel != nullptr) return kernel(ptr, n);
+			T result = ptr[0];
+			for (int i = 1; i < n; i++) result = std::min(result, ptr[i]);
+			return result;
+		}, [](T x1, T x2) { return std::min(x1, x2); }, exec);
+	}
+
+	/*ől
+	exec: s*/
+	template<typename T, class E>
+	T reduce_max(const T *in, int size, E& exec) {
+		if (size <= 0) throw fast_container_exception();
+		return reduce_blocks(in, size, [](const T *ptr, int n) {
+			auto kernel = get_simd_kernels<T>().max;
+			if (kernel != nullptr) return kernel(ptr, n);
+			T result = ptr[0];
+			for (int i = 1; i < n; i++) result = std::max(result, ptr[i]);
+			return result;
+		}, [](T x1, T x2) { return std::max(x1, x2); }, exec);
+	}
+
+	/*1ubN̍ől̓Y (ől΍ŏ̂)*/
+	template<typename T>
+	int reduce_argmax_block(const T *in, int size) {
+		auto kernel = get_simd_kernels<T>().max;
+		if (kernel != nullptr) {
+			/*ől߂ĂʒuT (NaN܂ޏꍇ͏ɔr)*/
+			T max = kernel(in, size);
+			if (max == max) {
+				for (int i = 0; i < size; i++) {
+					if (in[i] == max) return i;
+				}
+			}
+		}
+		int result = 0;
+		T max = in[0];
+		for (int i = 1; i < size; i++) {
+			if (max < in[i]) {
+				max = in[i];
+				result = i;
+			}
+		}
+		return result;
+	}
+
+	/*ől̓Y (ől΍ŏ̂)
+	exec: s*/
+	template<typename T, class E>
+	int reduce_argmax(const T *in, int size, E& exec) {
+		if (size <= 0) throw fast_container_exception();
+		if (size <= REDUCE_GRAIN) return reduce_argmax_block(in, size);
+		int block_num = (size + REDUCE_GRAIN - 1) / REDUCE_GRAIN;
+		std::vector<int> partial(block_num);
+		exec.parallel_for_range(0, block_num, [&](int begin, int end) {
+			for (int b = begin; b < end; b++) {
+				int first = b * REDUCE_GRAIN;
+				partial[b] = first + reduce_argmax_block(in + first, std::min(REDUCE_GRAIN, size - first));
+			}
+		}, 1);
+		/*Y̏D悷̂ō珇ɂ܂Ƃ߂*/
+		int result = partial[0];
+		for (int b = 1; b < block_num; b++) {
+			if (in[result] < in[partial[b]]) result = partial[b];
+		}
+		return result;
+	}
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	G|bNPʂ̃~job`̓Y
+	G|bN̎n߂ 0`sample_size - 1 ̏A擪 batch_size n
+	(1G|bNőSTv1񂸂g Ō̃ob`͒[ɂȂ)
+	*/
+	class EpochSampler {
+	public:
+		/*
+		sample_size: Tv
+		batch_size: 1ob`̃Tv
+		sorted: ob`̓Yɕׂ (osO珇ɂȂ)
+		seed: ̎ (Ȃ瓯Ƀob`n)
+		*/
+		EpochSampler(int sample_size, int batch_size, bool sorted = true, uint64_t seed = next_random_seed()) {
+			if (sample_size <= 0 || batch_size <= 0) throw fast_container_exception();
+			this->sample_size = sample_size;
+			this->batch_size = std::min(batch_size, sample_size);
+			this->sorted = sorted;
+			this->seed = seed;
+			permutation.resize(sample_size);
+			shuffle();
+		}
+
+		/*̃ob`̓Y (Ԃ͎̈̌Ăяoŏ㏑ G|bNIΕבւ)*/
+		FastVector<int>& next() {
+			if (position >= sample_size) {
+				epoch++;
+				shuffle();
+			}
+			int count = std::min(batch_size, sample_size - position);
+			if (batch.get_size() != count) batch.resize(count);
+			int *out = batch.get_data();
+			std::copy(permutation.data() + position, permutation.data() + position + count, out);
+			if (sorted) std::sort(out, out + count);
+			position += count;
+			return batch;
+		}
+
+		/*̃G|bN̔ԍ (0)*/
+		int get_epoch() const { return epoch; }
+		/*1G|bÑob`*/
+		int get_batch_count() const { return (sample_size + batch_size - 1) / batch_size; }
+		int get_sample_size() const { return sample_size; }
+		int get_batch_size() const { return batch_size; }
+
+	private:
+		/*̃G|bN̏ (G|bNɕʂ̎)*/
+		void shuffle() {
+			random_permutation(permutation.data(), sample_size, seed + 0x9E3779B97F4A7C15ull * (uint64_t)epoch, ThreadPool::get_instance());
+			position = 0;
+		}
+
+		int sample_size = 0;
+		int batch_size = 0;
+		bool sorted = true;
+		uint64_t seed = 0;
+		int epoch = 0;
+		int position = 0;
+		FastStorage<int> permutation;
+		FastVector<int> batch;
+	};
+
+}
@@ -0,0 +1,672 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+/*
+̃rhŎg閽߃Zbg
+(x86ȂSĎgAsCPUIDŐ؂ւ
+MSVC͑SĂ̖߃Zbg̑gݍ݊֐gBGCC, Clang͖߃Zbg̃J[l
+FAST_CONTAINER_TARGET_BEGIN ` FAST_CONTAINER_TARGET_END ̗̈悩 FAST_CONTAINER_TARGET t֐ɒuA
+̖߃ZbgΏۂɃRpĈŁARpCɖ߃Zbgw肵ȂĂ悢)
+*/
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define FAST_CONTAINER_SIMD_SSE4
+	#define FAST_CONTAINER_SIMD_AVX2
+	#if !defined(_MSC_VER) || _MSC_VER >= 1911
+		#define FAST_CONTAINER_SIMD_AVX512
+	#endif
+#endif
+
+/*
+߃Zbg̃RpCΏ
+FAST_CONTAINER_TARGET(isa): ֐ɕt
+FAST_CONTAINER_TARGET_BEGIN(isa) ` FAST_CONTAINER_TARGET_END: Ԃɒ`֐ (ev[g܂) ΏۂɂȂ
+*/
+#define FAST_CONTAINER_TARGET_SSE4 "sse4.1"
+#define FAST_CONTAINER_TARGET_AVX2 "avx2,fma,f16c"
+#define FAST_CONTAINER_TARGET_AVX512 "avx512f,avx2,fma,f16c"
+#define FAST_CONTAINER_PRAGMA(x) _Pragma(#x)
+#if defined(_MSC_VER) || !defined(FAST_CONTAINER_SIMD_SSE4)
+	#define FAST_CONTAINER_TARGET(isa)
+	#define FAST_CONTAINER_TARGET_BEGIN(isa)
+	#define FAST_CONTAINER_TARGET_END
+#elif defined(__clang__)
+	#define FAST_CONTAINER_TARGET(isa) __attribute__((target(isa)))
+	#define FAST_CONTAINER_TARGET_BEGIN(isa) FAST_CONTAINER_PRAGMA(clang attribute push(__attribute__((target(isa))), apply_to = function))
+	#define FAST_CONTAINER_TARGET_END _Pragma("clang attribute pop")
+#else
+	#define FAST_CONTAINER_TARGET(isa) __attribute__((target(isa)))
+	#define FAST_CONTAINER_TARGET_BEGIN(isa) _Pragma("GCC push_options") FAST_CONTAINER_PRAGMA(GCC target(isa))
+	#define FAST_CONTAINER_TARGET_END _Pragma("GCC pop_options")
+#endif
+
+namespace FastContainer {
+
+	/*SIMD߃Zbg̒iK*/
+	enum SimdLevel {
+		SIMD_LEVEL_NONE,
+		SIMD_LEVEL_SSE4,
+		SIMD_LEVEL_AVX2,
+		SIMD_LEVEL_AVX512,
+		SIMD_LEVEL_NUM
+	};
+
+	/*SIMDPZ*/
+	enum SimdUnaryOp {
+		SIMD_ABS,
+		SIMD_SQRT,
+		SIMD_EXP,
+		SIMD_LOG,
+		SIMD_SIGMOID,
+		SIMD_RELU,
+		SIMD_UNARY_NUM
+	};
+
+	/*SIMD񍀉Z (RSUB, RDIV͍EւZAZ)*/
+	enum SimdBinaryOp {
+		SIMD_ADD,
+		SIMD_SUB,
+		SIMD_RSUB,
+		SIMD_MUL,
+		SIMD_DIV,
+		SIMD_RDIV,
+		SIMD_EQ,
+		SIMD_NE,
+		SIMD_GT,
+		SIMD_LT,
+		SIMD_GE,
+		SIMD_LE,
+		SIMD_BINARY_NUM
+	};
+
+	/*SIMDZ񉻂ŏvf*/
+	const int SIMD_GRAIN = 4096;
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+
+	/*CPUIDs*/
+	inline void simd_cpuid(int info[4], int leaf, int subleaf) {
+#ifdef _MSC_VER
+		__cpuidex(info, leaf, subleaf);
+#else
+		unsigned int a, b, c, d;
+		__cpuid_count(leaf, subleaf, a, b, c, d);
+		info[0] = (int)a;
+		info[1] = (int)b;
+		info[2] = (int)c;
+		info[3] = (int)d;
+#endif
+	}
+
+	/*OSޔ郌WX^̏ (XCR0)*/
+	inline unsigned long long simd_xgetbv() {
+#ifdef _MSC_VER
+		return _xgetbv(0);
+#else
+		unsigned int eax, edx;
+		__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return ((unsigned long long)edx << 32) | eax;
+#endif
+	}
+
+	/*CPUΉ閽߃Zbg*/
+	inline SimdLevel detect_simd_level() {
+		int info[4];
+		simd_cpuid(info, 0, 0);
+		int max_leaf = info[0];
+		if (max_leaf < 1) return SIMD_LEVEL_NONE;
+		simd_cpuid(info, 1, 0);
+		bool sse4 = (info[2] & (1 << 19)) != 0;
+		bool fma = (info[2] & (1 << 12)) != 0;
+		bool f16c = (info[2] & (1 << 29)) != 0;
+		bool avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0;
+		unsigned long long xcr0 = avx ? simd_xgetbv() : 0;
+		bool ymm = (xcr0 & 0x6) == 0x6;
+		bool zmm = (xcr0 & 0xe6) == 0xe6;
+		bool avx2 = false;
+		bool avx512 = false;
+		if (max_leaf >= 7) {
+			simd_cpuid(info, 7, 0);
+			avx2 = (info[1] & (1 << 5)) != 0;
+			avx512 = (info[1] & (1 << 16)) != 0;
+		}
+		if (avx512 && avx2 && fma && f16c && ymm && zmm) return SIMD_LEVEL_AVX512;
+		if (avx2 && fma && f16c && ymm) return SIMD_LEVEL_AVX2;
+		if (sse4) return SIMD_LEVEL_SSE4;
+		return SIMD_LEVEL_NONE;
+	}
+
+#else
+
+	/*CPUΉ閽߃Zbg*/
+	inline SimdLevel detect_simd_level() { return SIMD_LEVEL_NONE; }
+
+#endif
+
+	/*̃rhŎgő̖߃Zbg*/
+	inline SimdLevel get_compiled_simd_level() {
+#if defined FAST_CONTAINER_SIMD_AVX512
+		return SIMD_LEVEL_AVX512;
+#elif defined FAST_CONTAINER_SIMD_AVX2
+		return SIMD_LEVEL_AVX2;
+#elif defined FAST_CONTAINER_SIMD_SSE4
+		return SIMD_LEVEL_SSE4;
+#else
+		return SIMD_LEVEL_NONE;
+#endif
+	}
+
+	/*słő̖߃Zbg*/
+	inline SimdLevel get_supported_simd_level() {
+		static const SimdLevel level = std::min(detect_simd_level(), get_compiled_simd_level());
+		return level;
+	}
+
+	inline std::atomic<int>& get_simd_level_state() {
+		static std::atomic<int> level((int)get_supported_simd_level());
+		return level;
+	}
+
+	/*gp̖߃Zbg*/
+	inline SimdLevel get_simd_level() { return (SimdLevel)get_simd_level_state().load(std::memory_order_relaxed); }
+
+	/*gp閽߃ZbgύX (sł͈͂ɐ)
+	߂l: ۂɎgp閽߃Zbg*/
+	inline SimdLevel set_simd_level(SimdLevel level) {
+		SimdLevel result = std::max(SIMD_LEVEL_NONE, std::min(level, get_supported_simd_level()));
+		get_simd_level_state().store((int)result, std::memory_order_relaxed);
+		return result;
+	}
+
+	/*
+	߃ZbgSIMDWX^
+	reg: WX^, mask: r, width: 1WX^̗vf
+	*/
+	template<typename T>
+	struct SimdSse4;
+	template<typename T>
+	struct SimdAvx2;
+	template<typename T>
+	struct SimdAvx512;
+
+#ifdef FAST_CONTAINER_SIMD_SSE4
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_SSE4)
+
+	template<>
+	struct SimdSse4<double> {
+		using reg = __m128d;
+		using mask = __m128d;
+		static const int width = 2;
+		static reg set1(double x) { return _mm_set1_pd(x); }
+		static reg load(const double *ptr) { return _mm_loadu_pd(ptr); }
+		static void store(double *ptr, reg x) { _mm_storeu_pd(ptr, x); }
+		static reg add(reg x1, reg x2) { return _mm_add_pd(x1, x2); }
+		static reg sub(reg x1, reg x2) { return _mm_sub_pd(x1, x2); }
+		static reg mul(reg x1, reg x2) { return _mm_mul_pd(x1, x2); }
+		static reg div(reg x1, reg x2) { return _mm_div_pd(x1, x2); }
+		static reg fmadd(reg x1, reg x2, reg x3) { return _mm_add_pd(_mm_mul_pd(x1, x2), x3); }
+		static reg min(reg x1, reg x2) { return _mm_min_pd(x1, x2); }
+		static reg max(reg x1, reg x2) { return _mm_max_pd(x1, x2); }
+		static reg sqrt(reg x) { return _mm_sqrt_pd(x); }
+		static reg abs(reg x) { return _mm_andnot_pd(_mm_set1_pd(-0.0), x); }
+		static reg round(reg x) { return _mm_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		static reg floor(reg x) { return _mm_floor_pd(x); }
+		static mask eq(reg x1, reg x2) { return _mm_cmpeq_pd(x1, x2); }
+		static mask ne(reg x1, reg x2) { return _mm_cmpneq_pd(x1, x2); }
+		static mask gt(reg x1, reg x2) { return _mm_cmpgt_pd(x1, x2); }
+		static mask lt(reg x1, reg x2) { return _mm_cmplt_pd(x1, x2); }
+		static mask ge(reg x1, reg x2) { return _mm_cmpge_pd(x1, x2); }
+		static mask le(reg x1, reg x2) { return _mm_cmple_pd(x1, x2); }
+		/*mask ? x1 : x2*/
+		static reg select(mask m, reg x1, reg x2) { return _mm_blendv_pd(x2, x1, m); }
+		/*mask ? 1 : 0*/
+		static reg to_one(mask m) { return _mm_and_pd(m, _mm_set1_pd(1.0)); }
+		/*mask1vf1rbgɋl߂ (vf0ŉʃrbg)*/
+		static uint32_t to_bits(mask m) { return (uint32_t)_mm_movemask_pd(m); }
+		/*1vf1rbgmask*/
+		static mask from_bits(uint32_t bits) {
+			const __m128i lane = _mm_set_epi64x(2, 1);
+			return _mm_castsi128_pd(_mm_cmpeq_epi64(_mm_and_si128(_mm_set1_epi64x(bits), lane), lane));
+		}
+		/*2^n (n͐l)*/
+		static reg pow2n(reg n) {
+			__m128i i = _mm_cvtepi32_epi64(_mm_cvtpd_epi32(n));
+			return _mm_castsi128_pd(_mm_slli_epi64(_mm_add_epi64(i, _mm_set1_epi64x(1023)), 52));
+		}
+		/*x = m * 2^e (m[0.5, 1)) ɕ (x͐̐K)*/
+		static reg frexp(reg x, reg& e) {
+			const __m128d magic = _mm_set1_pd(4503599627370496.0);
+			__m128i bits = _mm_castpd_si128(x);
+			__m128i exp_bits = _mm_or_si128(_mm_srli_epi64(bits, 52), _mm_castpd_si128(magic));
+			e = _mm_sub_pd(_mm_sub_pd(_mm_castsi128_pd(exp_bits), magic), _mm_set1_pd(1022.0));
+			__m128i man_bits = _mm_and_si128(bits, _mm_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+			return _mm_castsi128_pd(_mm_or_si128(man_bits, _mm_set1_epi64x(0x3FE0000000000000LL)));
+		}
+	};
+
+	template<>
+	struct SimdSse4<float> {
+		using reg = __m128;
+		using mask = __m128;
+		static const int width = 4;
+		static reg set1(float x) { return _mm_set1_ps(x); }
+		static reg load(const float *ptr) { return _mm_loadu_ps(ptr); }
+		static void store(float *ptr, reg x) { _mm_storeu_ps(ptr, x); }
+		static reg add(reg x1, reg x2) { return _mm_add_ps(x1, x2); }
+		static reg sub(reg x1, reg x2) { return _mm_sub_ps(x1, x2); }
+		static reg mul(reg x1, reg x2) { return _mm_mul_ps(x1, x2); }
+		static reg div(reg x1, reg x2) { return _mm_div_ps(x1, x2); }
+		static reg fmadd(reg x1, reg x2, reg x3) { return _mm_add_ps(_mm_mul_ps(x1, x2), x3); }
+		static reg min(reg x1, reg x2) { return _mm_min_ps(x1, x2); }
+		static reg max(reg x1, reg x2) { return _mm_max_ps(x1, x2); }
+		static reg sqrt(reg x) { return _mm_sqrt_ps(x); }
+		static reg abs(reg x) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), x); }
+		static reg round(reg x) { return _mm_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		static reg floor(reg x) { return _mm_floor_ps(x); }
+		static mask eq(reg x1, reg x2) { return _mm_cmpeq_ps(x1, x2); }
+		static mask ne(reg x1, reg x2) { return _mm_cmpneq_ps(x1, x2); }
+		static mask gt(reg x1, reg x2) { return _mm_cmpgt_ps(x1, x2); }
+		static mask lt(reg x1, reg x2) { return _mm_cmplt_ps(x1, x2); }
+		static mask ge(reg x1, reg x2) { return _mm_cmpge_ps(x1, x2); }
+		static mask le(reg x1, reg x2) { return _mm_cmple_ps(x1, x2); }
+		/*mask ? x1 : x2*/
+		static reg select(mask m, reg x1, reg x2) { return _mm_blendv_ps(x2, x1, m); }
+		/*mask ? 1 : 0*/
+		static reg to_one(mask m) { return _mm_and_ps(m, _mm_set1_ps(1.0f)); }
+		/*mask1vf1rbgɋl߂ (vf0ŉʃrbg)*/
+		static uint32_t to_bits(mask m) { return (uint32_t)_mm_movemask_ps(m); }
+		/*1vf1rbgmask*/
+		static mask from_bits(uint32_t bits) {
+			const __m128i lane = _mm_set_epi32(8, 4, 2, 1);
+			return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32((int)bits), lane), lane));
+		}
+		/*2^n (n͐l)*/
+		static reg pow2n(reg n) {
+			__m128i i = _mm_cvtps_epi32(n);
+			return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(i, _mm_set1_epi32(127)), 23));
+		}
+		/*x = m * 2^e (m[0.5, 1)) ɕ (x͐̐K)*/
+		static reg frexp(reg x, reg& e) {
+			__m128i bits = _mm_castps_si128(x);
+			e = _mm_sub_ps(_mm_cvtepi32_ps(_mm_srli_epi32(bits, 23)), _mm_set1_ps(126.0f));
+			__m128i man_bits = _mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF));
+			return _mm_castsi128_ps(_mm_or_si128(man_bits, _mm_set1_epi32(0x3F000000)));
+		}
+	};
+
+FAST_CONTAINER_TARGET_END
+#endif
+
+#ifdef FAST_CONTAINER_SIMD_AVX2
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_AVX2)
+
+	template<>
+	struct SimdAvx2<double> {
+		using reg = __m256d;
+		using mask = __m256d;
+		static const int width = 4;
+		static reg set1(double x) { return _mm256_set1_pd(x); }
+		static reg load(const double *ptr) { return _mm256_loadu_pd(ptr); }
+		static void store(double *ptr, reg x) { _mm256_storeu_pd(ptr, x); }
+		static reg add(reg x1, reg x2) { return _mm256_add_pd(x1, x2); }
+		static reg sub(reg x1, reg x2) { return _mm256_sub_pd(x1, x2); }
+		static reg mul(reg x1, reg x2) { return _mm256_mul_pd(x1, x2); }
+		static reg div(reg x1, reg x2) { return _mm256_div_pd(x1, x2); }
+		static reg fmadd(reg x1, reg x2, reg x3) { return _mm256_fmadd_pd(x1, x2, x3); }
+		static reg min(reg x1, reg x2) { return _mm256_min_pd(x1, x2); }
+		static reg max(reg x1, reg x2) { return _mm256_max_pd(x1, x2); }
+		static reg sqrt(reg x) { return _mm256_sqrt_pd(x); }
+		static reg abs(reg x) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x); }
+		static reg round(reg x) { return _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		static reg floor(reg x) { return _mm256_floor_pd(x); }
+		static mask eq(reg x1, reg x2) { return _mm256_cmp_pd(x1, x2, _CMP_EQ_OQ); }
+		static mask ne(reg x1, reg x2) { return _mm256_cmp_pd(x1, x2, _CMP_NEQ_UQ); }
+		static mask gt(reg x1, reg x2) { return _mm256_cmp_pd(x1, x2, _CMP_GT_OQ); }
+		static mask lt(reg x1, reg x2) { return _mm256_cmp_pd(x1, x2, _CMP_LT_OQ); }
+		static mask ge(reg x1, reg x2) { return _mm256_cmp_pd(x1, x2, _CMP_GE_OQ); }
+		static mask le(reg x1, reg x2) { return _mm256_cmp_pd(x1, x2, _CMP_LE_OQ); }
+		/*mask ? x1 : x2*/
+		static reg select(mask m, reg x1, reg x2) { return _mm256_blendv_pd(x2, x1, m); }
+		/*mask ? 1 : 0*/
+		static reg to_one(mask m) { return _mm256_and_pd(m, _mm256_set1_pd(1.0)); }
+		/*mask1vf1rbgɋl߂ (vf0ŉʃrbg)*/
+		static uint32_t to_bits(mask m) { return (uint32_t)_mm256_movemask_pd(m); }
+		/*1vf1rbgmask*/
+		static mask from_bits(uint32_t bits) {
+			const __m256i lane = _mm256_set_epi64x(8, 4, 2, 1);
+			return _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(bits), lane), lane));
+		}
+		/*2^n (n͐l)*/
+		static reg pow2n(reg n) {
+			__m256i i = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(n));
+			return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(i, _mm256_set1_epi64x(1023)), 52));
+		}
+		/*x = m * 2^e (m[0.5, 1)) ɕ (x͐̐K)*/
+		static reg frexp(reg x, reg& e) {
+			const __m256d magic = _mm256_set1_pd(4503599627370496.0);
+			__m256i bits = _mm256_castpd_si256(x);
+			__m256i exp_bits = _mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(magic));
+			e = _mm256_sub_pd(_mm256_sub_pd(_mm256_castsi256_pd(exp_bits), magic), _mm256_set1_pd(1022.0));
+			__m256i man_bits = _mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+			return _mm256_castsi256_pd(_mm256_or_si256(man_bits, _mm256_set1_epi64x(0x3FE0000000000000LL)));
+		}
+	};
+
+	template<>
+	struct SimdAvx2<float> {
+		using reg = __m256;
+		using mask = __m256;
+		static const int width = 8;
+		static reg set1(float x) { return _mm256_set1_ps(x); }
+		static reg load(const float *ptr) { return _mm256_loadu_ps(ptr); }
+		static void store(float *ptr, reg x) { _mm256_storeu_ps(ptr, x); }
+		static reg add(reg x1, reg x2) { return _mm256_add_ps(x1, x2); }
+		static reg sub(reg x1, reg x2) { return _mm256_sub_ps(x1, x2); }
+		static reg mul(reg x1, reg x2) { return _mm256_mul_ps(x1, x2); }
+		static reg div(reg x1, reg x2) { return _mm256_div_ps(x1, x2); }
+		static reg fmadd(reg x1, reg x2, reg x3) { return _mm256_fmadd_ps(x1, x2, x3); }
+		static reg min(reg x1, reg x2) { return _mm256_min_ps(x1, x2); }
+		static reg max(reg x1, reg x2) { return _mm256_max_ps(x1, x2); }
+		static reg sqrt(reg x) { return _mm256_sqrt_ps(x); }
+		static reg abs(reg x) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x); }
+		static reg round(reg x) { return _mm256_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		static reg floor(reg x) { return _mm256_floor_ps(x); }
+		static mask eq(reg x1, reg x2) { return _mm256_cmp_ps(x1, x2, _CMP_EQ_OQ); }
+		static mask ne(reg x1, reg x2) { return _mm256_cmp_ps(x1, x2, _CMP_NEQ_UQ); }
+		static mask gt(reg x1, reg x2) { return _mm256_cmp_ps(x1, x2, _CMP_GT_OQ); }
+		static mask lt(reg x1, reg x2) { return _mm256_cmp_ps(x1, x2, _CMP_LT_OQ); }
+		static mask ge(reg x1, reg x2) { return _mm256_cmp_ps(x1, x2, _CMP_GE_OQ); }
+		static mask le(reg x1, reg x2) { return _mm256_cmp_ps(x1, x2, _CMP_LE_OQ); }
+		/*mask ? x1 : x2*/
+		static reg select(mask m, reg x1, reg x2) { return _mm256_blendv_ps(x2, x1, m); }
+		/*mask ? 1 : 0*/
+		static reg to_one(mask m) { return _mm256_and_ps(m, _mm256_set1_ps(1.0f)); }
+		/*mask1vf1rbgɋl߂ (vf0ŉʃrbg)*/
+		static uint32_t to_bits(mask m) { return (uint32_t)_mm256_movemask_ps(m); }
+		/*1vf1rbgmask*/
+		static mask from_bits(uint32_t bits) {
+			const __m256i lane = _mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+			return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32((int)bits), lane), lane));
+		}
+		/*2^n (n͐l)*/
+		static reg pow2n(reg n) {
+			__m256i i = _mm256_cvtps_epi32(n);
+			return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(i, _mm256_set1_epi32(127)), 23));
+		}
+		/*x = m * 2^e (m[0.5, 1)) ɕ (x͐̐K)*/
+		static reg frexp(reg x, reg& e) {
+			__m256i bits = _mm256_castps_si256(x);
+			e = _mm256_sub_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(bits, 23)), _mm256_set1_ps(126.0f));
+			__m256i man_bits = _mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF));
+			return _mm256_castsi256_ps(_mm256_or_si256(man_bits, _mm256_set1_epi32(0x3F000000)));
+		}
+	};
+
+FAST_CONTAINER_TARGET_END
+#endif
+
+#ifdef FAST_CONTAINER_SIMD_AVX512
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_AVX512)
+
+	template<>
+	struct SimdAvx512<double> {
+		using reg = __m512d;
+		using mask = __mmask8;
+		static const int width = 8;
+		/*Svf̃}XN (GCC 12̓}XN̑gݍ݊֐Ŏg_mm512_undefined_*𖢏ƌx̂ŁA
+		[߂̃}XNt̔łɑSvf̃}XNn)*/
+		static const mask all = (mask)-1;
+		static reg set1(double x) { return _mm512_set1_pd(x); }
+		static reg load(const double *ptr) { return _mm512_loadu_pd(ptr); }
+		static void store(double *ptr, reg x) { _mm512_storeu_pd(ptr, x); }
+		static reg add(reg x1, reg x2) { return _mm512_add_pd(x1, x2); }
+		static reg sub(reg x1, reg x2) { return _mm512_sub_pd(x1, x2); }
+		static reg mul(reg x1, reg x2) { return _mm512_mul_pd(x1, x2); }
+		static reg div(reg x1, reg x2) { return _mm512_div_pd(x1, x2); }
+		static reg fmadd(reg x1, reg x2, reg x3) { return _mm512_fmadd_pd(x1, x2, x3); }
+		static reg min(reg x1, reg x2) { return _mm512_maskz_min_pd(all, x1, x2); }
+		static reg max(reg x1, reg x2) { return _mm512_maskz_max_pd(all, x1, x2); }
+		static reg sqrt(reg x) { return _mm512_maskz_sqrt_pd(all, x); }
+		static reg abs(reg x) { return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(x), _mm512_set1_epi64(0x7FFFFFFFFFFFFFFFLL))); }
+		static reg round(reg x) { return _mm512_maskz_roundscale_pd(all, x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		static reg floor(reg x) { return _mm512_maskz_roundscale_pd(all, x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+		static mask eq(reg x1, reg x2) { return _mm512_cmp_pd_mask(x1, x2, _CMP_EQ_OQ); }
+		static mask ne(reg x1, reg x2) { return _mm512_cmp_pd_mask(x1, x2, _CMP_NEQ_UQ); }
+		static mask gt(reg x1, reg x2) { return _mm512_cmp_pd_mask(x1, x2, _CMP_GT_OQ); }
+		static mask lt(reg x1, reg x2) { return _mm512_cmp_pd_mask(x1, x2, _CMP_LT_OQ); }
+		static mask ge(reg x1, reg x2) { return _mm512_cmp_pd_mask(x1, x2, _CMP_GE_OQ); }
+		static mask le(reg x1, reg x2) { return _mm512_cmp_pd_mask(x1, x2, _CMP_LE_OQ); }
+		/*mask ? x1 : x2*/
+		static reg select(mask m, reg x1, reg x2) { return _mm512_mask_blend_pd(m, x2, x1); }
+		/*mask ? 1 : 0*/
+		static reg to_one(mask m) { return _mm512_maskz_mov_pd(m, _mm512_set1_pd(1.0)); }
+		/*mask1vf1rbgɋl߂ (vf0ŉʃrbg)*/
+		static uint32_t to_bits(mask m) { return (uint32_t)m; }
+		/*1vf1rbgmask*/
+		static mask from_bits(uint32_t bits) { return (mask)bits; }
+		/*2^n (n͐l)*/
+		static reg pow2n(reg n) {
+			__m512i i = _mm512_maskz_cvtepi32_epi64(all, _mm512_maskz_cvtpd_epi32(all, n));
+			return _mm512_castsi512_pd(_mm512_maskz_slli_epi64(all, _mm512_add_epi64(i, _mm512_set1_epi64(1023)), 52));
+		}
+		/*x = m * 2^e (m[0.5, 1)) ɕ (x͐̐K)*/
+		static reg frexp(reg x, reg& e) {
+			const __m512d magic = _mm512_set1_pd(4503599627370496.0);
+			__m512i bits = _mm512_castpd_si512(x);
+			__m512i exp_bits = _mm512_or_si512(_mm512_maskz_srli_epi64(all, bits, 52), _mm512_castpd_si512(magic));
+			e = _mm512_sub_pd(_mm512_sub_pd(_mm512_castsi512_pd(exp_bits), magic), _mm512_set1_pd(1022.0));
+			__m512i man_bits = _mm512_and_si512(bits, _mm512_set1_epi64(0x000FFFFFFFFFFFFFLL));
+			return _mm512_castsi512_pd(_mm512_or_si512(man_bits, _mm512_set1_epi64(0x3FE0000000000000LL)));
+		}
+	};
+
+	template<>
+	struct SimdAvx512<float> {
+		using reg = __m512;
+		using mask = __mmask16;
+		static const int width = 16;
+		/*Svf̃}XN (SimdAvx512<double>ƓRŃ[߂̃}XNt̔łɓn)*/
+		static const mask all = (mask)-1;
+		static reg set1(float x) { return _mm512_set1_ps(x); }
+		static reg load(const float *ptr) { return _mm512_loadu_ps(ptr); }
+		static void store(float *ptr, reg x) { _mm512_storeu_ps(ptr, x); }
+		static reg add(reg x1, reg x2) { return _mm512_add_ps(x1, x2); }
+		static reg sub(reg x1, reg x2) { return _mm512_sub_ps(x1, x2); }
+		static reg mul(reg x1, reg x2) { return _mm512_mul_ps(x1, x2); }
+		static reg div(reg x1, reg x2) { return _mm512_div_ps(x1, x2); }
+		static reg fmadd(reg x1, reg x2, reg x3) { return _mm512_fmadd_ps(x1, x2, x3); }
+		static reg min(reg x1, reg x2) { return _mm512_maskz_min_ps(all, x1, x2); }
+		static reg max(reg x1, reg x2) { return _mm512_maskz_max_ps(all, x1, x2); }
+		static reg sqrt(reg x) { return _mm512_maskz_sqrt_ps(all, x); }
+		static reg abs(reg x) { return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32(0x7FFFFFFF))); }
+		static reg round(reg x) { return _mm512_maskz_roundscale_ps(all, x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		static reg floor(reg x) { return _mm512_maskz_roundscale_ps(all, x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+		static mask eq(reg x1, reg x2) { return _mm512_cmp_ps_mask(x1, x2, _CMP_EQ_OQ); }
+		static mask ne(reg x1, reg x2) { return _mm512_cmp_ps_mask(x1, x2, _CMP_NEQ_UQ); }
+		static mask gt(reg x1, reg x2) { return _mm512_cmp_ps_mask(x1, x2, _CMP_GT_OQ); }
+		static mask lt(reg x1, reg x2) { return _mm512_cmp_ps_mask(x1, x2, _CMP_LT_OQ); }
+		static mask ge(reg x1, reg x2) { return _mm512_cmp_ps_mask(x1, x2, _CMP_GE_OQ); }
+		static mask le(reg x1, reg x2) { return _mm512_cmp_ps_mask(x1, x2, _CMP_LE_OQ); }
+		/*mask ? x1 : x2*/
+		static reg select(mask m, reg x1, reg x2) { return _mm512_mask_blend_ps(m, x2, x1); }
+		/*mask ? 1 : 0*/
+		static reg to_one(mask m) { return _mm512_maskz_mov_ps(m, _mm512_set1_ps(1.0f)); }
+		/*mask1vf1rbgɋl߂ (vf0ŉʃrbg)*/
+		static uint32_t to_bits(mask m) { return (uint32_t)m; }
+		/*1vf1rbgmask*/
+		static mask from_bits(uint32_t bits) { return (mask)bits; }
+		/*2^n (n͐l)*/
+		static reg pow2n(reg n) {
+			__m512i i = _mm512_maskz_cvtps_epi32(all, n);
+			return _mm512_castsi512_ps(_mm512_maskz_slli_epi32(all, _mm512_add_epi32(i, _mm512_set1_epi32(127)), 23));
+		}
+		/*x = m * 2^e (m[0.5, 1)) ɕ (x͐̐K)*/
+		static reg frexp(reg x, reg& e) {
+			__m512i bits = _mm512_castps_si512(x);
+			e = _mm512_sub_ps(_mm512_maskz_cvtepi32_ps(all, _mm512_maskz_srli_epi32(all, bits, 23)), _mm512_set1_ps(126.0f));
+			__m512i man_bits = _mm512_and_si512(bits, _mm512_set1_epi32(0x007FFFFF));
+			return _mm512_castsi512_ps(_mm512_or_si512(man_bits, _mm512_set1_epi32(0x3F000000)));
+		}
+	};
+
+FAST_CONTAINER_TARGET_END
+#endif
+
+	/*vݐς^ (16rbg_floatŗݐς)*/
+	template<typename T>
+	struct AccumulateType { using type = T; };
+
+	/*߃Zbg̃J[l̕\ (gȂꍇnullptr)*/
+	template<typename T>
+	struct SimdKernelTable {
+		SimdLevel level = SIMD_LEVEL_NONE;
+		void(*unary[SIMD_UNARY_NUM])(const T *in, T *out, int size) = {};
+		void(*binary[SIMD_BINARY_NUM])(const T *x1, const T *x2, T *out, int size) = {};
+		void(*binary_scalar[SIMD_BINARY_NUM])(const T *x1, const T *x2, T *out, int size) = {};
+		typename AccumulateType<T>::type(*sum)(const T *in, int size) = nullptr;
+		typename AccumulateType<T>::type(*sum_kahan)(const T *in, int size) = nullptr;
+		T(*min)(const T *in, int size) = nullptr;
+		T(*max)(const T *in, int size) = nullptr;
+		void(*axpy)(T alpha, const T *x, T *y, int size) = nullptr;
+		void(*gemm)(int kc, const T *a, const T *b, T *tile) = nullptr;
+		void(*gemm_epilogue)(const GemmEpilogue<T>& epilogue, int i, int j, int count, const T *in, T *out, bool accumulate) = nullptr;
+		void(*relu_mask)(const T *in, const T *slopes, T slope, T *out, uint64_t *bits, int count) = nullptr;
+		void(*relu_mask_backward)(const T *grad, const T *slopes, T slope, const uint64_t *bits, T *out, int count) = nullptr;
+	};
+
+	/*߃Zbg̃J[l (Sse4Kernels, Avx2Kernels, Avx512Kernels)*/
+#define FAST_CONTAINER_SIMD_KERNELS "FastSimdKernels.hpp"
+#include "FastSimdTarget.hpp"
+#undef FAST_CONTAINER_SIMD_KERNELS
+
+	/*߃ZbgɑΉJ[l̕\쐬 (float, doubleȊO͋)*/
+	template<typename T>
+	struct SimdKernelFactory {
+		static SimdKernelTable<T> create(SimdLevel level) { return SimdKernelTable<T>(); }
+	};
+	template<typename T>
+	struct SimdFloatingKernelFactory {
+		static SimdKernelTable<T> create(SimdLevel level) {
+			SimdKernelTable<T> table;
+			auto unary = std::make_integer_sequence<int, SIMD_UNARY_NUM>();
+			auto binary = std::make_integer_sequence<int, SIMD_BINARY_NUM>();
+#ifdef FAST_CONTAINER_SIMD_AVX512
+			if (level >= SIMD_LEVEL_AVX512) {
+				Avx512Kernels::register_simd_kernels<SimdAvx512<T>>(table, SIMD_LEVEL_AVX512, unary, binary);
+				return table;
+			}
+#endif
+#ifdef FAST_CONTAINER_SIMD_AVX2
+			if (level >= SIMD_LEVEL_AVX2) {
+				Avx2Kernels::register_simd_kernels<SimdAvx2<T>>(table, SIMD_LEVEL_AVX2, unary, binary);
+				return table;
+			}
+#endif
+#ifdef FAST_CONTAINER_SIMD_SSE4
+			if (level >= SIMD_LEVEL_SSE4) {
+				Sse4Kernels::register_simd_kernels<SimdSse4<T>>(table, SIMD_LEVEL_SSE4, unary, binary);
+				return table;
+			}
+#endif
+			return table;
+		}
+	};
+	template<>
+	struct SimdKernelFactory<double> :public SimdFloatingKernelFactory<double> { };
+	template<>
+	struct SimdKernelFactory<float> :public SimdFloatingKernelFactory<float> { };
+
+	/*gp̖߃Zbg̃J[l̕\ (߃Zbgɏ񂾂쐬)*/
+	template<typename T>
+	const SimdKernelTable<T>& get_simd_kernels() {
+		static const SimdKernelTable<T> tables[SIMD_LEVEL_NUM] = {
+			SimdKernelFactory<T>::create(SIMD_LEVEL_NONE),
+			SimdKernelFactory<T>::create(SIMD_LEVEL_SSE4),
+			SimdKernelFactory<T>::create(SIMD_LEVEL_AVX2),
+			SimdKernelFactory<T>::create(SIMD_LEVEL_AVX512)
+		};
+		return tables[get_simd_level()];
+	}
+
+	/*T^SIMDJ[lg邩*/
+	template<typename T>
+	bool is_simd_enabled() { return get_simd_kernels<T>().level != SIMD_LEVEL_NONE; }
+
+	/*sς̃Gs[ÕJ[l float, double SIMD (߃ZbggȂ΃XJ[)*/
+	template<typename T>
+	struct GemmEpilogueFloatingKernel {
+		using func = void(*)(const GemmEpilogue<T>& epilogue, int i, int j, int count, const T *in, T *out, bool accumulate);
+		static func get() {
+			auto kernel = get_simd_kernels<T>().gemm_epilogue;
+			return kernel != nullptr ? kernel : &gemm_epilogue_scalar<T>;
+		}
+	};
+	template<>
+	struct GemmEpilogueKernel<double> :public GemmEpilogueFloatingKernel<double> { };
+	template<>
+	struct GemmEpilogueKernel<float> :public GemmEpilogueFloatingKernel<float> { };
+
+	/*sς̃}CNJ[l float, double SIMD (߃ZbggȂ΃XJ[)*/
+	template<typename T>
+	struct GemmMicroFloatingKernel {
+		using func = void(*)(int kc, const T *a, const T *b, T *tile);
+		static func get() {
+			auto kernel = get_simd_kernels<T>().gemm;
+			return kernel != nullptr ? kernel : &GemmKernel<T>::run;
+		}
+	};
+	template<>
+	struct GemmMicroKernel<double> :public GemmMicroFloatingKernel<double> { };
+	template<>
+	struct GemmMicroKernel<float> :public GemmMicroFloatingKernel<float> { };
+
+	/*ReLUñ}XÑJ[l float, double SIMD (߃ZbggȂ΃XJ[)*/
+	template<typename T>
+	struct ReluMaskFloatingKernel {
+		using forward_func = void(*)(const T *in, const T *slopes, T slope, T *out, uint64_t *bits, int count);
+		using backward_func = void(*)(const T *grad, const T *slopes, T slope, const uint64_t *bits, T *out, int count);
+		static forward_func get_forward() {
+			auto kernel = get_simd_kernels<T>().relu_mask;
+			return kernel != nullptr ? kernel : &relu_mask_scalar<T>;
+		}
+		static backward_func get_backward() {
+			auto kernel = get_simd_kernels<T>().relu_mask_backward;
+			return kernel != nullptr ? kernel : &relu_mask_backward_scalar<T>;
+		}
+	};
+	template<>
+	struct ReluMaskKernel<double> :public ReluMaskFloatingKernel<double> { };
+	template<>
+	struct ReluMaskKernel<float> :public ReluMaskFloatingKernel<float> { };
+
+	/*vf̒PZSIMDŎs (gȂꍇfalse)
+	exec: s*/
+	template<typename T, class E>
+	bool simd_unary(SimdUnaryOp op, const T *in, T *out, int size, E& exec) {
+		auto kernel = get_simd_kernels<T>().unary[op];
+		if (kernel == nullptr) return false;
+		exec.parallel_for_range(0, size, [&](int begin, int end) { kernel(in + begin, out + begin, end - begin); }, SIMD_GRAIN);
+		return true;
+	}
+
+	/*vf̓񍀉ZSIMDŎs (gȂꍇfalse)
+	exec: s*/
+	template<typename T, class E>
+	bool simd_binary(SimdBinaryOp op, const T *x1, const T *x2, T *out, int size, E& exec) {
+		auto kernel = get_simd_kernels<T>().binary[op];
+		if (kernel == nullptr) return false;
+		exec.parallel_for_range(0, size, [&](int begin, int end) { kernel(x1 + begin, x2 + begin, out + begin, end - begin); }, SIMD_GRAIN);
+		return true;
+	}
+
+	/*vfƃXJ[l̓񍀉ZSIMDŎs (gȂꍇfalse)
+	exec: s*/
+	template<typename T, class E>
+	bool simd_binary_scalar(SimdBinaryOp op, const T *x1, T x2, T *out, int size, E& exec) {
+		auto kernel = get_simd_kernels<T>().binary_scalar[op];
+		if (kernel == nullptr) return false;
+		exec.parallel_for_range(0, size, [&](int begin, int end) { kernel(x1 + begin, &x2, out + begin, end - begin); }, SIMD_GRAIN);
+		return true;
+	}
+
+}
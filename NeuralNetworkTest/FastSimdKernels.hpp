@@ -0,0 +1,480 @@
+/*
+߃ZbgSIMDJ[l (FastSimd.hpp 疽߃ZbgɎ荞 #pragma once Ȃ)
+S: ߃Zbg̃WX^ (荞ޖOԂ̖߃Zbĝ)
+*/
+
+	/*
+	SIMDŌvZ鏉֐ (Cephes̑ߎ)
+	S: ߃Zbg̃WX^
+	*/
+	template<class S, typename T>
+	struct SimdFunction;
+
+	template<class S>
+	struct SimdFunction<S, double> {
+		using reg = typename S::reg;
+		/*e^x*/
+		static reg exp(reg x) {
+			const reg max_x = S::set1(709.782712893384);
+			const reg min_x = S::set1(-745.1332191019412);
+			reg xc = S::min(S::max(x, min_x), max_x);
+			//x = n * log(2) + r
+			reg n = S::round(S::mul(xc, S::set1(1.4426950408889634073599)));
+			reg r = S::fmadd(n, S::set1(-6.93145751953125E-1), xc);
+			r = S::fmadd(n, S::set1(-1.42860682030941723212E-6), r);
+			reg rr = S::mul(r, r);
+			reg px = S::fmadd(S::set1(1.26177193074810590878E-4), rr, S::set1(3.02994407707441961300E-2));
+			px = S::fmadd(px, rr, S::set1(9.99999999999999999910E-1));
+			px = S::mul(px, r);
+			reg qx = S::fmadd(S::set1(3.00198505138664455042E-6), rr, S::set1(2.52448340349684104192E-3));
+			qx = S::fmadd(qx, rr, S::set1(2.27265548208155028766E-1));
+			qx = S::fmadd(qx, rr, S::set1(2.00000000000000000009E0));
+			reg y = S::div(px, S::sub(qx, px));
+			y = S::fmadd(y, S::set1(2.0), S::set1(1.0));
+			//2^nꂵȂ悤2ɕĊ|
+			reg n1 = S::floor(S::mul(n, S::set1(0.5)));
+			y = S::mul(S::mul(y, S::pow2n(n1)), S::pow2n(S::sub(n, n1)));
+			y = S::select(S::gt(x, max_x), S::set1(std::numeric_limits<double>::infinity()), y);
+			y = S::select(S::lt(x, min_x), S::set1(0.0), y);
+			return S::select(S::ne(x, x), x, y);
+		}
+		/*log e*/
+		static reg log(reg x) {
+			//񐳋K2^54{Ďw␳
+			reg tiny = S::to_one(S::lt(x, S::set1(std::numeric_limits<double>::min())));
+			reg xs = S::mul(x, S::fmadd(tiny, S::set1(18014398509481984.0 - 1.0), S::set1(1.0)));
+			reg e;
+			reg m = S::frexp(xs, e);
+			e = S::fmadd(tiny, S::set1(-54.0), e);
+			//m[sqrt(1/2), sqrt(2)) 
+			auto small = S::lt(m, S::set1(0.70710678118654752440));
+			e = S::sub(e, S::to_one(small));
+			reg z = S::sub(S::add(m, S::select(small, m, S::set1(0.0))), S::set1(1.0));
+			reg zz = S::mul(z, z);
+			reg p = S::fmadd(S::set1(1.01875663804580931796E-4), z, S::set1(4.97494994976747001425E-1));
+			p = S::fmadd(p, z, S::set1(4.70579119878881725854E0));
+			p = S::fmadd(p, z, S::set1(1.44989225341610930846E1));
+			p = S::fmadd(p, z, S::set1(1.79368678507819816313E1));
+			p = S::fmadd(p, z, S::set1(7.70838733755885391666E0));
+			reg q = S::add(z, S::set1(1.12873587189167450590E1));
+			q = S::fmadd(q, z, S::set1(4.52279145837532221105E1));
+			q = S::fmadd(q, z, S::set1(8.29875266912776603211E1));
+			q = S::fmadd(q, z, S::set1(7.11544750618563894466E1));
+			q = S::fmadd(q, z, S::set1(2.31251620126765340583E1));
+			reg y = S::mul(z, S::div(S::mul(zz, p), q));
+			y = S::fmadd(e, S::set1(-2.121944400546905827679e-4), y);
+			y = S::fmadd(zz, S::set1(-0.5), y);
+			y = S::add(z, y);
+			y = S::fmadd(e, S::set1(0.693359375), y);
+			y = S::select(S::eq(x, S::set1(std::numeric_limits<double>::infinity())), x, y);
+			y = S::select(S::eq(x, S::set1(0.0)), S::set1(-std::numeric_limits<double>::infinity()), y);
+			return S::select(S::ge(x, S::set1(0.0)), y, S::set1(std::numeric_limits<double>::quiet_NaN()));
+		}
+	};
+
+	template<class S>
+	struct SimdFunction<S, float> {
+		using reg = typename S::reg;
+		/*e^x*/
+		static reg exp(reg x) {
+			const reg max_x = S::set1(88.72283905206835f);
+			const reg min_x = S::set1(-103.972077083991796f);
+			reg xc = S::min(S::max(x, min_x), max_x);
+			//x = n * log(2) + r
+			reg n = S::round(S::mul(xc, S::set1(1.44269504088896341f)));
+			reg r = S::fmadd(n, S::set1(-0.693359375f), xc);
+			r = S::fmadd(n, S::set1(2.12194440e-4f), r);
+			reg rr = S::mul(r, r);
+			reg y = S::fmadd(S::set1(1.9875691500E-4f), r, S::set1(1.3981999507E-3f));
+			y = S::fmadd(y, r, S::set1(8.3334519073E-3f));
+			y = S::fmadd(y, r, S::set1(4.1665795894E-2f));
+			y = S::fmadd(y, r, S::set1(1.6666665459E-1f));
+			y = S::fmadd(y, r, S::set1(5.0000001201E-1f));
+			y = S::fmadd(y, rr, S::add(r, S::set1(1.0f)));
+			//2^nꂵȂ悤2ɕĊ|
+			reg n1 = S::floor(S::mul(n, S::set1(0.5f)));
+			y = S::mul(S::mul(y, S::pow2n(n1)), S::pow2n(S::sub(n, n1)));
+			y = S::select(S::gt(x, max_x), S::set1(std::numeric_limits<float>::infinity()), y);
+			y = S::select(S::lt(x, min_x), S::set1(0.0f), y);
+			return S::select(S::ne(x, x), x, y);
+		}
+		/*log e*/
+		static reg log(reg x) {
+			//񐳋K2^25{Ďw␳
+			reg tiny = S::to_one(S::lt(x, S::set1(std::numeric_limits<float>::min())));
+			reg xs = S::mul(x, S::fmadd(tiny, S::set1(33554432.0f - 1.0f), S::set1(1.0f)));
+			reg e;
+			reg m = S::frexp(xs, e);
+			e = S::fmadd(tiny, S::set1(-25.0f), e);
+			//m[sqrt(1/2), sqrt(2)) 
+			auto small = S::lt(m, S::set1(0.707106781186547524f));
+			e = S::sub(e, S::to_one(small));
+			reg z = S::sub(S::add(m, S::select(small, m, S::set1(0.0f))), S::set1(1.0f));
+			reg zz = S::mul(z, z);
+			reg y = S::fmadd(S::set1(7.0376836292E-2f), z, S::set1(-1.1514610310E-1f));
+			y = S::fmadd(y, z, S::set1(1.1676998740E-1f));
+			y = S::fmadd(y, z, S::set1(-1.2420140846E-1f));
+			y = S::fmadd(y, z, S::set1(1.4249322787E-1f));
+			y = S::fmadd(y, z, S::set1(-1.6668057665E-1f));
+			y = S::fmadd(y, z, S::set1(2.0000714765E-1f));
+			y = S::fmadd(y, z, S::set1(-2.4999993993E-1f));
+			y = S::fmadd(y, z, S::set1(3.3333331174E-1f));
+			y = S::mul(S::mul(y, z), zz);
+			y = S::fmadd(e, S::set1(-2.12194440e-4f), y);
+			y = S::fmadd(zz, S::set1(-0.5f), y);
+			y = S::add(z, y);
+			y = S::fmadd(e, S::set1(0.693359375f), y);
+			y = S::select(S::eq(x, S::set1(std::numeric_limits<float>::infinity())), x, y);
+			y = S::select(S::eq(x, S::set1(0.0f)), S::set1(-std::numeric_limits<float>::infinity()), y);
+			return S::select(S::ge(x, S::set1(0.0f)), y, S::set1(std::numeric_limits<float>::quiet_NaN()));
+		}
+	};
+
+	/*PZ̃J[l*/
+	template<class S, typename T, int OP>
+	struct SimdUnaryKernel {
+		using reg = typename S::reg;
+		static reg apply(reg x) {
+			switch (OP) {
+			case SIMD_ABS: return S::abs(x);
+			case SIMD_SQRT: return S::sqrt(x);
+			case SIMD_EXP: return SimdFunction<S, T>::exp(x);
+			case SIMD_LOG: return SimdFunction<S, T>::log(x);
+			case SIMD_SIGMOID: return S::div(S::set1((T)1), S::add(S::set1((T)1), SimdFunction<S, T>::exp(S::sub(S::set1((T)0), x))));
+			case SIMD_RELU: return S::max(x, S::set1((T)0));
+			default: return x;
+			}
+		}
+		static void run(const T *in, T *out, int size) {
+			int i = 0;
+			for (; i + S::width <= size; i += S::width) S::store(out + i, apply(S::load(in + i)));
+			if (i == size) return;
+			//[͍Ɨ̈ŌvZ
+			T buf[S::width] = {};
+			for (int j = i; j < size; j++) buf[j - i] = in[j];
+			S::store(buf, apply(S::load(buf)));
+			for (int j = i; j < size; j++) out[j] = buf[j - i];
+		}
+	};
+
+	/*񍀉Z̃J[l
+	SCALAR: x21̒lSvfɎg*/
+	template<class S, typename T, int OP, bool SCALAR>
+	struct SimdBinaryKernel {
+		using reg = typename S::reg;
+		static reg apply(reg x1, reg x2) {
+			switch (OP) {
+			case SIMD_ADD: return S::add(x1, x2);
+			case SIMD_SUB: return S::sub(x1, x2);
+			case SIMD_RSUB: return S::sub(x2, x1);
+			case SIMD_MUL: return S::mul(x1, x2);
+			case SIMD_DIV: return S::div(x1, x2);
+			case SIMD_RDIV: return S::div(x2, x1);
+			case SIMD_EQ: return S::to_one(S::eq(x1, x2));
+			case SIMD_NE: return S::to_one(S::ne(x1, x2));
+			case SIMD_GT: return S::to_one(S::gt(x1, x2));
+			case SIMD_LT: return S::to_one(S::lt(x1, x2));
+			case SIMD_GE: return S::to_one(S::ge(x1, x2));
+			case SIMD_LE: return S::to_one(S::le(x1, x2));
+			default: return x1;
+			}
+		}
+		static void run(const T *x1, const T *x2, T *out, int size) {
+			reg scalar = S::set1(x2[0]);
+			int i = 0;
+			for (; i + S::width <= size; i += S::width) {
+				S::store(out + i, apply(S::load(x1 + i), SCALAR ? scalar : S::load(x2 + i)));
+			}
+			if (i == size) return;
+			//[͍Ɨ̈ŌvZ
+			T buf1[S::width] = {};
+			T buf2[S::width] = {};
+			for (int j = i; j < size; j++) {
+				buf1[j - i] = x1[j];
+				buf2[j - i] = SCALAR ? x2[0] : x2[j];
+			}
+			S::store(buf1, apply(S::load(buf1), S::load(buf2)));
+			for (int j = i; j < size; j++) out[j] = buf1[j - i];
+		}
+	};
+
+	/*WṽJ[l*/
+	template<class S, typename T>
+	struct SimdReduceKernel {
+		using reg = typename S::reg;
+		/*v (Ɨ4{̃WX^ŗݐ)*/
+		static T sum(const T *in, int size) {
+			reg acc0 = S::set1((T)0);
+			reg acc1 = acc0;
+			reg acc2 = acc0;
+			reg acc3 = acc0;
+			int i = 0;
+			for (; i + S::width * 4 <= size; i += S::width * 4) {
+				acc0 = S::add(acc0, S::load(in + i));
+				acc1 = S::add(acc1, S::load(in + i + S::width));
+				acc2 = S::add(acc2, S::load(in + i + S::width * 2));
+				acc3 = S::add(acc3, S::load(in + i + S::width * 3));
+			}
+			for (; i + S::width <= size; i += S::width) acc0 = S::add(acc0, S::load(in + i));
+			T buf[S::width];
+			S::store(buf, S::add(S::add(acc0, acc1), S::add(acc2, acc3)));
+			T result = 0;
+			for (int j = 0; j < S::width; j++) result += buf[j];
+			for (; i < size; i++) result += in[i];
+			return result;
+		}
+		/*␳t̍v ([Neumaier@)*/
+		static T sum_kahan(const T *in, int size) {
+			reg acc = S::set1((T)0);
+			reg comp = acc;
+			int i = 0;
+			for (; i + S::width <= size; i += S::width) {
+				reg x = S::load(in + i);
+				reg t = S::add(acc, x);
+				reg d1 = S::add(S::sub(acc, t), x);
+				reg d2 = S::add(S::sub(x, t), acc);
+				comp = S::add(comp, S::select(S::ge(S::abs(acc), S::abs(x)), d1, d2));
+				acc = t;
+			}
+			T buf_acc[S::width];
+			T buf_comp[S::width];
+			S::store(buf_acc, acc);
+			S::store(buf_comp, comp);
+			T result = 0;
+			T c = 0;
+			for (int j = 0; j < S::width + size - i; j++) {
+				T x = j < S::width ? buf_acc[j] : in[i + j - S::width];
+				T t = result + x;
+				if (std::abs(result) >= std::abs(x)) c += (result - t) + x;
+				else c += (x - t) + result;
+				result = t;
+			}
+			for (int j = 0; j < S::width; j++) c += buf_comp[j];
+			return result + c;
+		}
+		/*ŏl (size > 0)*/
+		static T min(const T *in, int size) {
+			reg acc = S::set1(in[0]);
+			int i = 0;
+			for (; i + S::width <= size; i += S::width) acc = S::min(acc, S::load(in + i));
+			T buf[S::width];
+			S::store(buf, acc);
+			T result = buf[0];
+			for (int j = 1; j < S::width; j++) result = std::min(result, buf[j]);
+			for (; i < size; i++) result = std::min(result, in[i]);
+			return result;
+		}
+		/*ől (size > 0)*/
+		static T max(const T *in, int size) {
+			reg acc = S::set1(in[0]);
+			int i = 0;
+			for (; i + S::width <= size; i += S::width) acc = S::max(acc, S::load(in + i));
+			T buf[S::width];
+			S::store(buf, acc);
+			T result = buf[0];
+			for (int j = 1; j < S::width; j++) result = std::max(result, buf[j]);
+			for (; i < size; i++) result = std::max(result, in[i]);
+			return result;
+		}
+	};
+
+	/*y += alpha * x*/
+	template<class S, typename T>
+	struct SimdAxpyKernel {
+		using reg = typename S::reg;
+		static void run(T alpha, const T *x, T *y, int size) {
+			reg a = S::set1(alpha);
+			int i = 0;
+			for (; i + S::width * 2 <= size; i += S::width * 2) {
+				S::store(y + i, S::fmadd(a, S::load(x + i), S::load(y + i)));
+				S::store(y + i + S::width, S::fmadd(a, S::load(x + i + S::width), S::load(y + i + S::width)));
+			}
+			for (; i + S::width <= size; i += S::width) S::store(y + i, S::fmadd(a, S::load(x + i), S::load(y + i)));
+			for (; i < size; i++) y[i] += alpha * x[i];
+		}
+	};
+
+	/*
+	sς̃}CNJ[l tile[MR x NR] = a[kc x MR]^T * b[kc x NR] (MR = 6)
+	o̓^C1s NR / width ̃WX^ɒu (12 WX^Ɏ܂Ȃ߃Zbgł̓XJ[g)
+	*/
+	template<class S, typename T, int RN = GemmBlock<T>::NR / S::width>
+	struct SimdGemmKernel {
+		static void(*get())(int kc, const T *a, const T *b, T *tile) { return nullptr; }
+	};
+
+	template<class S, typename T>
+	struct SimdGemmKernel<S, T, 2> {
+		using reg = typename S::reg;
+		static void run(int kc, const T *a, const T *b, T *tile) {
+			const int W = S::width;
+			const int NR = GemmBlock<T>::NR;
+			reg c00 = S::set1((T)0), c01 = c00, c10 = c00, c11 = c00, c20 = c00, c21 = c00;
+			reg c30 = c00, c31 = c00, c40 = c00, c41 = c00, c50 = c00, c51 = c00;
+			for (int p = 0; p < kc; p++, a += 6, b += NR) {
+				reg b0 = S::load(b);
+				reg b1 = S::load(b + W);
+				reg ai;
+				ai = S::set1(a[0]); c00 = S::fmadd(ai, b0, c00); c01 = S::fmadd(ai, b1, c01);
+				ai = S::set1(a[1]); c10 = S::fmadd(ai, b0, c10); c11 = S::fmadd(ai, b1, c11);
+				ai = S::set1(a[2]); c20 = S::fmadd(ai, b0, c20); c21 = S::fmadd(ai, b1, c21);
+				ai = S::set1(a[3]); c30 = S::fmadd(ai, b0, c30); c31 = S::fmadd(ai, b1, c31);
+				ai = S::set1(a[4]); c40 = S::fmadd(ai, b0, c40); c41 = S::fmadd(ai, b1, c41);
+				ai = S::set1(a[5]); c50 = S::fmadd(ai, b0, c50); c51 = S::fmadd(ai, b1, c51);
+			}
+			S::store(tile, c00); S::store(tile + W, c01); tile += NR;
+			S::store(tile, c10); S::store(tile + W, c11); tile += NR;
+			S::store(tile, c20); S::store(tile + W, c21); tile += NR;
+			S::store(tile, c30); S::store(tile + W, c31); tile += NR;
+			S::store(tile, c40); S::store(tile + W, c41); tile += NR;
+			S::store(tile, c50); S::store(tile + W, c51);
+		}
+		static void(*get())(int kc, const T *a, const T *b, T *tile) { return GemmBlock<T>::MR == 6 ? &run : nullptr; }
+	};
+
+	template<class S, typename T>
+	struct SimdGemmKernel<S, T, 1> {
+		using reg = typename S::reg;
+		static void run(int kc, const T *a, const T *b, T *tile) {
+			const int NR = GemmBlock<T>::NR;
+			reg c0 = S::set1((T)0), c1 = c0, c2 = c0, c3 = c0, c4 = c0, c5 = c0;
+			for (int p = 0; p < kc; p++, a += 6, b += NR) {
+				reg b0 = S::load(b);
+				c0 = S::fmadd(S::set1(a[0]), b0, c0);
+				c1 = S::fmadd(S::set1(a[1]), b0, c1);
+				c2 = S::fmadd(S::set1(a[2]), b0, c2);
+				c3 = S::fmadd(S::set1(a[3]), b0, c3);
+				c4 = S::fmadd(S::set1(a[4]), b0, c4);
+				c5 = S::fmadd(S::set1(a[5]), b0, c5);
+			}
+			S::store(tile, c0); S::store(tile + NR, c1); S::store(tile + NR * 2, c2);
+			S::store(tile + NR * 3, c3); S::store(tile + NR * 4, c4); S::store(tile + NR * 5, c5);
+		}
+		static void(*get())(int kc, const T *a, const T *b, T *tile) { return GemmBlock<T>::MR == 6 ? &run : nullptr; }
+	};
+
+	/*sς̃Gs[O (oCAX̉ZA֐AReLŨ}XN) o͂̍s̈ꕔɓKp*/
+	template<class S, typename T>
+	struct SimdGemmEpilogueKernel {
+		using reg = typename S::reg;
+		/*o̗͂vf̃rbgԂ*/
+		static uint32_t step(const GemmEpilogue<T>& epilogue, const T *in, const T *bias, T *out, bool accumulate) {
+			reg zero = S::set1((T)0);
+			reg y = S::load(in);
+			if (accumulate) y = S::add(y, S::load(out));
+			if (bias != nullptr) y = S::add(y, S::load(bias));
+			if (epilogue.activation == GEMM_ACTIVATION_RELU) y = S::max(y, zero);
+			else if (epilogue.activation == GEMM_ACTIVATION_SIGMOID) y = SimdUnaryKernel<S, T, SIMD_SIGMOID>::apply(y);
+			S::store(out, y);
+			return S::to_bits(S::gt(y, zero));
+		}
+		static void run(const GemmEpilogue<T>& epilogue, int i, int j, int count, const T *in, T *out, bool accumulate) {
+			const T *bias = epilogue.bias != nullptr ? epilogue.bias + j : nullptr;
+			uint64_t *mask = epilogue.mask != nullptr ? epilogue.mask + (size_t)i * epilogue.ldm : nullptr;
+			int x = 0;
+			for (; x + S::width <= count; x += S::width) {
+				uint32_t bits = step(epilogue, in + x, bias != nullptr ? bias + x : nullptr, out + x, accumulate);
+				if (mask != nullptr) bitmask_store(mask, j + x, bits, S::width);
+			}
+			if (x == count) return;
+			//[͍Ɨ̈ŌvZ
+			T in_buf[S::width] = {};
+			T out_buf[S::width] = {};
+			T bias_buf[S::width] = {};
+			for (int k = x; k < count; k++) {
+				in_buf[k - x] = in[k];
+				out_buf[k - x] = out[k];
+				if (bias != nullptr) bias_buf[k - x] = bias[k];
+			}
+			uint32_t bits = step(epilogue, in_buf, bias != nullptr ? bias_buf : nullptr, out_buf, accumulate);
+			for (int k = x; k < count; k++) out[k] = out_buf[k - x];
+			if (mask != nullptr) bitmask_store(mask, j + x, bits, count - x);
+		}
+	};
+
+	/*ReLUñ}XÑJ[l (`dŏo͂ƃ}XÑrbg1̑ŏ݁At`d̓}XNőI)*/
+	template<class S, typename T>
+	struct SimdReluMaskKernel {
+		using reg = typename S::reg;
+		static uint32_t forward_step(const T *in, const T *slopes, reg slope, T *out) {
+			reg x = S::load(in);
+			auto positive = S::gt(x, S::set1((T)0));
+			reg s = slopes != nullptr ? S::load(slopes) : slope;
+			S::store(out, S::select(positive, x, S::mul(x, s)));
+			return S::to_bits(positive);
+		}
+		static void backward_step(const T *grad, const T *slopes, reg slope, uint32_t bits, T *out) {
+			reg g = S::load(grad);
+			reg s = slopes != nullptr ? S::load(slopes) : slope;
+			S::store(out, S::select(S::from_bits(bits), g, S::mul(g, s)));
+		}
+		static void forward(const T *in, const T *slopes, T slope, T *out, uint64_t *bits, int count) {
+			reg s = S::set1(slope);
+			int x = 0;
+			//64vf̃rbgW߂Ă1ꂸ
+			for (; x + 64 <= count; x += 64) {
+				uint64_t word = 0;
+				for (int k = 0; k < 64; k += S::width) {
+					word |= (uint64_t)forward_step(in + x + k, slopes != nullptr ? slopes + x + k : nullptr, s, out + x + k) << k;
+				}
+				bits[x >> 6] = word;
+			}
+			for (; x + S::width <= count; x += S::width) {
+				bitmask_store(bits, x, forward_step(in + x, slopes != nullptr ? slopes + x : nullptr, s, out + x), S::width);
+			}
+			if (x == count) return;
+			//[͍Ɨ̈ŌvZ
+			T in_buf[S::width] = {};
+			T slopes_buf[S::width] = {};
+			T out_buf[S::width];
+			for (int k = x; k < count; k++) {
+				in_buf[k - x] = in[k];
+				if (slopes != nullptr) slopes_buf[k - x] = slopes[k];
+			}
+			bitmask_store(bits, x, forward_step(in_buf, slopes != nullptr ? slopes_buf : nullptr, s, out_buf), count - x);
+			for (int k = x; k < count; k++) out[k] = out_buf[k - x];
+		}
+		static void backward(const T *grad, const T *slopes, T slope, const uint64_t *bits, T *out, int count) {
+			reg s = S::set1(slope);
+			const uint32_t field = (uint32_t)((1ull << S::width) - 1);
+			int x = 0;
+			for (; x + 64 <= count; x += 64) {
+				uint64_t word = bits[x >> 6];
+				for (int k = 0; k < 64; k += S::width) {
+					backward_step(grad + x + k, slopes != nullptr ? slopes + x + k : nullptr, s, (uint32_t)(word >> k) & field, out + x + k);
+				}
+			}
+			for (; x + S::width <= count; x += S::width) {
+				backward_step(grad + x, slopes != nullptr ? slopes + x : nullptr, s, (uint32_t)bitmask_load(bits, x, S::width), out + x);
+			}
+			if (x == count) return;
+			T grad_buf[S::width] = {};
+			T slopes_buf[S::width] = {};
+			T out_buf[S::width];
+			for (int k = x; k < count; k++) {
+				grad_buf[k - x] = grad[k];
+				if (slopes != nullptr) slopes_buf[k - x] = slopes[k];
+			}
+			backward_step(grad_buf, slopes != nullptr ? slopes_buf : nullptr, s, (uint32_t)bitmask_load(bits, x, count - x), out_buf);
+			for (int k = x; k < count; k++) out[k] = out_buf[k - x];
+		}
+	};
+
+	/*J[l̕\ւ̖߃Zbg̃J[lo^*/
+	template<class S, typename T, int... U, int... B>
+	void register_simd_kernels(SimdKernelTable<T>& table, SimdLevel level, std::integer_sequence<int, U...>, std::integer_sequence<int, B...>) {
+		table.level = level;
+		table.sum = &SimdReduceKernel<S, T>::sum;
+		table.sum_kahan = &SimdReduceKernel<S, T>::sum_kahan;
+		table.min = &SimdReduceKernel<S, T>::min;
+		table.max = &SimdReduceKernel<S, T>::max;
+		table.axpy = &SimdAxpyKernel<S, T>::run;
+		table.gemm = SimdGemmKernel<S, T>::get();
+		table.gemm_epilogue = &SimdGemmEpilogueKernel<S, T>::run;
+		table.relu_mask = &SimdReluMaskKernel<S, T>::forward;
+		table.relu_mask_backward = &SimdReluMaskKernel<S, T>::backward;
+		int unary[] = { (table.unary[U] = &SimdUnaryKernel<S, T, U>::run, 0)... };
+		int binary[] = { (table.binary[B] = &SimdBinaryKernel<S, T, B, false>::run, table.binary_scalar[B] = &SimdBinaryKernel<S, T, B, true>::run, 0)... };
+		(void)unary;
+		(void)binary;
+	}
@@ -0,0 +1,30 @@
+/*
+߃Zbg̃J[l̎荞 (#pragma once Ȃ namespace FastContainer ̒Ŏ荞)
+FAST_CONTAINER_SIMD_KERNELS Ɏw肵t@CAg閽߃Zbgɂ̖߃ZbgΏۂɃRpC̈
+O (Sse4Kernels, Avx2Kernels, Avx512Kernels) ̒Ŏ荞
+(ev[g͒`ʒȗΏۂŃRpĈŁA߃Zbg̃WX^ S Ɏev[g͖߃Zbgɒ`)
+*/
+
+#ifdef FAST_CONTAINER_SIMD_SSE4
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_SSE4)
+	namespace Sse4Kernels {
+#include FAST_CONTAINER_SIMD_KERNELS
+	}
+FAST_CONTAINER_TARGET_END
+#endif
+
+#ifdef FAST_CONTAINER_SIMD_AVX2
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_AVX2)
+	namespace Avx2Kernels {
+#include FAST_CONTAINER_SIMD_KERNELS
+	}
+FAST_CONTAINER_TARGET_END
+#endif
+
+#ifdef FAST_CONTAINER_SIMD_AVX512
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_AVX512)
+	namespace Avx512Kernels {
+#include FAST_CONTAINER_SIMD_KERNELS
+	}
+FAST_CONTAINER_TARGET_END
+#endif
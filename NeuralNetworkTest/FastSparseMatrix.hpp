@@ -0,0 +1,312 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	asƂ̐ς̍Ɨ̈ (16rbg_̏ꍇg)
+	̂JԂn΁A`Ȃ2ڈȍ~͊mۂȂ
+	*/
+	template<typename T>
+	struct SparseDotBuffer {
+		/*EӂAccumulate<T>֕ϊ*/
+		FastMatrix<Accumulate<T>> operand;
+		/*s̗ݐ*/
+		FastMatrix<Accumulate<T>> accumulator;
+	};
+
+	/*asƂ̐ς̉EӂƗݐϐAccumulate<T>̕тƂĎo (^Ȃ炻̂܂܁AႦbuffer֕ϊ)*/
+	template<typename T, bool Same = std::is_same<T, Accumulate<T>>::value>
+	struct SparseDenseOperand {
+		static const Accumulate<T> *get(const FastMatrix<T>& mat, SparseDotBuffer<T>& buffer) {
+			mat.cast_to(buffer.operand);
+			return buffer.operand.get_data();
+		}
+		static Accumulate<T> *get_accumulator(FastMatrix<T>& result, SparseDotBuffer<T>& buffer) {
+			auto& acc = buffer.accumulator;
+			if (acc.get_row_size() != result.get_row_size() || acc.get_column_size() != result.get_column_size()) acc.resize(result.get_row_size(), result.get_column_size());
+			return acc.get_data();
+		}
+	};
+	/*^ȂEӂ͂̂܂܁Aʂ֒ڗݐς*/
+	template<typename T>
+	struct SparseDenseOperand<T, true> {
+		static const T *get(const FastMatrix<T>& mat, SparseDotBuffer<T>&) { return mat.get_data(); }
+		static T *get_accumulator(FastMatrix<T>& result, SparseDotBuffer<T>&) { return result.get_data(); }
+	};
+
+	/*
+	asNX (CSR`)
+	row_offsets[i]  row_offsets[i + 1] ̎O܂łsi̔vfŁA
+	column_indices ɗԍAvalues ɒlԍ̏Ŏ
+	*/
+	template<typename T>
+	class FastSparseMatrix {
+	public:
+		using value_type = T;
+
+		FastSparseMatrix() { }
+		/*row x col ̗s*/
+		FastSparseMatrix(int row, int col) { resize(row, col); }
+		/*s񂩂ϊ (Βlthreshold傫vfc)*/
+		FastSparseMatrix(const FastMatrix<T>& mat, T threshold = (T)0) { from_FastMatrix(mat, threshold); }
+
+		int get_row_size() const { return row_size; }
+		int get_column_size() const { return column_size; }
+		/*vf̐*/
+		int get_nonzero_count() const { return row_offsets.empty() ? 0 : row_offsets[row_size]; }
+		/*vf̊*/
+		double get_density() const { return row_size * column_size == 0 ? 0.0 : (double)get_nonzero_count() / ((double)row_size * column_size); }
+
+		const FastStorage<int>& get_row_offsets() const { return row_offsets; }
+		const FastStorage<int>& get_column_indices() const { return column_indices; }
+		const FastStorage<T>& get_values() const { return values; }
+		/*eύXxɕςԍ (ʂ͓̂ԍ ]u̍ėp̔p)*/
+		uint64_t get_version() const { return version; }
+
+		/*row x col ̗sɂ (͍̈ėp)*/
+		void resize(int row, int col) {
+			touch();
+			row_size = row;
+			column_size = col;
+			row_offsets.assign(row + 1, 0);
+			column_indices.clear();
+			values.clear();
+		}
+
+		/*s񂩂ϊ (Βlthreshold傫vfc)*/
+		void from_FastMatrix(const FastMatrix<T>& mat, T threshold = (T)0) {
+			int row = mat.get_row_size();
+			int col = mat.get_column_size();
+			const T *data = mat.get_data();
+			Accumulate<T> th = (Accumulate<T>)threshold;
+			touch();
+			row_size = row;
+			column_size = col;
+			row_offsets.resize(row + 1);
+			row_offsets[0] = 0;
+			//s̔vf̐𐔂ĂÄʒu֕ɏ
+			int grain = std::max(1, SIMD_GRAIN / std::max(1, col));
+			parallel_for_range(0, row, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					int count = 0;
+					for (int j = 0; j < col; j++) {
+						if (std::fabs((Accumulate<T>)data[i * col + j]) > th) count++;
+					}
+					row_offsets[i + 1] = count;
+				}
+			}, grain);
+			for (int i = 0; i < row; i++) row_offsets[i + 1] += row_offsets[i];
+			column_indices.resize(row_offsets[row]);
+			values.resize(row_offsets[row]);
+			parallel_for_range(0, row, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					int k = row_offsets[i];
+					for (int j = 0; j < col; j++) {
+						T x = data[i * col + j];
+						if (std::fabs((Accumulate<T>)x) > th) {
+							column_indices[k] = j;
+							values[k] = x;
+							k++;
+						}
+					}
+				}
+			}, grain);
+		}
+
+		/*s֕ϊ*/
+		FastMatrix<T> to_FastMatrix() const {
+			FastMatrix<T> result;
+			to_FastMatrix(result);
+			return result;
+		}
+		/*s֕ϊresult֏ (`Ⴆresult̑傫ς)*/
+		void to_FastMatrix(FastMatrix<T>& result) const {
+			if (result.get_row_size() != row_size || result.get_column_size() != column_size) result.resize(row_size, column_size);
+			T *out = result.get_data();
+			int col = column_size;
+			parallel_for_range(0, row_size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					T *r = out + (size_t)i * col;
+					std::fill(r, r + col, (T)0);
+					for (int k = row_offsets[i]; k < row_offsets[i + 1]; k++) r[column_indices[k]] = values[k];
+				}
+			}, std::max(1, SIMD_GRAIN / std::max(1, col)));
+		}
+
+		/*w肵so*/
+		FastSparseMatrix<T> batch(const FastVector<int>& mask) const {
+			FastSparseMatrix<T> result;
+			batch_to(mask, result);
+			return result;
+		}
+		/*w肵soresult֏*/
+		void batch_to(const FastVector<int>& mask, FastSparseMatrix<T>& result) const {
+			int row = mask.get_size();
+			result.touch();
+			result.row_size = row;
+			result.column_size = column_size;
+			result.row_offsets.resize(row + 1);
+			result.row_offsets[0] = 0;
+			for (int i = 0; i < row; i++) {
+				int r = mask[i];
+				if (r < 0 || r >= row_size) throw fast_container_exception();
+				result.row_offsets[i + 1] = result.row_offsets[i] + (row_offsets[r + 1] - row_offsets[r]);
+			}
+			result.column_indices.resize(result.row_offsets[row]);
+			result.values.resize(result.row_offsets[row]);
+			parallel_for_range(0, row, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					int r = mask[i];
+					std::copy(column_indices.data() + row_offsets[r], column_indices.data() + row_offsets[r + 1], result.column_indices.data() + result.row_offsets[i]);
+					std::copy(values.data() + row_offsets[r], values.data() + row_offsets[r + 1], result.values.data() + result.row_offsets[i]);
+				}
+			}, 64);
+		}
+
+		/*]u*/
+		FastSparseMatrix<T> transpose() const {
+			FastSparseMatrix<T> result;
+			transpose_to(result);
+			return result;
+		}
+		/*
+		]uresult֏ (񖈂ɐĐU蕪̂Ŕvf̐ɔ)
+		resultthis̓]u (thisO񂩂ύXĂȂ) Ȃ牽Ȃ
+		*/
+		void transpose_to(FastSparseMatrix<T>& result) const {
+			if (&result == this) throw fast_container_exception();
+			if (version != 0 && result.transpose_source == version) return;
+			int nnz = get_nonzero_count();
+			result.touch();
+			result.row_size = column_size;
+			result.column_size = row_size;
+			result.row_offsets.assign(column_size + 1, 0);
+			result.column_indices.resize(nnz);
+			result.values.resize(nnz);
+			//row_offsets[j + 1]j݈̏ʒuƂĎgAU蕪͗j̏I (= j + 1̎n܂) ɂȂ
+			int *offsets = result.row_offsets.data();
+			for (int k = 0; k < nnz; k++) offsets[column_indices[k] + 1]++;
+			for (int j = 1; j < column_size; j++) offsets[j + 1] += offsets[j];
+			for (int j = column_size; j > 0; j--) offsets[j] = offsets[j - 1];
+			for (int i = 0; i < row_size; i++) {
+				for (int k = row_offsets[i]; k < row_offsets[i + 1]; k++) {
+					int pos = offsets[column_indices[k] + 1]++;
+					result.column_indices[pos] = i;
+					result.values[pos] = values[k];
+				}
+			}
+			result.transpose_source = version;
+		}
+
+		/*s (a x )*/
+		FastMatrix<T> dot(const FastMatrix<T>& mat) const {
+			FastMatrix<T> result;
+			dot_to(mat, result);
+			return result;
+		}
+		/*
+		s (a x ) ̌ʂresult֏ (`Ⴆresult̑傫ς)
+		sɔvfɑΉmat̍s𑫂ނ̂ŁAvZʂ͔vf̐ x mat̗
+		*/
+		void dot_to(const FastMatrix<T>& mat, FastMatrix<T>& result) const {
+			SparseDotBuffer<T> buffer;
+			dot_to(mat, result, buffer);
+		}
+		/*s (a x ) ̌ʂresult֏ (buffer͍Ɨ̈ JԂĂԏꍇɓnƊmۂNȂ)*/
+		void dot_to(const FastMatrix<T>& mat, FastMatrix<T>& result, SparseDotBuffer<T>& buffer) const { dot_to(mat, result, GemmEpilogue<T>(), buffer); }
+		/*
+		s (a x ) ɃoCAX̉ZƊ֐𑱂ČvZAresult֏
+		(sɗݐςʂނƂɓKp̂ŁAo͂1񂾂  FastMatrix::dot_activation_to() Ɠ)
+		*/
+		void dot_activation_to(const FastMatrix<T>& mat, const FastVector<T>& bias, GemmActivation activation, FastMatrix<T>& result, FastBitMask *mask = nullptr) const {
+			SparseDotBuffer<T> buffer;
+			dot_activation_to(mat, bias, activation, result, mask, buffer);
+		}
+		/*s (a x ) ɃoCAX̉ZƊ֐𑱂ČvZAresult֏ (buffer͍Ɨ̈)*/
+		void dot_activation_to(const FastMatrix<T>& mat, const FastVector<T>& bias, GemmActivation activation, FastMatrix<T>& result, FastBitMask *mask, SparseDotBuffer<T>& buffer) const {
+			int col = mat.get_column_size();
+			if (bias.get_size() != col) throw fast_container_exception();
+			if (mask != nullptr && (mask->get_row_size() != row_size || mask->get_column_size() != col)) mask->resize(row_size, col);
+			GemmEpilogue<T> epilogue;
+			epilogue.bias = bias.get_data();
+			epilogue.activation = activation;
+			if (mask != nullptr) {
+				epilogue.mask = mask->get_data();
+				epilogue.ldm = mask->get_words_per_row();
+			}
+			dot_to(mat, result, epilogue, buffer);
+		}
+		/*
+		]uƂ̍s (this̓]u x ) ̌ʂresult֏
+		transposed͓]u̍Ɨ̈ (OƓ͂Ȃ]uȂ), buffer͐ς̍Ɨ̈
+		*/
+		void transpose_dot_to(const FastMatrix<T>& mat, FastMatrix<T>& result, FastSparseMatrix<T>& transposed) const {
+			SparseDotBuffer<T> buffer;
+			transpose_dot_to(mat, result, transposed, buffer);
+		}
+		void transpose_dot_to(const FastMatrix<T>& mat, FastMatrix<T>& result, FastSparseMatrix<T>& transposed, SparseDotBuffer<T>& buffer) const {
+			transpose_to(transposed);
+			transposed.dot_to(mat, result, buffer);
+		}
+
+	private:
+		/*s (a x ) ̊es񂾒ɃGs[OKp*/
+		void dot_to(const FastMatrix<T>& mat, FastMatrix<T>& result, const GemmEpilogue<T>& epilogue, SparseDotBuffer<T>& buffer) const {
+			using A = Accumulate<T>;
+			if (column_size != mat.get_row_size()) throw fast_container_exception();
+			if (&result == &mat) throw fast_container_exception();
+			int col = mat.get_column_size();
+			if (result.get_row_size() != row_size || result.get_column_size() != col) result.resize(row_size, col);
+			bool has_epilogue = !epilogue.is_empty();
+			auto epilogue_kernel = GemmEpilogueKernel<T>::get();
+			//16rbg_͌Ȃ悤matAccumulate<T>֕ϊAsbuffer֗ݐςĂۂ߂
+			const A *b = SparseDenseOperand<T>::get(mat, buffer);
+			A *acc_base = SparseDenseOperand<T>::get_accumulator(result, buffer);
+			T *out = result.get_data();
+			auto axpy = get_simd_kernels<A>().axpy;
+			//1s̐Ϙả񐔂񉻂̗x߂
+			long long work = (long long)std::max(1, get_nonzero_count() / std::max(1, row_size)) * std::max(1, col);
+			int grain = std::max(1, (int)(SIMD_GRAIN / work));
+			parallel_for_range(0, row_size, [&](int begin, int end) {
+				const int *offsets = row_offsets.data();
+				const int *indices = column_indices.data();
+				const T *vals = values.data();
+				for (int i = begin; i < end; i++) {
+					A *acc = acc_base + (size_t)i * col;
+					std::fill(acc, acc + col, (A)0);
+					for (int k = offsets[i]; k < offsets[i + 1]; k++) {
+						A a = vals[k];
+						const A *r = b + (size_t)indices[k] * col;
+						if (axpy != nullptr) axpy(a, r, acc, col);
+						else for (int j = 0; j < col; j++) acc[j] += a * r[j];
+					}
+					T *o = out + (size_t)i * col;
+					if ((void *)o != (void *)acc) {
+						for (int j = 0; j < col; j++) o[j] = (T)acc[j];
+					}
+					if (has_epilogue) epilogue_kernel(epilogue, i, 0, col, o, o, false);
+				}
+			}, grain);
+		}
+
+		/*eύXƂĐVԍt*/
+		void touch() {
+			static std::atomic<uint64_t> counter(0);
+			version = ++counter;
+			transpose_source = 0;
+		}
+
+		int row_size = 0;
+		int column_size = 0;
+		/*e̔ԍ (0͖ݒ)*/
+		uint64_t version = 0;
+		/*]u̔ԍ (transpose_toŏ񂾏ꍇ̂)*/
+		uint64_t transpose_source = 0;
+		FastStorage<int> row_offsets;
+		FastStorage<int> column_indices;
+		FastStorage<T> values;
+	};
+
+}
@@ -0,0 +1,381 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*4e\̎̕ (摜̃ob`)*/
+	enum TensorLayout {
+		TENSOR_LAYOUT_NCHW,	/*ob`, `l, ,  (`l̕ʂA)*/
+		TENSOR_LAYOUT_NHWC	/*ob`, , , `l (f̃`lA)*/
+	};
+
+	/*sDŘAт̎̋*/
+	inline std::vector<int> tensor_strides(const std::vector<int>& shape) {
+		std::vector<int> result(shape.size());
+		int stride = 1;
+		for (int i = (int)shape.size() - 1; i >= 0; i--) {
+			result[i] = stride;
+			stride *= shape[i];
+		}
+		return result;
+	}
+
+	/*[first][last]̎O܂ł̗vf̐*/
+	inline int tensor_size(const std::vector<int>& shape, int first, int last) {
+		int result = 1;
+		for (int i = first; i < last; i++) result *= shape[i];
+		return result;
+	}
+
+	/*
+	e\QƂr[ (̈LȂ)
+	strides[i]: i̗̎vf܂ł̋
+	̓ւA͈͂̐؂o̓Rs[ɎQƂł
+	QƐ̃Rei蒷gȂ
+	*/
+	template<typename T>
+	class FastTensorView {
+	public:
+		using value_type = T;
+
+		FastTensorView() { }
+		FastTensorView(T *data, const std::vector<int>& shape) : FastTensorView(data, shape, tensor_strides(shape)) { }
+		FastTensorView(T *data, const std::vector<int>& shape, const std::vector<int>& strides) : data(data), shape(shape), strides(strides) {
+			if (shape.size() != strides.size()) throw fast_container_exception();
+		}
+
+		T *get_data() const { return data; }
+		int get_rank() const { return (int)shape.size(); }
+		const std::vector<int>& get_shape() const { return shape; }
+		const std::vector<int>& get_strides() const { return strides; }
+		int get_dim(int axis) const { return shape[axis]; }
+		int get_stride(int axis) const { return strides[axis]; }
+		int get_size() const { return shape.empty() ? 0 : tensor_size(shape, 0, get_rank()); }
+		/*sDŌԂȂł邩*/
+		bool is_contiguous() const {
+			int stride = 1;
+			for (int i = get_rank() - 1; i >= 0; i--) {
+				if (shape[i] != 1 && strides[i] != stride) return false;
+				stride *= shape[i];
+			}
+			return true;
+		}
+
+		template<class... I>
+		T& operator()(I... idx) const {
+			static_assert(sizeof...(I) > 0, "index is empty");
+			int index[] = { (int)idx... };
+			if ((int)sizeof...(I) != get_rank()) throw fast_container_exception();
+			int offset = 0;
+			for (int i = 0; i < (int)sizeof...(I); i++) offset += index[i] * strides[i];
+			return data[offset];
+		}
+
+		/*[axis][begin][count]Q*/
+		FastTensorView<T> slice(int axis, int begin, int count) const {
+			if (axis < 0 || axis >= get_rank()) throw fast_container_exception();
+			if (begin < 0 || count < 0 || begin + count > shape[axis]) throw fast_container_exception();
+			FastTensorView<T> result(data + begin * strides[axis], shape, strides);
+			result.shape[axis] = count;
+			return result;
+		}
+		/*ւĎQ (ʂ̎i͌̎axes[i])*/
+		FastTensorView<T> permute(const std::vector<int>& axes) const {
+			int rank = get_rank();
+			if ((int)axes.size() != rank) throw fast_container_exception();
+			std::vector<int> new_shape(rank), new_strides(rank);
+			std::vector<bool> used(rank, false);
+			for (int i = 0; i < rank; i++) {
+				int axis = axes[i];
+				if (axis < 0 || axis >= rank || used[axis]) throw fast_container_exception();
+				used[axis] = true;
+				new_shape[i] = shape[axis];
+				new_strides[i] = strides[axis];
+			}
+			return FastTensorView<T>(data, new_shape, new_strides);
+		}
+		/*2̃e\sƂĎQ*/
+		FastMatrixView<T> matrix_view() const {
+			if (get_rank() != 2) throw fast_container_exception();
+			return FastMatrixView<T>(data, shape[0], shape[1], strides[0], strides[1]);
+		}
+
+		/*sDŘAтփRs[ (out get_size() vf)
+		exec: s*/
+		template<class E>
+		void copy_to(T *out, E& exec) const {
+			int rank = get_rank();
+			int size = get_size();
+			if (size == 0) return;
+			if (is_contiguous()) {
+				std::copy(data, data + size, out);
+				return;
+			}
+			//Ō̎1sƂāAs̐擪̈ʒu߂ȂRs[
+			int col = shape[rank - 1];
+			int col_stride = strides[rank - 1];
+			int row = size / col;
+			exec.parallel_for_range(0, row, [&](int begin, int end) {
+				for (int r = begin; r < end; r++) {
+					int offset = 0;
+					int rest = r;
+					for (int i = rank - 2; i >= 0; i--) {
+						offset += rest % shape[i] * strides[i];
+						rest /= shape[i];
+					}
+					const T *src = data + offset;
+					T *dst = out + (size_t)r * col;
+					if (col_stride == 1) std::copy(src, src + col, dst);
+					else for (int j = 0; j < col; j++) dst[j] = src[j * col_stride];
+				}
+			}, std::max(1, SIMD_GRAIN / std::max(1, col)));
+		}
+
+	private:
+		T *data = nullptr;
+		std::vector<int> shape;
+		std::vector<int> strides;
+	};
+
+	/*
+	e\NX (Cӂ̎AsDŘÄL)
+	4̃e\ layout ŉ摜̃ob`̎̕ (NCHW, NHWC) \
+	̈ FastMatrix Ɠ FastStorage Ȃ̂ŁAFastMatrix Ƃ̊ԂŃRs[Ɏ󂯓n
+	*/
+	template<typename T>
+	class FastTensor {
+	public:
+		using value_type = T;
+
+		FastTensor() { }
+		FastTensor(const std::vector<int>& shape) { resize(shape); }
+		/*摜̃ob` (layout̕тŊm)*/
+		FastTensor(int batch, int channel, int height, int width, TensorLayout layout = TENSOR_LAYOUT_NCHW) { resize(batch, channel, height, width, layout); }
+		/*FastMatriẍ̗pŐ (Rs[Ȃ mat͋ɂȂ)*/
+		FastTensor(FastMatrix<T>&& mat, const std::vector<int>& shape, TensorLayout layout = TENSOR_LAYOUT_NCHW) {
+			if (tensor_size(shape, 0, (int)shape.size()) != mat.get_size()) throw fast_container_exception();
+			entity = mat.release_storage();
+			set_shape(shape, layout);
+		}
+		/*FastMatriẍ̗pŉ摜̃ob`𐶐 (Rs[Ȃ mat͋ɂȂ)*/
+		FastTensor(FastMatrix<T>&& mat, int batch, int channel, int height, int width, TensorLayout layout = TENSOR_LAYOUT_NCHW)
+			: FastTensor(std::move(mat), image_shape(batch, channel, height, width, layout), layout) { }
+
+		/*shapȇ傫ɂ (e͕s)*/
+		void resize(const std::vector<int>& shape) {
+			for (int dim : shape) {
+				if (dim < 0) throw fast_container_exception();
+			}
+			set_shape(shape, TENSOR_LAYOUT_NCHW);
+			entity.resize(size);
+		}
+		/*摜̃ob`̑傫ɂ (e͕s)*/
+		void resize(int batch, int channel, int height, int width, TensorLayout layout = TENSOR_LAYOUT_NCHW) {
+			resize(image_shape(batch, channel, height, width, layout));
+			this->layout = layout;
+		}
+		/*vfςɌ`ς (4mȂlayout͕ςȂ)*/
+		void reshape(const std::vector<int>& shape) {
+			if (tensor_size(shape, 0, (int)shape.size()) != size) throw fast_container_exception();
+			set_shape(shape, get_rank() == 4 ? layout : TENSOR_LAYOUT_NCHW);
+		}
+
+		const FastStorage<T>& get_entity() const { return entity; }
+		T *get_data() { return entity.data(); }
+		const T *get_data() const { return entity.data(); }
+		int get_rank() const { return (int)shape.size(); }
+		const std::vector<int>& get_shape() const { return shape; }
+		const std::vector<int>& get_strides() const { return strides; }
+		int get_dim(int axis) const { return shape[axis]; }
+		int get_stride(int axis) const { return strides[axis]; }
+		int get_size() const { return size; }
+		TensorLayout get_layout() const { return layout; }
+
+		/*摜̃ob`̊ȇ傫 (4̂)*/
+		int get_batch_size() const { return shape[image_axis(0)]; }
+		int get_channel_size() const { return shape[image_axis(1)]; }
+		int get_height() const { return shape[image_axis(2)]; }
+		int get_width() const { return shape[image_axis(3)]; }
+
+		T& operator[](int idx) { return entity[idx]; }
+		const T& operator[](int idx) const { return entity[idx]; }
+		template<class... I>
+		T& operator()(I... idx) { return entity[get_offset(idx...)]; }
+		template<class... I>
+		const T& operator()(I... idx) const { return entity[get_offset(idx...)]; }
+		/*摜̃ob`̗vf (layoutɊւ炸ob`, `l, , ̏Ɏw)*/
+		T& pixel(int n, int c, int h, int w) { return entity[get_pixel_offset(n, c, h, w)]; }
+		const T& pixel(int n, int c, int h, int w) const { return entity[get_pixel_offset(n, c, h, w)]; }
+
+		auto begin() { return entity.begin(); }
+		auto begin() const { return entity.begin(); }
+		auto end() { return entity.end(); }
+		auto end() const { return entity.end(); }
+
+		/*e̓Yʂԍ߂*/
+		template<class... I>
+		int get_offset(I... idx) const {
+			static_assert(sizeof...(I) > 0, "index is empty");
+			int index[] = { (int)idx... };
+			if ((int)sizeof...(I) != get_rank()) throw fast_container_exception();
+			int offset = 0;
+			for (int i = 0; i < (int)sizeof...(I); i++) offset += index[i] * strides[i];
+			return offset;
+		}
+		/*摜̃ob`̓Yʂԍ߂*/
+		int get_pixel_offset(int n, int c, int h, int w) const {
+			if (get_rank() != 4) throw fast_container_exception();
+			if (layout == TENSOR_LAYOUT_NHWC) return n * strides[0] + h * strides[1] + w * strides[2] + c;
+			return n * strides[0] + c * strides[1] + h * strides[2] + w;
+		}
+
+		/*r[*/
+		FastTensorView<T> view() { return FastTensorView<T>(get_data(), shape, strides); }
+		/*ւĎQ (ʂ̎i͌̎axes[i])*/
+		FastTensorView<T> permute(const std::vector<int>& axes) { return view().permute(axes); }
+		/*[axis][begin][count]Q*/
+		FastTensorView<T> slice(int axis, int begin, int count) { return view().slice(axis, begin, count); }
+		/*
+		sƂĎQ (Rs[Ȃ)
+		[0][axis]̎O܂łsAcɂ܂Ƃ߂
+		(NCHWaxis = 1 1s1̉摜ANHWCaxis = 3 1s1f̃`l)
+		*/
+		FastMatrixView<T> matrix_view(int axis = 1) {
+			if (axis < 0 || axis > get_rank()) throw fast_container_exception();
+			return FastMatrixView<T>(get_data(), tensor_size(shape, 0, axis), tensor_size(shape, axis, get_rank()));
+		}
+
+		/*s֕ϊ (Rs[ ̂܂Ƃߕ matrix_view() Ɠ)*/
+		FastMatrix<T> to_FastMatrix(int axis = 1) const {
+			if (axis < 0 || axis > get_rank()) throw fast_container_exception();
+			FastMatrix<T> result(tensor_size(shape, 0, axis), tensor_size(shape, axis, get_rank()));
+			std::copy(entity.begin(), entity.end(), result.begin());
+			return result;
+		}
+		/*̈sֈn (Rs[Ȃ ̂܂Ƃߕ matrix_view() Ɠ ̃e\͋ɂȂ)*/
+		FastMatrix<T> release_FastMatrix(int axis = 1) {
+			if (axis < 0 || axis > get_rank()) throw fast_container_exception();
+			int row = tensor_size(shape, 0, axis);
+			int col = tensor_size(shape, axis, get_rank());
+			FastMatrix<T> result = FastMatrix<T>::from_storage(std::move(entity), row, col);
+			entity.clear();
+			set_shape(std::vector<int>(), TENSOR_LAYOUT_NCHW);
+			return result;
+		}
+
+		/*摜̃ob`̎̕тςe\ (4̂)*/
+		FastTensor<T> to_layout(TensorLayout target) const {
+			FastTensor<T> result;
+			to_layout_to(target, result);
+			return result;
+		}
+		/*摜̃ob`̎̕тςresult֏ (4̂)
+		NCHW  NHWC ̕ϊ͉摜 `l x f ̍s̓]u*/
+		void to_layout_to(TensorLayout target, FastTensor<T>& result) const { to_layout_to(target, result, ThreadPool::get_instance()); }
+		/*摜̃ob`̎̕тςresult֏
+		exec: s*/
+		template<class E>
+		void to_layout_to(TensorLayout target, FastTensor<T>& result, E& exec) const {
+			if (get_rank() != 4) throw fast_container_exception();
+			if (&result == this) throw fast_container_exception();
+			int n = get_batch_size(), c = get_channel_size(), h = get_height(), w = get_width();
+			if (result.shape != image_shape(n, c, h, w, target) || result.layout != target) result.resize(n, c, h, w, target);
+			if (size == 0) return;
+			if (target == layout) {
+				std::copy(entity.begin(), entity.end(), result.entity.begin());
+				return;
+			}
+			int pixels = h * w;
+			int row = layout == TENSOR_LAYOUT_NCHW ? c : pixels;
+			int col = layout == TENSOR_LAYOUT_NCHW ? pixels : c;
+			const T *src = get_data();
+			T *dst = result.get_data();
+			int image_size = c * pixels;
+			//摜Ή摜ɁAȂΉ摜̒̓]u񉻂
+			if (n >= exec.get_concurrency()) {
+				exec.parallel_for_range(0, n, [&](int begin, int end) {
+					SerialExecutor serial;
+					for (int i = begin; i < end; i++) transpose(row, col, src + (size_t)i * image_size, col, dst + (size_t)i * image_size, row, serial);
+				});
+			}
+			else {
+				for (int i = 0; i < n; i++) transpose(row, col, src + (size_t)i * image_size, col, dst + (size_t)i * image_size, row, exec);
+			}
+		}
+
+		/*Svfvalɂ*/
+		FastTensor<T>& fill(T value) {
+			std::fill(entity.begin(), entity.end(), value);
+			return *this;
+		}
+
+		/*vf̉Z (float, doubleSIMD߂ŌvZ)*/
+		FastTensor<T>& operator+=(const FastTensor<T>& tensor) { return apply_inplace(SIMD_ADD, tensor, [](T x1, T x2) { return x1 + x2; }); }
+		FastTensor<T>& operator-=(const FastTensor<T>& tensor) { return apply_inplace(SIMD_SUB, tensor, [](T x1, T x2) { return x1 - x2; }); }
+		FastTensor<T>& operator*=(const FastTensor<T>& tensor) { return apply_inplace(SIMD_MUL, tensor, [](T x1, T x2) { return x1 * x2; }); }
+		FastTensor<T>& operator/=(const FastTensor<T>& tensor) { return apply_inplace(SIMD_DIV, tensor, [](T x1, T x2) { return x1 / x2; }); }
+		FastTensor<T>& operator+=(T value) { return apply_scalar_inplace(SIMD_ADD, value, [](T x1, T x2) { return x1 + x2; }); }
+		FastTensor<T>& operator-=(T value) { return apply_scalar_inplace(SIMD_SUB, value, [](T x1, T x2) { return x1 - x2; }); }
+		FastTensor<T>& operator*=(T value) { return apply_scalar_inplace(SIMD_MUL, value, [](T x1, T x2) { return x1 * x2; }); }
+		FastTensor<T>& operator/=(T value) { return apply_scalar_inplace(SIMD_DIV, value, [](T x1, T x2) { return x1 / x2; }); }
+
+		/*v*/
+		T sum() const { return reduce_sum(get_data(), size, ThreadPool::get_instance()); }
+		/*ŏl*/
+		T get_min() const { return reduce_min(get_data(), size, ThreadPool::get_instance()); }
+		/*ől*/
+		T get_max() const { return reduce_max(get_data(), size, ThreadPool::get_instance()); }
+
+	private:
+		/*摜̃ob`̌` (layout̕)*/
+		static std::vector<int> image_shape(int batch, int channel, int height, int width, TensorLayout layout) {
+			if (layout == TENSOR_LAYOUT_NHWC) return std::vector<int>{ batch, height, width, channel };
+			return std::vector<int>{ batch, channel, height, width };
+		}
+		/*摜̃ob`̎ (0: ob`, 1: `l, 2: , 3: ) łʒu*/
+		int image_axis(int dim) const {
+			static const int nhwc[] = { 0, 3, 1, 2 };
+			if (get_rank() != 4) throw fast_container_exception();
+			return layout == TENSOR_LAYOUT_NHWC ? nhwc[dim] : dim;
+		}
+		void set_shape(const std::vector<int>& shape, TensorLayout layout) {
+			this->shape = shape;
+			this->strides = tensor_strides(shape);
+			this->size = shape.empty() ? 0 : tensor_size(shape, 0, (int)shape.size());
+			this->layout = layout;
+		}
+
+		template<class F>
+		FastTensor<T>& apply_inplace(SimdBinaryOp op, const FastTensor<T>& tensor, F func) {
+			if (shape != tensor.shape) throw fast_container_exception();
+			if (size == 0) return *this;
+			auto& exec = ThreadPool::get_instance();
+			T *out = get_data();
+			const T *x = tensor.get_data();
+			if (simd_binary(op, (const T *)out, x, out, size, exec)) return *this;
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) out[i] = func(out[i], x[i]);
+			}, SIMD_GRAIN);
+			return *this;
+		}
+		template<class F>
+		FastTensor<T>& apply_scalar_inplace(SimdBinaryOp op, T value, F func) {
+			if (size == 0) return *this;
+			auto& exec = ThreadPool::get_instance();
+			T *out = get_data();
+			if (simd_binary_scalar(op, (const T *)out, value, out, size, exec)) return *this;
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) out[i] = func(out[i], value);
+			}, SIMD_GRAIN);
+			return *this;
+		}
+
+		FastStorage<T> entity;
+		std::vector<int> shape;
+		std::vector<int> strides;
+		int size = 0;
+		TensorLayout layout = TENSOR_LAYOUT_NCHW;
+	};
+
+}
@@ -0,0 +1,226 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	^C]u
+	TB x TB ̃^Cɕ񉻂A^C͏ubN (SIMDWX^œ]u) Pʂŏ
+	ǂݍ݂݂^CŊ̂ŃLbVCg؂
+	*/
+
+	/*sɕύXł^C̑傫 (ŕύX)*/
+	template<typename T>
+	struct TransposeTuning {
+		static std::atomic<int>& get_block() {
+			static std::atomic<int> block(64);
+			return block;
+		}
+	};
+
+	/*gp̃^C̑傫*/
+	template<typename T>
+	int get_transpose_block() {
+		ensure_tuning_loaded();
+		return TransposeTuning<T>::get_block().load(std::memory_order_relaxed);
+	}
+
+	/*^C̑傫ύX (8̔{ɐ؂̂)*/
+	template<typename T>
+	void set_transpose_block(int block) {
+		if (block < 8) throw fast_container_exception();
+		ensure_tuning_loaded();
+		TransposeTuning<T>::get_block().store(block / 8 * 8, std::memory_order_relaxed);
+	}
+
+	/*ubN̓]u (SIMDgȂ)*/
+	template<typename T, int N>
+	struct TransposeBlockScalar {
+		static const int size = N;
+		static void run(const T *src, int ld_src, T *dst, int ld_dst) {
+			for (int i = 0; i < N; i++) {
+				for (int j = 0; j < N; j++) dst[j * ld_dst + i] = src[i * ld_src + j];
+			}
+		}
+	};
+
+#ifdef FAST_CONTAINER_SIMD_SSE4
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_SSE4)
+	/*ubN̓]u SSE4.1*/
+	template<typename T>
+	struct TransposeBlockSse4;
+	template<>
+	struct TransposeBlockSse4<double> {
+		static const int size = 2;
+		static void run(const double *src, int ld_src, double *dst, int ld_dst) {
+			__m128d r0 = _mm_loadu_pd(src);
+			__m128d r1 = _mm_loadu_pd(src + ld_src);
+			_mm_storeu_pd(dst, _mm_unpacklo_pd(r0, r1));
+			_mm_storeu_pd(dst + ld_dst, _mm_unpackhi_pd(r0, r1));
+		}
+	};
+	template<>
+	struct TransposeBlockSse4<float> {
+		static const int size = 4;
+		static void run(const float *src, int ld_src, float *dst, int ld_dst) {
+			__m128 r0 = _mm_loadu_ps(src);
+			__m128 r1 = _mm_loadu_ps(src + ld_src);
+			__m128 r2 = _mm_loadu_ps(src + ld_src * 2);
+			__m128 r3 = _mm_loadu_ps(src + ld_src * 3);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(dst, r0);
+			_mm_storeu_ps(dst + ld_dst, r1);
+			_mm_storeu_ps(dst + ld_dst * 2, r2);
+			_mm_storeu_ps(dst + ld_dst * 3, r3);
+		}
+	};
+FAST_CONTAINER_TARGET_END
+#endif
+
+#ifdef FAST_CONTAINER_SIMD_AVX2
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_AVX2)
+	/*ubN̓]u AVX2*/
+	template<typename T>
+	struct TransposeBlockAvx2;
+	template<>
+	struct TransposeBlockAvx2<double> {
+		static const int size = 4;
+		static void run(const double *src, int ld_src, double *dst, int ld_dst) {
+			__m256d r0 = _mm256_loadu_pd(src);
+			__m256d r1 = _mm256_loadu_pd(src + ld_src);
+			__m256d r2 = _mm256_loadu_pd(src + ld_src * 2);
+			__m256d r3 = _mm256_loadu_pd(src + ld_src * 3);
+			__m256d t0 = _mm256_unpacklo_pd(r0, r1);
+			__m256d t1 = _mm256_unpackhi_pd(r0, r1);
+			__m256d t2 = _mm256_unpacklo_pd(r2, r3);
+			__m256d t3 = _mm256_unpackhi_pd(r2, r3);
+			_mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+			_mm256_storeu_pd(dst + ld_dst, _mm256_permute2f128_pd(t1, t3, 0x20));
+			_mm256_storeu_pd(dst + ld_dst * 2, _mm256_permute2f128_pd(t0, t2, 0x31));
+			_mm256_storeu_pd(dst + ld_dst * 3, _mm256_permute2f128_pd(t1, t3, 0x31));
+		}
+	};
+	template<>
+	struct TransposeBlockAvx2<float> {
+		static const int size = 8;
+		static void run(const float *src, int ld_src, float *dst, int ld_dst) {
+			__m256 r[8];
+			for (int i = 0; i < 8; i++) r[i] = _mm256_loadu_ps(src + ld_src * i);
+			__m256 t[8];
+			for (int i = 0; i < 4; i++) {
+				t[i * 2] = _mm256_unpacklo_ps(r[i * 2], r[i * 2 + 1]);
+				t[i * 2 + 1] = _mm256_unpackhi_ps(r[i * 2], r[i * 2 + 1]);
+			}
+			__m256 s[8];
+			for (int i = 0; i < 2; i++) {
+				s[i * 4] = _mm256_shuffle_ps(t[i * 4], t[i * 4 + 2], _MM_SHUFFLE(1, 0, 1, 0));
+				s[i * 4 + 1] = _mm256_shuffle_ps(t[i * 4], t[i * 4 + 2], _MM_SHUFFLE(3, 2, 3, 2));
+				s[i * 4 + 2] = _mm256_shuffle_ps(t[i * 4 + 1], t[i * 4 + 3], _MM_SHUFFLE(1, 0, 1, 0));
+				s[i * 4 + 3] = _mm256_shuffle_ps(t[i * 4 + 1], t[i * 4 + 3], _MM_SHUFFLE(3, 2, 3, 2));
+			}
+			for (int i = 0; i < 4; i++) {
+				_mm256_storeu_ps(dst + ld_dst * i, _mm256_permute2f128_ps(s[i], s[i + 4], 0x20));
+				_mm256_storeu_ps(dst + ld_dst * (i + 4), _mm256_permute2f128_ps(s[i], s[i + 4], 0x31));
+			}
+		}
+	};
+FAST_CONTAINER_TARGET_END
+#endif
+
+	/*^C̓]u (SIMDgȂubNpƁA߃Zbg̏ubNp Sse4Kernels, Avx2Kernels)*/
+#include "FastTransposeKernels.hpp"
+#define FAST_CONTAINER_SIMD_KERNELS "FastTransposeKernels.hpp"
+#include "FastSimdTarget.hpp"
+#undef FAST_CONTAINER_SIMD_KERNELS
+
+	/*^C̓]u*/
+	template<typename T>
+	using TransposeTileFunc = void(*)(int r, int c, const T *src, int ld_src, T *dst, int ld_dst);
+
+	/*gp̖߃Zbg̃^C̓]u (float, doubleȊOSIMDgȂ)*/
+	template<typename T>
+	struct TransposeKernelFactory {
+		static TransposeTileFunc<T> get() { return &transpose_tile<TransposeBlockScalar<T, 8>, T>; }
+	};
+	template<typename T>
+	struct TransposeFloatingKernelFactory {
+		static TransposeTileFunc<T> get() {
+			SimdLevel level = get_simd_level();
+#ifdef FAST_CONTAINER_SIMD_AVX2
+			if (level >= SIMD_LEVEL_AVX2) return &Avx2Kernels::transpose_tile<TransposeBlockAvx2<T>, T>;
+#endif
+#ifdef FAST_CONTAINER_SIMD_SSE4
+			if (level >= SIMD_LEVEL_SSE4) return &Sse4Kernels::transpose_tile<TransposeBlockSse4<T>, T>;
+#endif
+			(void)level;
+			return &transpose_tile<TransposeBlockScalar<T, 8>, T>;
+		}
+	};
+	template<>
+	struct TransposeKernelFactory<double> :public TransposeFloatingKernelFactory<double> { };
+	template<>
+	struct TransposeKernelFactory<float> :public TransposeFloatingKernelFactory<float> { };
+
+	/*
+	]u dst = src^T
+	src: row x col (src(i, j) = src[i * ld_src + j])
+	dst: col x row (dst(j, i) = dst[j * ld_dst + i])
+	exec: s
+	*/
+	template<typename T, class E>
+	void transpose(int row, int col, const T *src, int ld_src, T *dst, int ld_dst, E& exec) {
+		if (row <= 0 || col <= 0) return;
+		const int TB = get_transpose_block<T>();
+		auto tile = TransposeKernelFactory<T>::get();
+		int row_tiles = (row + TB - 1) / TB;
+		int col_tiles = (col + TB - 1) / TB;
+		exec.parallel_for_range(0, row_tiles * col_tiles, [&](int begin, int end) {
+			for (int t = begin; t < end; t++) {
+				int i0 = (t / col_tiles) * TB;
+				int j0 = (t % col_tiles) * TB;
+				tile(std::min(TB, row - i0), std::min(TB, col - j0), src + i0 * ld_src + j0, ld_src, dst + j0 * ld_dst + i0, ld_dst);
+			}
+		});
+	}
+
+	/*
+	s̏œ]u
+	data: n x n (data(i, j) = data[i * ld + j])
+	Ίp̃^C͓ŌAΊp񂾃^C̑g͍Ɨ̈Č
+	exec: s
+	*/
+	template<typename T, class E>
+	void transpose_inplace(int n, T *data, int ld, E& exec) {
+		if (n <= 1) return;
+		const int TB = get_transpose_block<T>();
+		auto tile = TransposeKernelFactory<T>::get();
+		int tiles = (n + TB - 1) / TB;
+		std::vector<std::pair<int, int>> pairs;
+		for (int ti = 0; ti < tiles; ti++) {
+			for (int tj = ti; tj < tiles; tj++) pairs.emplace_back(ti, tj);
+		}
+		exec.parallel_for_range(0, (int)pairs.size(), [&](int begin, int end) {
+			std::vector<T> buf(TB * TB);
+			for (int p = begin; p < end; p++) {
+				int i0 = pairs[p].first * TB;
+				int j0 = pairs[p].second * TB;
+				int r = std::min(TB, n - i0);
+				int c = std::min(TB, n - j0);
+				if (i0 == j0) {
+					for (int i = 0; i < r; i++) {
+						for (int j = i + 1; j < r; j++) std::swap(data[(i0 + i) * ld + j0 + j], data[(j0 + j) * ld + i0 + i]);
+					}
+					continue;
+				}
+				//buf = A(i0, j0)^T, A(i0, j0) = A(j0, i0)^T, A(j0, i0) = buf
+				T *upper = data + i0 * ld + j0;
+				T *lower = data + j0 * ld + i0;
+				tile(r, c, (const T *)upper, ld, &buf[0], r);
+				tile(c, r, (const T *)lower, ld, upper, ld);
+				for (int j = 0; j < c; j++) std::copy(&buf[j * r], &buf[j * r] + r, lower + j * ld);
+			}
+		});
+	}
+
+}
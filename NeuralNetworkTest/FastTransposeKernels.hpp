@@ -0,0 +1,35 @@
+/*
+^C̓]u (FastTranspose.hpp 荞 #pragma once Ȃ)
+ubN̓]uCC悤AubN̖߃ZbgɎ荞
+*/
+
+	/*
+	r x c ̃^C]u
+	K: ubN̓]u (K::size x K::size)
+	ubŇĂяoCC悤^CPʂŊ֐|C^I
+	ubN̓ǂݏLbVC܂Ȃ悤A擪̑ĂȂsƗ1vf
+	*/
+	template<class K, typename T>
+	void transpose_tile(int r, int c, const T *src, int ld_src, T *dst, int ld_dst) {
+		const int B = K::size;
+		const size_t A = B * sizeof(T);
+		int ai = std::min(r, (int)((A - (size_t)dst % A) % A / sizeof(T)));
+		int aj = std::min(c, (int)((A - (size_t)src % A) % A / sizeof(T)));
+		for (int i = 0; i < ai; i++) {
+			for (int j = 0; j < c; j++) dst[j * ld_dst + i] = src[i * ld_src + j];
+		}
+		for (int j = 0; j < aj; j++) {
+			for (int i = ai; i < r; i++) dst[j * ld_dst + i] = src[i * ld_src + j];
+		}
+		int i = ai;
+		for (; i + B <= r; i += B) {
+			int j = aj;
+			for (; j + B <= c; j += B) K::run(src + i * ld_src + j, ld_src, dst + j * ld_dst + i, ld_dst);
+			for (; j < c; j++) {
+				for (int ii = i; ii < i + B; ii++) dst[j * ld_dst + ii] = src[ii * ld_src + j];
+			}
+		}
+		for (; i < r; i++) {
+			for (int j = aj; j < c; j++) dst[j * ld_dst + i] = src[i * ld_src + j];
+		}
+	}
@@ -0,0 +1,391 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*LbVt@Cɏ^*/
+	template<typename T>
+	struct TuningTypeName {
+		static const char *get() { return "other"; }
+	};
+	template<>
+	struct TuningTypeName<float> {
+		static const char *get() { return "float"; }
+	};
+	template<>
+	struct TuningTypeName<double> {
+		static const char *get() { return "double"; }
+	};
+
+	/*repssŒZ [b]*/
+	template<class F>
+	double measure_time(F func, int reps = 3) {
+		double best = std::numeric_limits<double>::max();
+		for (int r = 0; r < reps; r++) {
+			auto start = std::chrono::steady_clock::now();
+			func();
+			auto end = std::chrono::steady_clock::now();
+			best = std::min(best, std::chrono::duration<double>(end - start).count());
+		}
+		return best;
+	}
+
+	/*
+	ubNTCYA^C̑傫A񉻂臒l̎
+	̐ݒvčő̂̂IсA}ṼLbVt@Cɕۑ
+	߂čsρA]uAAUTO[h̎IgɃLbVt@Cǂݍނ̂ŁAȍ~͌vɒς݂̐ݒg
+	LbVt@C: ϐ FAST_CONTAINER_TUNING_CACHE (: st@CƓfBNg fast_container_tuning_<}V̎ʎq̃nbV>.txt)
+	ϐŎw肵񉻂臒l̓LbVD悷
+	*/
+	class Autotuner {
+		friend void ensure_tuning_loaded();
+	public:
+		static Autotuner& get_instance() {
+			static Autotuner tuner;
+			return tuner;
+		}
+
+		/*}V̎ʎq (CPU/x/߃Zbg)*/
+		static std::string get_machine_id() {
+			std::string brand = "unknown";
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+			int info[4];
+			simd_cpuid(info, 0x80000000, 0);
+			if ((unsigned int)info[0] >= 0x80000004) {
+				char buf[49] = {};
+				for (int i = 0; i < 3; i++) {
+					simd_cpuid(info, 0x80000002 + i, 0);
+					memcpy(buf + i * 16, info, 16);
+				}
+				brand = buf;
+				brand.erase(0, brand.find_first_not_of(' '));
+				brand.erase(brand.find_last_not_of(' ') + 1);
+			}
+#endif
+			std::ostringstream ss;
+			ss << brand << "/" << std::thread::hardware_concurrency() << "/" << (int)get_supported_simd_level();
+			return ss.str();
+		}
+
+		/*st@ĈfBNg (؂蕶ŏI Ȃ΋󕶎)*/
+		static std::string get_executable_directory() {
+			std::string path;
+#ifdef _MSC_VER
+			char *buf = nullptr;
+			if (_get_pgmptr(&buf) == 0 && buf != nullptr) path = buf;
+#else
+			char buf[4096];
+			ssize_t len = readlink("/proc/self/exe", buf, sizeof(buf) - 1);
+			if (len > 0) path.assign(buf, len);
+#endif
+			auto pos = path.find_last_of("\\/");
+			if (pos == std::string::npos) return std::string();
+			return path.substr(0, pos + 1);
+		}
+
+		/*̃LbVt@C (ƃfBNgɈ˂Ȃ悤st@Cׂ̗ɒu)*/
+		static std::string get_default_path() {
+			std::string path = read_dispatch_env("FAST_CONTAINER_TUNING_CACHE");
+			if (!path.empty()) return path;
+			//FNV-1a
+			unsigned long long hash = 14695981039346656037ULL;
+			for (char c : get_machine_id()) {
+				hash ^= (unsigned char)c;
+				hash *= 1099511628211ULL;
+			}
+			std::ostringstream ss;
+			ss << get_executable_directory() << "fast_container_tuning_" << std::hex << std::setw(16) << std::setfill('0') << hash << ".txt";
+			return ss.str();
+		}
+
+		/*LbVt@CǂݍŐݒ𔽉f (ʂ̃}Ṽt@CȂ疳)*/
+		bool load(const std::string& path = get_default_path()) {
+			std::ifstream ifs(path);
+			if (!ifs) return false;
+			std::map<std::string, std::string> buf;
+			std::string line;
+			while (std::getline(ifs, line)) {
+				if (!line.empty() && line.back() == '\r') line.pop_back();
+				if (line.empty() || line[0] == '#') continue;
+				auto pos = line.find('=');
+				if (pos == std::string::npos) continue;
+				buf[line.substr(0, pos)] = line.substr(pos + 1);
+			}
+			if (buf["machine"] != get_machine_id()) return false;
+			std::lock_guard<std::mutex> lock(mutex);
+			values = buf;
+			apply_gemm<float>();
+			apply_gemm<double>();
+			apply_transpose<float>();
+			apply_transpose<double>();
+			for (int i = 0; i < DISPATCH_OP_NUM; i++) apply_dispatch((DispatchOp)i);
+			return true;
+		}
+
+		/*LbVt@C֕ۑ*/
+		bool save(const std::string& path = get_default_path()) {
+			std::lock_guard<std::mutex> lock(mutex);
+			std::ofstream ofs(path);
+			if (!ofs) return false;
+			ofs << "# FastContainer tuning cache" << std::endl;
+			values["machine"] = get_machine_id();
+			for (auto&& x : values) ofs << x.first << "=" << x.second << std::endl;
+			return (bool)ofs;
+		}
+
+		/*shapes̍sςƕ񉻂臒lς݂*/
+		template<typename T>
+		bool is_tuned(const std::vector<GemmShape>& shapes) {
+			std::lock_guard<std::mutex> lock(mutex);
+			for (int i = 0; i < DISPATCH_OP_NUM; i++) {
+				if (values.count(get_dispatch_key((DispatchOp)i)) == 0) return false;
+			}
+			auto tuned = parse_shapes(values[get_gemm_key<T>("shapes")]);
+			for (auto&& shape : shapes) {
+				if (tuned.count(shape) == 0) return false;
+			}
+			return true;
+		}
+
+		/*sρA]uA񉻂臒l𒲐ĕۑ
+		(]u͍sς̍ő̓͂̑傫Ōv)*/
+		template<typename T>
+		void tune(const std::vector<GemmShape>& shapes) {
+			tune_gemm<T>(shapes);
+			GemmShape largest{ 0, 0, 0 };
+			for (auto&& shape : shapes) {
+				if ((long long)shape.m * shape.k > (long long)largest.m * largest.k) largest = shape;
+			}
+			if (largest.m > 0 && largest.k > 0) tune_transpose<T>(largest.m, largest.k);
+			tune_dispatch<T>();
+			save();
+		}
+
+		/*
+		sς̃ubNTCY𒲐
+		shapes: vsς̑傫 (ς݂̑傫ƍ킹čvԂŒẐ̂I)
+		*/
+		template<typename T>
+		void tune_gemm(const std::vector<GemmShape>& shapes) {
+			const int MR = GemmBlock<T>::MR;
+			std::set<GemmShape> all;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				all = parse_shapes(values[get_gemm_key<T>("shapes")]);
+			}
+			all.insert(shapes.begin(), shapes.end());
+			if (all.empty()) return;
+			std::vector<std::vector<T>> a, b, c;
+			for (auto&& shape : all) {
+				a.emplace_back((size_t)shape.m * shape.k, (T)0.5);
+				b.emplace_back((size_t)shape.k * shape.n, (T)0.25);
+				c.emplace_back((size_t)shape.m * shape.n);
+			}
+			auto& exec = ThreadPool::get_instance();
+			auto run = [&]() {
+				int i = 0;
+				for (auto&& shape : all) {
+					gemm(shape.m, shape.n, shape.k, a[i].data(), shape.k, 1, b[i].data(), shape.n, 1, c[i].data(), shape.n, exec);
+					++i;
+				}
+			};
+			int best_mc = get_gemm_mc<T>();
+			int best_kc = get_gemm_kc<T>();
+			double best = std::numeric_limits<double>::max();
+			for (int mc : { MR * 8, MR * 16, MR * 24, MR * 32, MR * 48 }) {
+				for (int kc : { 128, 192, 256, 384, 512 }) {
+					set_gemm_block_size<T>(mc, kc);
+					run();
+					double time = measure_time(run);
+					if (time < best) {
+						best = time;
+						best_mc = mc;
+						best_kc = kc;
+					}
+				}
+			}
+			set_gemm_block_size<T>(best_mc, best_kc);
+			std::lock_guard<std::mutex> lock(mutex);
+			values[get_gemm_key<T>("mc")] = std::to_string(best_mc);
+			values[get_gemm_key<T>("kc")] = std::to_string(best_kc);
+			values[get_gemm_key<T>("shapes")] = format_shapes(all);
+		}
+
+		/*]ũ^C̑傫𒲐 (row x col ̍sŌv)*/
+		template<typename T>
+		void tune_transpose(int row, int col) {
+			std::vector<T> src((size_t)row * col, (T)1), dst((size_t)row * col);
+			auto& exec = ThreadPool::get_instance();
+			auto run = [&]() { transpose(row, col, src.data(), col, dst.data(), row, exec); };
+			int best_block = get_transpose_block<T>();
+			double best = std::numeric_limits<double>::max();
+			for (int block : { 16, 32, 64, 128, 256 }) {
+				set_transpose_block<T>(block);
+				run();
+				double time = measure_time(run);
+				if (time < best) {
+					best = time;
+					best_block = block;
+				}
+			}
+			set_transpose_block<T>(best_block);
+			std::lock_guard<std::mutex> lock(mutex);
+			values[get_transpose_key<T>()] = std::to_string(best_block);
+		}
+
+		/*
+		Z̎ޖɒsƃXbhsւ鏈ʂv臒lɂ
+		(XbhsxȂȂΏɒs)
+		*/
+		template<typename T>
+		void tune_dispatch() {
+			const int max_size = 1 << 21;
+			std::vector<T> x1(max_size, (T)0.5), x2(max_size, (T)0.25), out(max_size);
+			SerialExecutor serial;
+			auto& pool = ThreadPool::get_instance();
+			for (int i = 0; i < DISPATCH_OP_NUM; i++) {
+				DispatchOp op = (DispatchOp)i;
+				std::vector<long long> works;
+				std::vector<bool> faster;
+				if (op == DISPATCH_OP_GEMM) {
+					for (int s = 8; s <= 256; s = s * 3 / 2) {
+						auto run = [&](auto& exec) {
+							gemm(s, s, s, x1.data(), s, 1, x2.data(), s, 1, out.data(), s, exec);
+						};
+						int iter = std::max(1, (1 << 24) / (s * s * s));
+						works.push_back((long long)s * s * s);
+						faster.push_back(compare_time(run, serial, pool, iter));
+					}
+				}
+				else {
+					for (int n = 1 << 10; n <= max_size; n *= 2) {
+						auto run = [&](auto& exec) { run_dispatch_op(op, x1.data(), x2.data(), out.data(), n, exec); };
+						int iter = std::max(1, (1 << 22) / n);
+						works.push_back(n);
+						faster.push_back(compare_time(run, serial, pool, iter));
+					}
+				}
+				//傫ʂł̓Xbhsɑŏ̏
+				long long threshold = std::numeric_limits<long long>::max();
+				for (int j = (int)works.size() - 1; j >= 0 && faster[j]; j--) threshold = works[j];
+				std::lock_guard<std::mutex> lock(mutex);
+				values[get_dispatch_key(op)] = std::to_string(threshold);
+				apply_dispatch(op);
+			}
+		}
+
+	private:
+		Autotuner() {
+			is_loading() = true;
+			load();
+			is_loading() = false;
+		}
+		/*̃XbhRXgN^ŃLbVǂݍݒ (ǂݍ݂ŐݒύX鎞ensure_tuning_loadedĂѓȂ)*/
+		static bool& is_loading() {
+			static thread_local bool loading = false;
+			return loading;
+		}
+
+		template<typename T>
+		static std::string get_gemm_key(const std::string& name) { return std::string("gemm.") + TuningTypeName<T>::get() + "." + name; }
+		template<typename T>
+		static std::string get_transpose_key() { return std::string("transpose.") + TuningTypeName<T>::get() + ".block"; }
+		static std::string get_dispatch_key(DispatchOp op) { return std::string("dispatch.") + get_dispatch_op_name(op); }
+
+		static std::set<GemmShape> parse_shapes(const std::string& str) {
+			std::set<GemmShape> result;
+			std::istringstream ss(str);
+			std::string item;
+			while (std::getline(ss, item, ';')) {
+				GemmShape shape;
+				char x1, x2;
+				std::istringstream is(item);
+				if (is >> shape.m >> x1 >> shape.n >> x2 >> shape.k) result.insert(shape);
+			}
+			return result;
+		}
+		static std::string format_shapes(const std::set<GemmShape>& shapes) {
+			std::ostringstream ss;
+			for (auto&& shape : shapes) {
+				if (ss.tellp() > 0) ss << ";";
+				ss << shape.m << "x" << shape.n << "x" << shape.k;
+			}
+			return ss.str();
+		}
+
+		template<typename T>
+		void apply_gemm() {
+			auto mc = values.find(get_gemm_key<T>("mc"));
+			auto kc = values.find(get_gemm_key<T>("kc"));
+			if (mc == values.end() || kc == values.end()) return;
+			try {
+				set_gemm_block_size<T>(std::stoi(mc->second), std::stoi(kc->second));
+			}
+			catch (const std::exception&) {
+			}
+		}
+		template<typename T>
+		void apply_transpose() {
+			auto it = values.find(get_transpose_key<T>());
+			if (it == values.end()) return;
+			try {
+				set_transpose_block<T>(std::stoi(it->second));
+			}
+			catch (const std::exception&) {
+			}
+		}
+		void apply_dispatch(DispatchOp op) {
+			auto it = values.find(get_dispatch_key(op));
+			if (it == values.end()) return;
+			if (!read_dispatch_env(std::string("FAST_CONTAINER_THRESHOLD_") + get_dispatch_op_name(op)).empty()) return;
+			try {
+				set_dispatch_threshold(DISPATCH_THREADED, op, std::stoll(it->second));
+			}
+			catch (const std::exception&) {
+			}
+		}
+
+		/*Z̎ނ̑\Iȏ*/
+		template<typename T, class E>
+		static void run_dispatch_op(DispatchOp op, const T *x1, const T *x2, T *out, int size, E& exec) {
+			switch (op) {
+			case DISPATCH_OP_ELEMENTWISE:
+				if (simd_binary(SIMD_ADD, x1, x2, out, size, exec)) return;
+				exec.parallel_for_range(0, size, [&](int begin, int end) {
+					for (int i = begin; i < end; i++) out[i] = x1[i] + x2[i];
+				}, SIMD_GRAIN);
+				return;
+			case DISPATCH_OP_TRANSCENDENTAL:
+				if (simd_unary(SIMD_EXP, x1, out, size, exec)) return;
+				exec.parallel_for_range(0, size, [&](int begin, int end) {
+					for (int i = begin; i < end; i++) out[i] = std::exp(x1[i]);
+				}, SIMD_GRAIN);
+				return;
+			default:
+				out[0] = reduce_sum(x1, size, exec);
+				return;
+			}
+		}
+
+		/*Xbhs̕1ȏ㑬*/
+		template<class F>
+		static bool compare_time(F run, SerialExecutor& serial, ThreadPool& pool, int iter) {
+			if (pool.get_concurrency() <= 1) return false;
+			double serial_time = measure_time([&]() { for (int i = 0; i < iter; i++) run(serial); });
+			double pool_time = measure_time([&]() { for (int i = 0; i < iter; i++) run(pool); });
+			return pool_time < serial_time * 0.9;
+		}
+
+		std::mutex mutex;
+		std::map<std::string, std::string> values;
+	};
+
+	inline void ensure_tuning_loaded() {
+		static std::atomic<bool> loaded(false);
+		if (loaded.load(std::memory_order_acquire) || Autotuner::is_loading()) return;
+		Autotuner::get_instance();
+		loaded.store(true, std::memory_order_release);
+	}
+
+}
@@ -10,43 +10,160 @@ namespace FastContainer {
 	template<typename T>
 	class FastVector {
 	public:
+		using value_type = T;
+
 		FastVector() { }
 		FastVector(int size) { resize(size); }
-		FastVector(const std::vector<T> vec) { this->size = vec.size(); entity = vec; }
+		FastVector(const std::vector<T> vec) { this->size = vec.size(); entity.assign(vec.begin(), vec.end()); }
+		FastVector(const FastStorage<T>& vec) { this->size = vec.size(); entity = vec; }
+		/*]Đ*/
+		template<class E>
+		FastVector(const Expression<E>& expr) {
+			resize(expr.self().get_size());
+			if (size) evaluate_expression(expr, &entity[0]);
+		}
 		~FastVector() { }
 
+		/*]đ (Ȃ̈ėp)*/
+		template<class E>
+		FastVector<T>& operator=(const Expression<E>& expr) {
+			if (size != expr.self().get_size()) return *this = FastVector<T>(expr);
+			if (size) evaluate_expression(expr, &entity[0]);
+			return *this;
+		}
+
 		void resize(int size) { this->size = size; entity.resize(size); }
 
-		std::vector<T> get_entity() { return entity; }
-		int get_size() { return size; }
+		const FastStorage<T>& get_entity() const { return entity; }
+		T *get_data() { return entity.data(); }
+		const T *get_data() const { return entity.data(); }
+		int get_size() const { return size; }
 
 		T& operator[](int index) { return entity[index]; }
+		const T& operator[](int index) const { return entity[index]; }
 
 		auto begin() { return entity.begin(); }
 		auto begin() const { return entity.begin(); }
 		auto end() { return entity.end(); }
 		auto end() const { return entity.end(); }
 
+		/*vf̌^ϊ (16rbg_Ƃ̕ϊfloatoR)*/
+		template<typename U>
+		FastVector<U> cast() const {
+			FastVector<U> result;
+			cast_to(result);
+			return result;
+		}
+		/*vf̌^ϊresult֏ (`Ⴆresult̑傫ς)*/
+		template<typename U>
+		void cast_to(FastVector<U>& result) const {
+			if (result.get_size() != size) result.resize(size);
+			parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) result[i] = (U)(Accumulate<T>)entity[i];
+			}, SIMD_GRAIN);
+		}
+		/*this += alpha * vec (vec͗vf̌^قȂĂ悢 xwK̃}X^[d݂̍XVp)*/
+		template<typename U>
+		FastVector<T>& axpy_cast(T alpha, const FastVector<U>& vec) {
+			if (size != vec.get_size()) throw fast_container_exception();
+			parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) entity[i] += alpha * (T)(Accumulate<U>)vec[i];
+			}, SIMD_GRAIN);
+			return *this;
+		}
+		/*SvfL (inf, NaN܂܂Ȃ) */
+		bool is_finite() const {
+			std::atomic<bool> result(true);
+			parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					if (!std::isfinite((Accumulate<T>)entity[i])) {
+						result = false;
+						return;
+					}
+				}
+			}, SIMD_GRAIN);
+			return result;
+		}
+
+		/* (̈ėp) [hؑ*/
+		FastVector<T>& operator+=(const FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_combo_inplace)([](T x1, T x2) restrict(cpu, amp) { return x1 + x2; }, vec); }
+		FastVector<T>& operator-=(const FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_combo_inplace)([](T x1, T x2) restrict(cpu, amp) { return x1 - x2; }, vec); }
+		FastVector<T>& operator*=(const FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_combo_inplace)([](T x1, T x2) restrict(cpu, amp) { return x1 * x2; }, vec); }
+		FastVector<T>& operator/=(const FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_combo_inplace)([](T x1, T x2) restrict(cpu, amp) { return x1 / x2; }, vec); }
+		FastVector<T>& operator+=(T val) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_inplace)([=](T x) restrict(cpu, amp) { return x + val; }); }
+		FastVector<T>& operator-=(T val) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_inplace)([=](T x) restrict(cpu, amp) { return x - val; }); }
+		FastVector<T>& operator*=(T val) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_inplace)([=](T x) restrict(cpu, amp) { return x * val; }); }
+		FastVector<T>& operator/=(T val) { return SWITCH_FAST_CONTAONER_OPERATOR(apply_inplace)([=](T x) restrict(cpu, amp) { return x / val; }); }
+		/*]ĕ*/
+		template<class E>
+		FastVector<T>& operator+=(const Expression<E>& expr) { return *this = BinaryExpression<AddOperation, ContainerExpression<FastVector<T>>, E>(*this, expr.self()); }
+		template<class E>
+		FastVector<T>& operator-=(const Expression<E>& expr) { return *this = BinaryExpression<SubOperation, ContainerExpression<FastVector<T>>, E>(*this, expr.self()); }
+		template<class E>
+		FastVector<T>& operator*=(const Expression<E>& expr) { return *this = BinaryExpression<MulOperation, ContainerExpression<FastVector<T>>, E>(*this, expr.self()); }
+		template<class E>
+		FastVector<T>& operator/=(const Expression<E>& expr) { return *this = BinaryExpression<DivOperation, ContainerExpression<FastVector<T>>, E>(*this, expr.self()); }
+
+		/*this += alpha * vec [hؑ*/
+		FastVector<T>& axpy(T alpha, const FastVector<T>& vec) { return SWITCH_FAST_CONTAONER_FUNCTION(axpy)(alpha, vec); }
+		/*this += alpha * mat*/
+		FastVector<T>& axpy_com(T alpha, const FastVector<T>& vec) { return apply_combo_inplace_com([=](T x1, T x2) { return x1 + alpha * x2; }, vec); }
+		/*this += alpha * vec AMP*/
+		FastVector<T>& axpy_amp(T alpha, const FastVector<T>& vec) { return apply_combo_inplace_amp([=](T x1, T x2) restrict(amp) { return x1 + alpha * x2; }, vec); }
+		/*this += alpha * vec PPL*/
+		FastVector<T>& axpy_ppl(T alpha, const FastVector<T>& vec) { return apply_combo_inplace_ppl([=](T x1, T x2) { return x1 + alpha * x2; }, vec); }
+		/*this += alpha * vec STD*/
+		FastVector<T>& axpy_std(T alpha, const FastVector<T>& vec) { return apply_combo_inplace_std([=](T x1, T x2) { return x1 + alpha * x2; }, vec); }
+
+		/*this *= alpha [hؑ*/
+		FastVector<T>& scale_inplace(T alpha) { return SWITCH_FAST_CONTAONER_FUNCTION(scale_inplace)(alpha); }
+		/*this *= alpha*/
+		FastVector<T>& scale_inplace_com(T alpha) { return apply_inplace_com([=](T x) { return alpha * x; }); }
+		/*this *= alpha AMP*/
+		FastVector<T>& scale_inplace_amp(T alpha) { return apply_inplace_amp([=](T x) restrict(amp) { return alpha * x; }); }
+		/*this *= alpha PPL*/
+		FastVector<T>& scale_inplace_ppl(T alpha) { return apply_inplace_ppl([=](T x) { return alpha * x; }); }
+		/*this *= alpha STD*/
+		FastVector<T>& scale_inplace_std(T alpha) { return apply_inplace_std([=](T x) { return alpha * x; }); }
+
+		/*֐Kpď㏑ [hؑ
+		func: T(*func)(T x) (AMP[hł restrict(amp) Kv)*/
+		template<class F>
+		FastVector<T>& apply_inplace(F func) { return SWITCH_FAST_CONTAONER_FUNCTION(apply_inplace)(func); }
+
+		/*r[ƂĎQ (Rs[Ȃ)*/
+		FastVectorView<T> view() { return FastVectorView<T>(*this); }
+		/*ǂݎp̃r[ƂĎQ (Rs[Ȃ)*/
+		FastVectorView<T> view() const { return FastVectorView<T>(*this); }
+		/*[begin][count]r[ƂĎQ*/
+		FastVectorView<T> slice_view(int begin, int count) { return view().slice(begin, count); }
+		/*[row]s̍sƂăr[ŎQ (O(1)Ō`ς FastMatrix(vec, row) ͗vfRs[)*/
+		FastMatrixView<T> reshape_view(int row) { return view().reshape(row); }
+
 		/*̂܂ܕԂ*/
 		FastVector<T> identity() { return *this; }
 
 		/*Βl [hؑ*/
 		FastVector<T> abs() { return SWITCH_FAST_CONTAONER_FUNCTION(abs)(); }
 		/*Βl*/
-		FastVector<T> abs_com() { return apply_com_func([](T x) { return std::abs(x); }); }
+		FastVector<T> abs_com() { return apply_com_func(SIMD_ABS, [](T x) { return std::abs(x); }); }
 		/*Βl AMP*/
 		FastVector<T> abs_amp() { return apply_amp_func([](T x) restrict(amp) { return concurrency::fast_math::fabs(x); }); }
 		/*Βl PPL*/
-		FastVector<T> abs_ppl() { return apply_ppl_func([](T x) { return std::abs(x); }); }
+		FastVector<T> abs_ppl() { return apply_ppl_func(SIMD_ABS, [](T x) { return std::abs(x); }); }
+		/*Βl STD*/
+		FastVector<T> abs_std() { return apply_std_func(SIMD_ABS, [](T x) { return std::abs(x); }); }
 
 		/*Log e [hؑ*/
 		FastVector<T> log() { return SWITCH_FAST_CONTAONER_FUNCTION(log)(); }
 		/*Log e*/
-		FastVector<T> log_com() { return apply_com_func([](T x) { return std::log(x); }); }
+		FastVector<T> log_com() { return apply_com_func(SIMD_LOG, [](T x) { return std::log(x); }); }
 		/*Log e AMP*/
 		FastVector<T> log_amp() { return apply_amp_func([](T x) restrict(amp) { return concurrency::fast_math::log(x); }); }
 		/*Log e PPL*/
-		FastVector<T> log_ppl() { return apply_ppl_func([](T x) { return std::log(x); }); }
+		FastVector<T> log_ppl() { return apply_ppl_func(SIMD_LOG, [](T x) { return std::log(x); }); }
+		/*Log e STD*/
+		FastVector<T> log_std() { return apply_std_func(SIMD_LOG, [](T x) { return std::log(x); }); }
 
 		/*Log 10 [hؑ*/
 		FastVector<T> log10() { return SWITCH_FAST_CONTAONER_FUNCTION(log10)(); }
@@ -56,15 +173,19 @@ namespace FastContainer {
 		FastVector<T> log10_amp() { return apply_amp_func([](T x) restrict(amp) { return concurrency::fast_math::log10(x); }); }
 		/*Log 10*/
 		FastVector<T> log10_ppl() { return apply_ppl_func([](T x) { return std::log10(x); }); }
+		/*Log 10 STD*/
+		FastVector<T> log10_std() { return apply_std_func([](T x) { return std::log10(x); }); }
 
 		/*2捪 [hؑ*/
 		FastVector<T> sqrt() { return SWITCH_FAST_CONTAONER_FUNCTION(sqrt)(); }
 		/*2捪*/
-		FastVector<T> sqrt_com() { return apply_com_func([](T x) { return std::sqrt(x); }); }
+		FastVector<T> sqrt_com() { return apply_com_func(SIMD_SQRT, [](T x) { return std::sqrt(x); }); }
 		/*2捪 AMP*/
 		FastVector<T> sqrt_amp() { return apply_amp_func([](T x) restrict(amp) { return concurrency::fast_math::sqrt(x); }); }
 		/*2捪 PPL*/
-		FastVector<T> sqrt_ppl() { return apply_ppl_func([](T x) { return std::sqrt(x); }); }
+		FastVector<T> sqrt_ppl() { return apply_ppl_func(SIMD_SQRT, [](T x) { return std::sqrt(x); }); }
+		/*2捪 STD*/
+		FastVector<T> sqrt_std() { return apply_std_func(SIMD_SQRT, [](T x) { return std::sqrt(x); }); }
 
 		/*K [hؑ*/
 		FastVector<T> pow(T exp) { return SWITCH_FAST_CONTAONER_FUNCTION(pow)(exp); }
@@ -74,33 +195,41 @@ namespace FastContainer {
 		FastVector<T> pow_amp(T exp) { return apply_amp_func([=](T x) restrict(amp) { return concurrency::fast_math::pow(x, exp); }); }
 		/*K PPL*/
 		FastVector<T> pow_ppl(T exp) { return apply_ppl_func([=](T x) { return std::pow(x, exp); }); }
+		/*K STD*/
+		FastVector<T> pow_std(T exp) { return apply_std_func([=](T x) { return std::pow(x, exp); }); }
 
 		/*e^x [hؑ*/
 		FastVector<T> exp() { return SWITCH_FAST_CONTAONER_FUNCTION(exp)(); }
 		/*e^x*/
-		FastVector<T> exp_com() { return apply_com_func([](T x) { return std::exp(x); }); }
+		FastVector<T> exp_com() { return apply_com_func(SIMD_EXP, [](T x) { return std::exp(x); }); }
 		/*e^x AMP*/
 		FastVector<T> exp_amp() { return apply_amp_func([](T x) restrict(amp) { return concurrency::fast_math::exp(x); }); }
 		/*e^x PPL*/
-		FastVector<T> exp_ppl() { return apply_ppl_func([](T x) { return std::exp(x); }); }
+		FastVector<T> exp_ppl() { return apply_ppl_func(SIMD_EXP, [](T x) { return std::exp(x); }); }
+		/*e^x STD*/
+		FastVector<T> exp_std() { return apply_std_func(SIMD_EXP, [](T x) { return std::exp(x); }); }
 
 		/*VOCh֐ [hؑ*/
 		FastVector<T> sigmoid() { return SWITCH_FAST_CONTAONER_FUNCTION(sigmoid)(); }
 		/*VOCh֐*/
-		FastVector<T> sigmoid_com() { return apply_com_func([](T x) { return (T)1 / (1 + std::exp(-x)); }); }
+		FastVector<T> sigmoid_com() { return apply_com_func(SIMD_SIGMOID, [](T x) { return (T)1 / (1 + std::exp(-x)); }); }
 		/*VOCh֐ AMP*/
 		FastVector<T> sigmoid_amp() { return apply_amp_func([](T x) restrict(amp) { return (T)1 / (1 + concurrency::fast_math::exp(-x)); }); }
 		/*VOCh֐ PPL*/
-		FastVector<T> sigmoid_ppl() { return apply_ppl_func([](T x) { return (T)1 / (1 + std::exp(-x)); }); }
+		FastVector<T> sigmoid_ppl() { return apply_ppl_func(SIMD_SIGMOID, [](T x) { return (T)1 / (1 + std::exp(-x)); }); }
+		/*VOCh֐ STD*/
+		FastVector<T> sigmoid_std() { return apply_std_func(SIMD_SIGMOID, [](T x) { return (T)1 / (1 + std::exp(-x)); }); }
 
 		/*ReLU֐ [hؑ*/
 		FastVector<T> relu() { return SWITCH_FAST_CONTAONER_FUNCTION(relu)(); }
 		/*ReLU֐*/
-		FastVector<T> relu_com() { return apply_com_func([](T x) { return x > 0 ? x : 0; }); }
+		FastVector<T> relu_com() { return apply_com_func(SIMD_RELU, [](T x) { return x > 0 ? x : (T)0; }); }
 		/*ReLU֐ AMP*/
-		FastVector<T> relu_amp() { return apply_amp_func([](T x) restrict(amp) { return x > 0 ? x : 0; }); }
+		FastVector<T> relu_amp() { return apply_amp_func([](T x) restrict(amp) { return x > 0 ? x : (T)0; }); }
 		/*ReLU֐ PPL*/
-		FastVector<T> relu_ppl() { return apply_ppl_func([](T x) { return x > 0 ? x : 0; }); }
+		FastVector<T> relu_ppl() { return apply_ppl_func(SIMD_RELU, [](T x) { return x > 0 ? x : (T)0; }); }
+		/*ReLU֐ STD*/
+		FastVector<T> relu_std() { return apply_std_func(SIMD_RELU, [](T x) { return x > 0 ? x : (T)0; }); }
 
 		/*K [hؑ*/
 		FastVector<T> normalization() { return SWITCH_FAST_CONTAONER_FUNCTION(normalization)(); }
@@ -119,6 +248,11 @@ namespace FastContainer {
 			T max = get_max();
 			return apply_ppl_func([=](T x) { return x / max; });
 		}
+		/*K STD*/
+		FastVector<T> normalization_std() {
+			T max = get_max();
+			return apply_std_func([=](T x) { return x / max; });
+		}
 
 		/*\tg}bNX֐ [hؑ*/
 		FastVector<T> softmax() { return SWITCH_FAST_CONTAONER_FUNCTION(softmax)(); }
@@ -140,6 +274,12 @@ namespace FastContainer {
 			auto ex = apply_ppl_func([=](T x) { return std::exp(x - max); });
 			return ex / ex.sum();
 		}
+		/*\tg}bNX֐ STD*/
+		FastVector<T> softmax_std() {
+			T max = get_max();
+			auto ex = apply_std_func([=](T x) { return std::exp(x - max); });
+			return ex / ex.sum();
+		}
 
 		/*l [hؑ
 		func: (T)(*func)(T x)*/
@@ -157,6 +297,10 @@ namespace FastContainer {
 		func: (T)(*func)(T x)*/
 		template<class F>
 		FastVector<T> num_diff_ppl(F func, T delta = 0.0001) { return apply_ppl_func([=](T x) { return (func(x + delta) - func(x - delta)) / (2 * delta); }); }
+		/*l STD
+		func: (T)(*func)(T x)*/
+		template<class F>
+		FastVector<T> num_diff_std(F func, T delta = 0.0001) { return apply_std_func([=](T x) { return (func(x + delta) - func(x - delta)) / (2 * delta); }); }
 
 		/*Ggs[덷 [hؑ*/
 		T cross_entropy_error(FastVector<T>& teacher, T delta = 0.0000001) { return SWITCH_FAST_CONTAONER_FUNCTION(cross_entropy_error)(teacher, delta); }
@@ -175,59 +319,118 @@ namespace FastContainer {
 			auto buf = apply_ppl_combo_func([=](T x1, T x2) { return -1 * x2 * std::log(x1 + delta) + (1 - x2) * std::log(1 - x1 + delta); }, teacher);
 			return buf.sum();
 		}
+		/*Ggs[덷 STD*/
+		T cross_entropy_error_std(FastVector<T>& teacher, T delta = 0.0000001) {
+			auto buf = apply_std_combo_func([=](T x1, T x2) { return -1 * x2 * std::log(x1 + delta) + (1 - x2) * std::log(1 - x1 + delta); }, teacher);
+			return buf.sum();
+		}
 
 		/*Ggs[덷 ޖ [hؑ*/
 		T cross_entropy_error_class(FastVector<T>& teacher, T delta = 0.0000001) { return SWITCH_FAST_CONTAONER_FUNCTION(cross_entropy_error_class)(teacher, delta); }
 		/*Ggs[덷 ޖ*/
 		T cross_entropy_error_class_com(FastVector<T>& teacher, T delta = 0.0000001) {
-			auto buf = apply_com_combo_func([=](T x1, T x2) { return -1 * x2 * std::log(x1 + delta) }, teacher);
+			auto buf = apply_com_combo_func([=](T x1, T x2) { return -1 * x2 * std::log(x1 + delta); }, teacher);
 			return buf.sum();
 		}
 		/*Ggs[덷 ޖ AMP*/
 		T cross_entropy_error_class_amp(FastVector<T>& teacher, T delta = 0.0000001) {
-			auto buf = apply_amp_combo_func([=](T x1, T x2) restrict(amp) { return -1 * x2 * concurrency::fast_math::log(x1 + delta) }, teacher);
+			auto buf = apply_amp_combo_func([=](T x1, T x2) restrict(amp) { return -1 * x2 * concurrency::fast_math::log(x1 + delta); }, teacher);
 			return buf.sum();
 		}
 		/*Ggs[덷 ޖ PPL*/
 		T cross_entropy_error_class_ppl(FastVector<T>& teacher, T delta = 0.0000001) {
-			auto buf = apply_ppl_combo_func([=](T x1, T x2) { return -1 * x2 * std::log(x1 + delta) }, teacher);
+			auto buf = apply_ppl_combo_func([=](T x1, T x2) { return -1 * x2 * std::log(x1 + delta); }, teacher);
+			return buf.sum();
+		}
+		/*Ggs[덷 ޖ STD*/
+		T cross_entropy_error_class_std(FastVector<T>& teacher, T delta = 0.0000001) {
+			auto buf = apply_std_combo_func([=](T x1, T x2) { return -1 * x2 * std::log(x1 + delta); }, teacher);
 			return buf.sum();
 		}
 
+		/*ŏl [hؑ*/
+		T get_min() const { return SWITCH_FAST_CONTAONER_FUNCTION(get_min)(); }
 		/*ŏl*/
-		T get_min() {
-			T result = entity[0];
-			for (auto x : entity) result = min(result, x);
-			return result;
+		T get_min_com() const {
+			SerialExecutor exec;
+			return reduce_min(get_data(), size, exec);
+		}
+		/*ŏl AMP (zXgŏWv)*/
+		T get_min_amp() const {
+			PplExecutor exec;
+			return reduce_min(get_data(), size, exec);
+		}
+		/*ŏl PPL*/
+		T get_min_ppl() const {
+			PplExecutor exec;
+			return reduce_min(get_data(), size, exec);
 		}
+		/*ŏl STD*/
+		T get_min_std() const { return reduce_min(get_data(), size, ThreadPool::get_instance()); }
+		/*ől [hؑ*/
+		T get_max() const { return SWITCH_FAST_CONTAONER_FUNCTION(get_max)(); }
 		/*ől*/
-		T get_max() {
-			T result = entity[0];
-			for (auto x : entity) result = max(result, x);
-			return result;
-		}
-		/*ől̃CfbNX*/
-		T get_argmax() {
-			int result = 0;
-			int i = 0;
-			T max = entity[i];
-			for (auto x : entity) {
-				if (max < x) {
-					max = x;
-					result = i;
-				}
-				++i;
-			}
-			return result;
+		T get_max_com() const {
+			SerialExecutor exec;
+			return reduce_max(get_data(), size, exec);
+		}
+		/*ől AMP (zXgŏWv)*/
+		T get_max_amp() const {
+			PplExecutor exec;
+			return reduce_max(get_data(), size, exec);
+		}
+		/*ől PPL*/
+		T get_max_ppl() const {
+			PplExecutor exec;
+			return reduce_max(get_data(), size, exec);
+		}
+		/*ől STD*/
+		T get_max_std() const { return reduce_max(get_data(), size, ThreadPool::get_instance()); }
+		/*ől̃CfbNX (ől΍ŏ̂) [hؑ*/
+		int get_argmax() const { return SWITCH_FAST_CONTAONER_FUNCTION(get_argmax)(); }
+		/*ől̃CfbNX (ől΍ŏ̂)*/
+		int get_argmax_com() const {
+			SerialExecutor exec;
+			return reduce_argmax(get_data(), size, exec);
+		}
+		/*ől̃CfbNX (ől΍ŏ̂) AMP (zXgŏWv)*/
+		int get_argmax_amp() const {
+			PplExecutor exec;
+			return reduce_argmax(get_data(), size, exec);
+		}
+		/*ől̃CfbNX (ől΍ŏ̂) PPL*/
+		int get_argmax_ppl() const {
+			PplExecutor exec;
+			return reduce_argmax(get_data(), size, exec);
 		}
+		/*ől̃CfbNX (ől΍ŏ̂) STD*/
+		int get_argmax_std() const { return reduce_argmax(get_data(), size, ThreadPool::get_instance()); }
+		/*v [hؑ*/
+		T sum() const { return SWITCH_FAST_CONTAONER_FUNCTION(sum)(); }
 		/*v*/
-		T sum() {
-			T result = 0;
-			for (auto x : entity) result += x;
-			return result;
+		T sum_com() const {
+			SerialExecutor exec;
+			return reduce_sum(get_data(), size, exec);
+		}
+		/*v AMP (zXgŏWv)*/
+		T sum_amp() const {
+			PplExecutor exec;
+			return reduce_sum(get_data(), size, exec);
+		}
+		/*v PPL*/
+		T sum_ppl() const {
+			PplExecutor exec;
+			return reduce_sum(get_data(), size, exec);
+		}
+		/*v STD*/
+		T sum_std() const { return reduce_sum(get_data(), size, ThreadPool::get_instance()); }
+		/*␳t̍v (v̌vZ̐ݒɊ֌WȂKahan@)*/
+		T sum_kahan() const {
+			PplExecutor exec;
+			return reduce_sum(get_data(), size, exec, REDUCE_KAHAN);
 		}
 		/**/
-		T mean() {
+		T mean() const {
 			return sum() / size;
 		}
 
@@ -274,6 +477,15 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*[0]`[size]܂ł擾 STD*/
+		FastVector<T> take_std(int size) {
+			if (size > this->size) throw fast_container_exception();
+			FastVector<T> result(size);
+			parallel_for(0, size, [&](int i) {
+				result[i] = entity[i];
+			});
+			return result;
+		}
 
 		/*[size]`[end]܂ł擾 [hؑ*/
 		FastVector<T> skip(int size) { return SWITCH_FAST_CONTAONER_FUNCTION(skip)(size); }
@@ -311,6 +523,16 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*[size]`[end]܂ł擾 STD*/
+		FastVector<T> skip_std(int size) {
+			if (size > this->size) throw fast_container_exception();
+			int res_size = this->size - size;
+			FastVector<T> result(res_size);
+			parallel_for(0, res_size, [&](int i) {
+				result[i] = entity[size + i];
+			});
+			return result;
+		}
 
 		/*ob`̎擾 [hؑ*/
 		FastVector<T> batch(FastVector<int>& mask) { return SWITCH_FAST_CONTAONER_FUNCTION(batch)(mask); }
@@ -349,20 +571,44 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*ob`̎擾 STD*/
+		FastVector<T> batch_std(FastVector<int>& mask) {
+			if (size < mask.get_size()) throw fast_container_exception();
+			int m_size = mask.get_size();
+			FastVector<T> result(m_size);
+			parallel_for(0, m_size, [&](int i) {
+				result[i] = entity[mask[i]];
+			});
+			return result;
+		}
 
 		/*_ȃob`̎擾 [hؑ*/
 		FastVector<T> random_batch(int size) { return SWITCH_FAST_CONTAONER_FUNCTION(random_batch)(size); }
 		/*_ȃob`̎擾*/
-		FastVector<T> random_batch_com(int size) { return batch_com(FastVector<int>::int_hash_random(size, 0, this->size - 1)); }
+		FastVector<T> random_batch_com(int size) {
+			auto mask = FastVector<int>::int_hash_random(size, 0, this->size - 1);
+			return batch_com(mask);
+		}
 		/*_ȃob`̎擾 AMP*/
-		FastVector<T> random_batch_amp(int size) { return batch_amp(FastVector<int>::int_hash_random(size, 0, this->size - 1)); }
+		FastVector<T> random_batch_amp(int size) {
+			auto mask = FastVector<int>::int_hash_random(size, 0, this->size - 1);
+			return batch_amp(mask);
+		}
 		/*_ȃob`̎擾 PPL*/
-		FastVector<T> random_batch_ppl(int size) { return batch_ppl(FastVector<int>::int_hash_random(size, 0, this->size - 1)); }
+		FastVector<T> random_batch_ppl(int size) {
+			auto mask = FastVector<int>::int_hash_random(size, 0, this->size - 1);
+			return batch_ppl(mask);
+		}
+		/*_ȃob`̎擾 STD*/
+		FastVector<T> random_batch_std(int size) {
+			auto mask = FastVector<int>::int_hash_random(size, 0, this->size - 1);
+			return batch_std(mask);
+		}
 
 		/*֐Kp
 		func: T(*func)(T x)*/
 		template<class F>
-		FastVector<T> apply_com_func(F func) {
+		FastVector<T> apply_com_func(F func) const {
 			FastVector<T> result(size);
 			for (int i = 0; i < size; i++) {
 				result[i] = func(entity[i]);
@@ -372,7 +618,7 @@ namespace FastContainer {
 		/*֐Kp AMP
 		func: T(*func)(T x) restrict(amp)*/
 		template<class F>
-		FastVector<T> apply_amp_func(F func) {
+		FastVector<T> apply_amp_func(F func) const {
 			FastVector<T> result(size);
 			concurrency::array_view<const T, 1> av_entity(size, &entity[0]);
 			concurrency::array_view<T, 1> av_result(size, &result[0]);
@@ -386,18 +632,28 @@ namespace FastContainer {
 		/*֐Kp PPL
 		func: T(*func)(T x)*/
 		template<class F>
-		FastVector<T> apply_ppl_func(F func) {
+		FastVector<T> apply_ppl_func(F func) const {
 			FastVector<T> result(size);
 			concurrency::parallel_for<int>(0, size, [&](int i) {
 				result[i] = func(entity[i]);
 			});
 			return result;
 		}
+		/*֐Kp STD
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_std_func(F func) const {
+			FastVector<T> result(size);
+			parallel_for(0, size, [&](int i) {
+				result[i] = func(entity[i]);
+			});
+			return result;
+		}
 
 		/*֐Kp
 		func: T(*func)(T x1, T x2)*/
 		template<class F>
-		FastVector<T> apply_com_combo_func(F func, FastVector<T>& vec) {
+		FastVector<T> apply_com_combo_func(F func, const FastVector<T>& vec) const {
 			if (size != vec.get_size()) throw fast_container_exception();
 			FastVector<T> result(size);
 			for (int i = 0; i < size; i++) {
@@ -408,7 +664,7 @@ namespace FastContainer {
 		/*֐Kp AMP
 		func: T(*func)(T x1, T x2) restrict(amp)*/
 		template<class F>
-		FastVector<T> apply_amp_combo_func(F func, FastVector<T>& vec) {
+		FastVector<T> apply_amp_combo_func(F func, const FastVector<T>& vec) const {
 			if (size != vec.get_size()) throw fast_container_exception();
 			FastVector<T> result(size);
 			concurrency::array_view<const T, 1> av_entity(size, &entity[0]);
@@ -424,7 +680,7 @@ namespace FastContainer {
 		/*֐Kp PPL
 		func: T(*func)(T x1, T x2)*/
 		template<class F>
-		FastVector<T> apply_ppl_combo_func(F func, FastVector<T>& vec) {
+		FastVector<T> apply_ppl_combo_func(F func, const FastVector<T>& vec) const {
 			if (size != vec.get_size()) throw fast_container_exception();
 			FastVector<T> result(size);
 			concurrency::parallel_for<int>(0, size, [&](int i) {
@@ -432,6 +688,215 @@ namespace FastContainer {
 			});
 			return result;
 		}
+		/*֐Kp STD
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastVector<T> apply_std_combo_func(F func, const FastVector<T>& vec) const {
+			if (size != vec.get_size()) throw fast_container_exception();
+			FastVector<T> result(size);
+			parallel_for(0, size, [&](int i) {
+				result[i] = func(entity[i], vec[i]);
+			});
+			return result;
+		}
+
+		/*֐Kp (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_com_func(SimdUnaryOp op, F func) const {
+			SerialExecutor exec;
+			return apply_simd_func(op, func, exec);
+		}
+		/*֐Kp PPL (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_ppl_func(SimdUnaryOp op, F func) const {
+			PplExecutor exec;
+			return apply_simd_func(op, func, exec);
+		}
+		/*֐Kp STD (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_std_func(SimdUnaryOp op, F func) const { return apply_simd_func(op, func, ThreadPool::get_instance()); }
+		/*֐Kp AUTO (vfŒsXbhsI)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_auto_func(SimdUnaryOp op, F func) const {
+			AutoExecutor exec(DISPATCH_OP_ELEMENTWISE, size);
+			return apply_simd_func(op, func, exec);
+		}
+		/*֐Kp SIMD
+		exec: s*/
+		template<class F, class E>
+		FastVector<T> apply_simd_func(SimdUnaryOp op, F func, E& exec) const {
+			FastVector<T> result(size);
+			if (size == 0) return result;
+			if (simd_unary(op, &entity[0], &result[0], size, exec)) return result;
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) result[i] = func(entity[i]);
+			}, SIMD_GRAIN);
+			return result;
+		}
+
+		/*XJ[lƂ̊֐Kp (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_com_func(SimdBinaryOp op, T val, F func) const {
+			SerialExecutor exec;
+			return apply_simd_func(op, val, func, exec);
+		}
+		/*XJ[lƂ̊֐Kp PPL (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_ppl_func(SimdBinaryOp op, T val, F func) const {
+			PplExecutor exec;
+			return apply_simd_func(op, val, func, exec);
+		}
+		/*XJ[lƂ̊֐Kp STD (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_std_func(SimdBinaryOp op, T val, F func) const { return apply_simd_func(op, val, func, ThreadPool::get_instance()); }
+		/*XJ[lƂ̊֐Kp AUTO (vfŒsXbhsI)
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_auto_func(SimdBinaryOp op, T val, F func) const {
+			AutoExecutor exec(DISPATCH_OP_ELEMENTWISE, size);
+			return apply_simd_func(op, val, func, exec);
+		}
+		/*XJ[lƂ̊֐Kp SIMD
+		exec: s*/
+		template<class F, class E>
+		FastVector<T> apply_simd_func(SimdBinaryOp op, T val, F func, E& exec) const {
+			FastVector<T> result(size);
+			if (size == 0) return result;
+			if (simd_binary_scalar(op, &entity[0], val, &result[0], size, exec)) return result;
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) result[i] = func(entity[i]);
+			}, SIMD_GRAIN);
+			return result;
+		}
+
+		/*֐Kp (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastVector<T> apply_com_combo_func(SimdBinaryOp op, F func, const FastVector<T>& vec) const {
+			SerialExecutor exec;
+			return apply_simd_combo_func(op, func, vec, exec);
+		}
+		/*֐Kp PPL (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastVector<T> apply_ppl_combo_func(SimdBinaryOp op, F func, const FastVector<T>& vec) const {
+			PplExecutor exec;
+			return apply_simd_combo_func(op, func, vec, exec);
+		}
+		/*֐Kp STD (float, doubleopSIMD߂ŌvZ)
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastVector<T> apply_std_combo_func(SimdBinaryOp op, F func, const FastVector<T>& vec) const { return apply_simd_combo_func(op, func, vec, ThreadPool::get_instance()); }
+		/*֐Kp AUTO (vfŒsXbhsI)
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastVector<T> apply_auto_combo_func(SimdBinaryOp op, F func, const FastVector<T>& vec) const {
+			AutoExecutor exec(DISPATCH_OP_ELEMENTWISE, size);
+			return apply_simd_combo_func(op, func, vec, exec);
+		}
+		/*֐Kp SIMD
+		exec: s*/
+		template<class F, class E>
+		FastVector<T> apply_simd_combo_func(SimdBinaryOp op, F func, const FastVector<T>& vec, E& exec) const {
+			if (size != vec.get_size()) throw fast_container_exception();
+			FastVector<T> result(size);
+			if (size == 0) return result;
+			if (simd_binary(op, &entity[0], &vec[0], &result[0], size, exec)) return result;
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) result[i] = func(entity[i], vec[i]);
+			}, SIMD_GRAIN);
+			return result;
+		}
+
+		/*֐Kpď㏑
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T>& apply_inplace_com(F func) {
+			for (auto&& y : entity) y = func(y);
+			return *this;
+		}
+		/*֐Kpď㏑ AMP
+		func: T(*func)(T x) restrict(amp)*/
+		template<class F>
+		FastVector<T>& apply_inplace_amp(F func) {
+			if (size == 0) return *this;
+			concurrency::array_view<T, 1> av_entity(size, &entity[0]);
+			concurrency::parallel_for_each(av_entity.extent, [=](concurrency::index<1> idx) restrict(amp) {
+				av_entity[idx] = func(av_entity[idx]);
+			});
+			av_entity.synchronize();
+			return *this;
+		}
+		/*֐Kpď㏑ PPL
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T>& apply_inplace_ppl(F func) {
+			concurrency::parallel_for<int>(0, size, [&](int i) {
+				entity[i] = func(entity[i]);
+			});
+			return *this;
+		}
+		/*֐Kpď㏑ STD
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T>& apply_inplace_std(F func) {
+			parallel_for(0, size, [&](int i) {
+				entity[i] = func(entity[i]);
+			});
+			return *this;
+		}
+
+		/*֐Kpď㏑
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastVector<T>& apply_combo_inplace_com(F func, const FastVector<T>& vec) {
+			if (size != vec.get_size()) throw fast_container_exception();
+			for (int i = 0; i < size; i++) {
+				entity[i] = func(entity[i], vec[i]);
+			}
+			return *this;
+		}
+		/*֐Kpď㏑ AMP
+		func: T(*func)(T x1, T x2) restrict(amp)*/
+		template<class F>
+		FastVector<T>& apply_combo_inplace_amp(F func, const FastVector<T>& vec) {
+			if (size != vec.get_size()) throw fast_container_exception();
+			if (size == 0) return *this;
+			concurrency::array_view<T, 1> av_entity(size, &entity[0]);
+			concurrency::array_view<const T, 1> av_vec(size, &vec[0]);
+			concurrency::parallel_for_each(av_entity.extent, [=](concurrency::index<1> idx) restrict(amp) {
+				av_entity[idx] = func(av_entity[idx], av_vec[idx]);
+			});
+			av_entity.synchronize();
+			return *this;
+		}
+		/*֐Kpď㏑ PPL
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastVector<T>& apply_combo_inplace_ppl(F func, const FastVector<T>& vec) {
+			if (size != vec.get_size()) throw fast_container_exception();
+			concurrency::parallel_for<int>(0, size, [&](int i) {
+				entity[i] = func(entity[i], vec[i]);
+			});
+			return *this;
+		}
+		/*֐Kpď㏑ STD
+		func: T(*func)(T x1, T x2)*/
+		template<class F>
+		FastVector<T>& apply_combo_inplace_std(F func, const FastVector<T>& vec) {
+			if (size != vec.get_size()) throw fast_container_exception();
+			parallel_for(0, size, [&](int i) {
+				entity[i] = func(entity[i], vec[i]);
+			});
+			return *this;
+		}
 
 		/*[size] (value1,value2,...)*/
 		std::string to_string() {
@@ -448,39 +913,87 @@ namespace FastContainer {
 		/*_FastVector𐶐*/
 		static FastVector<T> real_random_com(int size, T min = -1, T max = 1) {
 			FastVector<T> result(size);
-			RealRandom<T> rnd(min, max);
-			return result.apply_com_func([&](T x) { return rnd.generate(); });
+			SerialExecutor exec;
+			random_uniform(result.get_data(), size, min, max, next_random_seed(), exec);
+			return result;
 		}
 		/*_FastVector𐶐 PPL*/
 		static FastVector<T> real_random_ppl(int size, T min = -1, T max = 1) {
 			FastVector<T> result(size);
-			RealRandom<T> rnd(min, max);
-			return result.apply_ppl_func([&](T x) { return rnd.generate(); });
+			PplExecutor exec;
+			random_uniform(result.get_data(), size, min, max, next_random_seed(), exec);
+			return result;
+		}
+		/*_FastVector𐶐 STD*/
+		static FastVector<T> real_random_std(int size, T min = -1, T max = 1) {
+			FastVector<T> result(size);
+			random_uniform(result.get_data(), size, min, max, next_random_seed(), ThreadPool::get_instance());
+			return result;
 		}
 		/*_FastVector<int>𐶐*/
 		static FastVector<T> int_random_com(int size, int min = -1, int max = 1) {
 			FastVector<T> result(size);
-			IntRandom rnd(min, max);
-			return result.apply_com_func([&](T x) { return rnd.generate(); });
+			SerialExecutor exec;
+			random_int(result.get_data(), size, min, max, next_random_seed(), exec);
+			return result;
 		}
 		/*_FastVector<int>𐶐 PPL*/
 		static FastVector<T> int_random_ppl(int size, int min = -1, int max = 1) {
 			FastVector<T> result(size);
-			IntRandom rnd(min, max);
-			return result.apply_ppl_func([&](T x) { return rnd.generate(); });
+			PplExecutor exec;
+			random_int(result.get_data(), size, min, max, next_random_seed(), exec);
+			return result;
+		}
+		/*_FastVector<int>𐶐 STD*/
+		static FastVector<T> int_random_std(int size, int min = -1, int max = 1) {
+			FastVector<T> result(size);
+			random_int(result.get_data(), size, min, max, next_random_seed(), ThreadPool::get_instance());
+			return result;
 		}
 		/*:mean, W΍:sd _FastVector𐶐*/
 		static FastVector<T> normal_random_com(int size, T mean = 0, T sd = 1) {
 			FastVector<T> result(size);
-			NormalRandom<T> rnd(mean, sd);
-			return result.apply_com_func([&](T x) { return rnd.generate(); });
+			SerialExecutor exec;
+			random_normal(result.get_data(), size, mean, sd, next_random_seed(), exec);
+			return result;
 		}
 		/*:mean, W΍:sd _FastVector𐶐 PPL*/
 		static FastVector<T> normal_random_ppl(int size, T mean = 0, T sd = 1) {
 			FastVector<T> result(size);
-			NormalRandom<T> rnd(mean, sd);
-			return result.apply_ppl_func([&](T x) { return rnd.generate(); });
+			PplExecutor exec;
+			random_normal(result.get_data(), size, mean, sd, next_random_seed(), exec);
+			return result;
+		}
+		/*:mean, W΍:sd _FastVector𐶐 STD*/
+		static FastVector<T> normal_random_std(int size, T mean = 0, T sd = 1) {
+			FastVector<T> result(size);
+			random_normal(result.get_data(), size, mean, sd, next_random_seed(), ThreadPool::get_instance());
+			return result;
+		}
+		/*
+		g min`max ̈lŖ߂ (̈ėpASIMDł܂Ƃ߂Đ)
+		seed: ̎ (ȂsɊւ炸l)
+		exec: s
+		*/
+		template<class E>
+		FastVector<T>& fill_real_random(T min, T max, uint64_t seed, E& exec) {
+			random_uniform(get_data(), size, min, max, seed, exec);
+			return *this;
 		}
+		/*g min`max ̈lŖ߂*/
+		FastVector<T>& fill_real_random(T min = -1, T max = 1) { return fill_real_random(min, max, next_random_seed(), ThreadPool::get_instance()); }
+		/*
+		g :mean, W΍:sd ̐KŖ߂ (̈ėpASIMDł܂Ƃ߂Đ)
+		seed: ̎ (ȂsɊւ炸l)
+		exec: s
+		*/
+		template<class E>
+		FastVector<T>& fill_normal_random(T mean, T sd, uint64_t seed, E& exec) {
+			random_normal(get_data(), size, mean, sd, seed, exec);
+			return *this;
+		}
+		/*g :mean, W΍:sd ̐KŖ߂*/
+		FastVector<T>& fill_normal_random(T mean = 0, T sd = 1) { return fill_normal_random(mean, sd, next_random_seed(), ThreadPool::get_instance()); }
 		/*d̂Ȃ_FastVector<int>𐶐*/
 		static FastVector<T> int_hash_random(int size, int min, int max) {
 			FastVector<T> result(size);
@@ -489,205 +1002,335 @@ namespace FastContainer {
 		}
 
 	private:
-		std::vector<T> entity;
-		int size;
+		FastStorage<T> entity;
+		int size = 0;
 	};
 
 
 #ifdef FAST_CONTAONER_OPERATOR_OVERLOAD_COM_MODE
 
 	template<typename T>
-	FastVector<T> operator+(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_com_combo_func([](T x1, T x2) {return x1 + x2; }, vec2); }
+	FastVector<T> operator+(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_com_combo_func(SIMD_ADD, [](T x1, T x2) {return x1 + x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator-(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_com_combo_func([](T x1, T x2) {return x1 - x2; }, vec2); }
+	FastVector<T> operator-(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_com_combo_func(SIMD_SUB, [](T x1, T x2) {return x1 - x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator*(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_com_combo_func([](T x1, T x2) {return x1 * x2; }, vec2); }
+	FastVector<T> operator*(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_com_combo_func(SIMD_MUL, [](T x1, T x2) {return x1 * x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator/(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_com_combo_func([](T x1, T x2) {return x1 / x2; }, vec2); }
+	FastVector<T> operator/(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_com_combo_func(SIMD_DIV, [](T x1, T x2) {return x1 / x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator==(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_com_combo_func([](T x1, T x2) {return x1 == x2; }, vec2); }
+	FastVector<T> operator==(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_com_combo_func(SIMD_EQ, [](T x1, T x2) {return x1 == x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator!=(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_com_combo_func([](T x1, T x2) {return x1 != x2; }, vec2); }
+	FastVector<T> operator!=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_com_combo_func(SIMD_NE, [](T x1, T x2) {return x1 != x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator>(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_com_combo_func([](T x1, T x2) {return x1 > x2; }, vec2); }
+	FastVector<T> operator>(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_com_combo_func(SIMD_GT, [](T x1, T x2) {return x1 > x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator<(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_com_combo_func([](T x1, T x2) {return x1 < x2; }, vec2); }
+	FastVector<T> operator<(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_com_combo_func(SIMD_LT, [](T x1, T x2) {return x1 < x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator>=(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_com_combo_func([](T x1, T x2) {return x1 >= x2; }, vec2); }
+	FastVector<T> operator>=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_com_combo_func(SIMD_GE, [](T x1, T x2) {return x1 >= x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator<=(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_com_combo_func([](T x1, T x2) {return x1 <= x2; }, vec2); }
+	FastVector<T> operator<=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_com_combo_func(SIMD_LE, [](T x1, T x2) {return x1 <= x2; }, vec2); }
 
 	template<typename T>
-	FastVector<T> operator+(T val, FastVector<T>& vec) { return vec.apply_com_func([=](T x) {return val + x; }); }
+	FastVector<T> operator+(T val, const FastVector<T>& vec) { return vec.apply_com_func(SIMD_ADD, val, [=](T x) {return val + x; }); }
 	template<typename T>
-	FastVector<T> operator-(T val, FastVector<T>& vec) { return vec.apply_com_func([=](T x) {return val - x; }); }
+	FastVector<T> operator-(T val, const FastVector<T>& vec) { return vec.apply_com_func(SIMD_RSUB, val, [=](T x) {return val - x; }); }
 	template<typename T>
-	FastVector<T> operator*(T val, FastVector<T>& vec) { return vec.apply_com_func([=](T x) {return val * x; }); }
+	FastVector<T> operator*(T val, const FastVector<T>& vec) { return vec.apply_com_func(SIMD_MUL, val, [=](T x) {return val * x; }); }
 	template<typename T>
-	FastVector<T> operator/(T val, FastVector<T>& vec) { return vec.apply_com_func([=](T x) {return val / x; }); }
+	FastVector<T> operator/(T val, const FastVector<T>& vec) { return vec.apply_com_func(SIMD_RDIV, val, [=](T x) {return val / x; }); }
 	template<typename T>
-	FastVector<T> operator==(T val, FastVector<T>& vec) { return vec.apply_com_func([=](T x) {return val == x; }); }
+	FastVector<T> operator==(T val, const FastVector<T>& vec) { return vec.apply_com_func(SIMD_EQ, val, [=](T x) {return val == x; }); }
 	template<typename T>
-	FastVector<T> operator!=(T val, FastVector<T>& vec) { return vec.apply_com_func([=](T x) {return val != x; }); }
+	FastVector<T> operator!=(T val, const FastVector<T>& vec) { return vec.apply_com_func(SIMD_NE, val, [=](T x) {return val != x; }); }
 	template<typename T>
-	FastVector<T> operator>(T val, FastVector<T>& vec) { return vec.apply_com_func([=](T x) {return val > x; }); }
+	FastVector<T> operator>(T val, const FastVector<T>& vec) { return vec.apply_com_func(SIMD_LT, val, [=](T x) {return val > x; }); }
 	template<typename T>
-	FastVector<T> operator<(T val, FastVector<T>& vec) { return vec.apply_com_func([=](T x) {return val < x; }); }
+	FastVector<T> operator<(T val, const FastVector<T>& vec) { return vec.apply_com_func(SIMD_GT, val, [=](T x) {return val < x; }); }
 	template<typename T>
-	FastVector<T> operator>=(T val, FastVector<T>& vec) { return vec.apply_com_func([=](T x) {return val >= x; }); }
+	FastVector<T> operator>=(T val, const FastVector<T>& vec) { return vec.apply_com_func(SIMD_LE, val, [=](T x) {return val >= x; }); }
 	template<typename T>
-	FastVector<T> operator<=(T val, FastVector<T>& vec) { return vec.apply_com_func([=](T x) {return val <= x; }); }
+	FastVector<T> operator<=(T val, const FastVector<T>& vec) { return vec.apply_com_func(SIMD_GE, val, [=](T x) {return val <= x; }); }
 
 	template<typename T>
-	FastVector<T> operator+(FastVector<T>& vec, T val) { return vec.apply_com_func([=](T x) {return x + val; }); }
+	FastVector<T> operator+(const FastVector<T>& vec, T val) { return vec.apply_com_func(SIMD_ADD, val, [=](T x) {return x + val; }); }
 	template<typename T>
-	FastVector<T> operator-(FastVector<T>& vec, T val) { return vec.apply_com_func([=](T x) {return x - val; }); }
+	FastVector<T> operator-(const FastVector<T>& vec, T val) { return vec.apply_com_func(SIMD_SUB, val, [=](T x) {return x - val; }); }
 	template<typename T>
-	FastVector<T> operator*(FastVector<T>& vec, T val) { return vec.apply_com_func([=](T x) {return x * val; }); }
+	FastVector<T> operator*(const FastVector<T>& vec, T val) { return vec.apply_com_func(SIMD_MUL, val, [=](T x) {return x * val; }); }
 	template<typename T>
-	FastVector<T> operator/(FastVector<T>& vec, T val) { return vec.apply_com_func([=](T x) {return x / val; }); }
+	FastVector<T> operator/(const FastVector<T>& vec, T val) { return vec.apply_com_func(SIMD_DIV, val, [=](T x) {return x / val; }); }
 	template<typename T>
-	FastVector<T> operator==(FastVector<T>& vec, T val) { return vec.apply_com_func([=](T x) {return x == val; }); }
+	FastVector<T> operator==(const FastVector<T>& vec, T val) { return vec.apply_com_func(SIMD_EQ, val, [=](T x) {return x == val; }); }
 	template<typename T>
-	FastVector<T> operator!=(FastVector<T>& vec, T val) { return vec.apply_com_func([=](T x) {return x != val; }); }
+	FastVector<T> operator!=(const FastVector<T>& vec, T val) { return vec.apply_com_func(SIMD_NE, val, [=](T x) {return x != val; }); }
 	template<typename T>
-	FastVector<T> operator>(FastVector<T>& vec, T val) { return vec.apply_com_func([=](T x) {return x > val; }); }
+	FastVector<T> operator>(const FastVector<T>& vec, T val) { return vec.apply_com_func(SIMD_GT, val, [=](T x) {return x > val; }); }
 	template<typename T>
-	FastVector<T> operator<(FastVector<T>& vec, T val) { return vec.apply_com_func([=](T x) {return x < val; }); }
+	FastVector<T> operator<(const FastVector<T>& vec, T val) { return vec.apply_com_func(SIMD_LT, val, [=](T x) {return x < val; }); }
 	template<typename T>
-	FastVector<T> operator>=(FastVector<T>& vec, T val) { return vec.apply_com_func([=](T x) {return x >= val; }); }
+	FastVector<T> operator>=(const FastVector<T>& vec, T val) { return vec.apply_com_func(SIMD_GE, val, [=](T x) {return x >= val; }); }
 	template<typename T>
-	FastVector<T> operator<=(FastVector<T>& vec, T val) { return vec.apply_com_func([=](T x) {return x <= val; }); }
+	FastVector<T> operator<=(const FastVector<T>& vec, T val) { return vec.apply_com_func(SIMD_LE, val, [=](T x) {return x <= val; }); }
 
 #elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_AMP_MODE
 
 	template<typename T>
-	FastVector<T> operator+(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 + x2; }, vec2); }
+	FastVector<T> operator+(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 + x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator-(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 - x2; }, vec2); }
+	FastVector<T> operator-(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 - x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator*(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 * x2; }, vec2); }
+	FastVector<T> operator*(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 * x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator/(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 / x2; }, vec2); }
+	FastVector<T> operator/(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 / x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator==(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 == x2; }, vec2); }
+	FastVector<T> operator==(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 == x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator!=(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 != x2; }, vec2); }
+	FastVector<T> operator!=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 != x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator>(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 > x2; }, vec2); }
+	FastVector<T> operator>(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 > x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator<(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 < x2; }, vec2); }
+	FastVector<T> operator<(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 < x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator>=(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 >= x2; }, vec2); }
+	FastVector<T> operator>=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 >= x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator<=(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 <= x2; }, vec2); }
+	FastVector<T> operator<=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_amp_combo_func([](T x1, T x2) restrict(amp) {return x1 <= x2; }, vec2); }
 
 	template<typename T>
-	FastVector<T> operator+(T val, FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val + x; }); }
+	FastVector<T> operator+(T val, const FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val + x; }); }
 	template<typename T>
-	FastVector<T> operator-(T val, FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val - x; }); }
+	FastVector<T> operator-(T val, const FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val - x; }); }
 	template<typename T>
-	FastVector<T> operator*(T val, FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val * x; }); }
+	FastVector<T> operator*(T val, const FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val * x; }); }
 	template<typename T>
-	FastVector<T> operator/(T val, FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val / x; }); }
+	FastVector<T> operator/(T val, const FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val / x; }); }
 	template<typename T>
-	FastVector<T> operator==(T val, FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val == x; }); }
+	FastVector<T> operator==(T val, const FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val == x; }); }
 	template<typename T>
-	FastVector<T> operator!=(T val, FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val != x; }); }
+	FastVector<T> operator!=(T val, const FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val != x; }); }
 	template<typename T>
-	FastVector<T> operator>(T val, FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val > x; }); }
+	FastVector<T> operator>(T val, const FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val > x; }); }
 	template<typename T>
-	FastVector<T> operator<(T val, FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val < x; }); }
+	FastVector<T> operator<(T val, const FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val < x; }); }
 	template<typename T>
-	FastVector<T> operator>=(T val, FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val >= x; }); }
+	FastVector<T> operator>=(T val, const FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val >= x; }); }
 	template<typename T>
-	FastVector<T> operator<=(T val, FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val <= x; }); }
+	FastVector<T> operator<=(T val, const FastVector<T>& vec) { return vec.apply_amp_func([=](T x) restrict(amp) {return val <= x; }); }
 
 	template<typename T>
-	FastVector<T> operator+(FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x + val; }); }
+	FastVector<T> operator+(const FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x + val; }); }
 	template<typename T>
-	FastVector<T> operator-(FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x - val; }); }
+	FastVector<T> operator-(const FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x - val; }); }
 	template<typename T>
-	FastVector<T> operator*(FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x * val; }); }
+	FastVector<T> operator*(const FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x * val; }); }
 	template<typename T>
-	FastVector<T> operator/(FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x / val; }); }
+	FastVector<T> operator/(const FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x / val; }); }
 	template<typename T>
-	FastVector<T> operator==(FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x == val; }); }
+	FastVector<T> operator==(const FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x == val; }); }
 	template<typename T>
-	FastVector<T> operator!=(FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x != val; }); }
+	FastVector<T> operator!=(const FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x != val; }); }
 	template<typename T>
-	FastVector<T> operator>(FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x > val; }); }
+	FastVector<T> operator>(const FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x > val; }); }
 	template<typename T>
-	FastVector<T> operator<(FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x < val; }); }
+	FastVector<T> operator<(const FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x < val; }); }
 	template<typename T>
-	FastVector<T> operator>=(FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x >= val; }); }
+	FastVector<T> operator>=(const FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x >= val; }); }
 	template<typename T>
-	FastVector<T> operator<=(FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x <= val; }); }
+	FastVector<T> operator<=(const FastVector<T>& vec, T val) { return vec.apply_amp_func([=](T x) restrict(amp) {return x <= val; }); }
 
 #elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_PPL_MODE
 
 	template<typename T>
-	FastVector<T> operator+(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_ppl_combo_func([](T x1, T x2) {return x1 + x2; }, vec2); }
+	FastVector<T> operator+(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_ppl_combo_func(SIMD_ADD, [](T x1, T x2) {return x1 + x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator-(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_ppl_combo_func(SIMD_SUB, [](T x1, T x2) {return x1 - x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator*(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_ppl_combo_func(SIMD_MUL, [](T x1, T x2) {return x1 * x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator/(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_ppl_combo_func(SIMD_DIV, [](T x1, T x2) {return x1 / x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator==(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_ppl_combo_func(SIMD_EQ, [](T x1, T x2) {return x1 == x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator!=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_ppl_combo_func(SIMD_NE, [](T x1, T x2) {return x1 != x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator>(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_ppl_combo_func(SIMD_GT, [](T x1, T x2) {return x1 > x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator<(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_ppl_combo_func(SIMD_LT, [](T x1, T x2) {return x1 < x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator>=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_ppl_combo_func(SIMD_GE, [](T x1, T x2) {return x1 >= x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator<=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_ppl_combo_func(SIMD_LE, [](T x1, T x2) {return x1 <= x2; }, vec2); }
+
+	template<typename T>
+	FastVector<T> operator+(T val, const FastVector<T>& vec) { return vec.apply_ppl_func(SIMD_ADD, val, [=](T x) {return val + x; }); }
+	template<typename T>
+	FastVector<T> operator-(T val, const FastVector<T>& vec) { return vec.apply_ppl_func(SIMD_RSUB, val, [=](T x) {return val - x; }); }
+	template<typename T>
+	FastVector<T> operator*(T val, const FastVector<T>& vec) { return vec.apply_ppl_func(SIMD_MUL, val, [=](T x) {return val * x; }); }
+	template<typename T>
+	FastVector<T> operator/(T val, const FastVector<T>& vec) { return vec.apply_ppl_func(SIMD_RDIV, val, [=](T x) {return val / x; }); }
+	template<typename T>
+	FastVector<T> operator==(T val, const FastVector<T>& vec) { return vec.apply_ppl_func(SIMD_EQ, val, [=](T x) {return val == x; }); }
+	template<typename T>
+	FastVector<T> operator!=(T val, const FastVector<T>& vec) { return vec.apply_ppl_func(SIMD_NE, val, [=](T x) {return val != x; }); }
+	template<typename T>
+	FastVector<T> operator>(T val, const FastVector<T>& vec) { return vec.apply_ppl_func(SIMD_LT, val, [=](T x) {return val > x; }); }
+	template<typename T>
+	FastVector<T> operator<(T val, const FastVector<T>& vec) { return vec.apply_ppl_func(SIMD_GT, val, [=](T x) {return val < x; }); }
+	template<typename T>
+	FastVector<T> operator>=(T val, const FastVector<T>& vec) { return vec.apply_ppl_func(SIMD_LE, val, [=](T x) {return val >= x; }); }
+	template<typename T>
+	FastVector<T> operator<=(T val, const FastVector<T>& vec) { return vec.apply_ppl_func(SIMD_GE, val, [=](T x) {return val <= x; }); }
+
+	template<typename T>
+	FastVector<T> operator+(const FastVector<T>& vec, T val) { return vec.apply_ppl_func(SIMD_ADD, val, [=](T x) {return x + val; }); }
+	template<typename T>
+	FastVector<T> operator-(const FastVector<T>& vec, T val) { return vec.apply_ppl_func(SIMD_SUB, val, [=](T x) {return x - val; }); }
+	template<typename T>
+	FastVector<T> operator*(const FastVector<T>& vec, T val) { return vec.apply_ppl_func(SIMD_MUL, val, [=](T x) {return x * val; }); }
+	template<typename T>
+	FastVector<T> operator/(const FastVector<T>& vec, T val) { return vec.apply_ppl_func(SIMD_DIV, val, [=](T x) {return x / val; }); }
+	template<typename T>
+	FastVector<T> operator==(const FastVector<T>& vec, T val) { return vec.apply_ppl_func(SIMD_EQ, val, [=](T x) {return x == val; }); }
+	template<typename T>
+	FastVector<T> operator!=(const FastVector<T>& vec, T val) { return vec.apply_ppl_func(SIMD_NE, val, [=](T x) {return x != val; }); }
+	template<typename T>
+	FastVector<T> operator>(const FastVector<T>& vec, T val) { return vec.apply_ppl_func(SIMD_GT, val, [=](T x) {return x > val; }); }
+	template<typename T>
+	FastVector<T> operator<(const FastVector<T>& vec, T val) { return vec.apply_ppl_func(SIMD_LT, val, [=](T x) {return x < val; }); }
+	template<typename T>
+	FastVector<T> operator>=(const FastVector<T>& vec, T val) { return vec.apply_ppl_func(SIMD_GE, val, [=](T x) {return x >= val; }); }
+	template<typename T>
+	FastVector<T> operator<=(const FastVector<T>& vec, T val) { return vec.apply_ppl_func(SIMD_LE, val, [=](T x) {return x <= val; }); }
+
+#elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_STD_MODE
+
+	template<typename T>
+	FastVector<T> operator+(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_std_combo_func(SIMD_ADD, [](T x1, T x2) {return x1 + x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator-(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_std_combo_func(SIMD_SUB, [](T x1, T x2) {return x1 - x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator*(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_std_combo_func(SIMD_MUL, [](T x1, T x2) {return x1 * x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator/(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_std_combo_func(SIMD_DIV, [](T x1, T x2) {return x1 / x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator==(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_std_combo_func(SIMD_EQ, [](T x1, T x2) {return x1 == x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator!=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_std_combo_func(SIMD_NE, [](T x1, T x2) {return x1 != x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator>(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_std_combo_func(SIMD_GT, [](T x1, T x2) {return x1 > x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator<(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_std_combo_func(SIMD_LT, [](T x1, T x2) {return x1 < x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator>=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_std_combo_func(SIMD_GE, [](T x1, T x2) {return x1 >= x2; }, vec2); }
+	template<typename T>
+	FastVector<T> operator<=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_std_combo_func(SIMD_LE, [](T x1, T x2) {return x1 <= x2; }, vec2); }
+
+	template<typename T>
+	FastVector<T> operator+(T val, const FastVector<T>& vec) { return vec.apply_std_func(SIMD_ADD, val, [=](T x) {return val + x; }); }
+	template<typename T>
+	FastVector<T> operator-(T val, const FastVector<T>& vec) { return vec.apply_std_func(SIMD_RSUB, val, [=](T x) {return val - x; }); }
+	template<typename T>
+	FastVector<T> operator*(T val, const FastVector<T>& vec) { return vec.apply_std_func(SIMD_MUL, val, [=](T x) {return val * x; }); }
+	template<typename T>
+	FastVector<T> operator/(T val, const FastVector<T>& vec) { return vec.apply_std_func(SIMD_RDIV, val, [=](T x) {return val / x; }); }
+	template<typename T>
+	FastVector<T> operator==(T val, const FastVector<T>& vec) { return vec.apply_std_func(SIMD_EQ, val, [=](T x) {return val == x; }); }
+	template<typename T>
+	FastVector<T> operator!=(T val, const FastVector<T>& vec) { return vec.apply_std_func(SIMD_NE, val, [=](T x) {return val != x; }); }
+	template<typename T>
+	FastVector<T> operator>(T val, const FastVector<T>& vec) { return vec.apply_std_func(SIMD_LT, val, [=](T x) {return val > x; }); }
+	template<typename T>
+	FastVector<T> operator<(T val, const FastVector<T>& vec) { return vec.apply_std_func(SIMD_GT, val, [=](T x) {return val < x; }); }
+	template<typename T>
+	FastVector<T> operator>=(T val, const FastVector<T>& vec) { return vec.apply_std_func(SIMD_LE, val, [=](T x) {return val >= x; }); }
+	template<typename T>
+	FastVector<T> operator<=(T val, const FastVector<T>& vec) { return vec.apply_std_func(SIMD_GE, val, [=](T x) {return val <= x; }); }
+
+	template<typename T>
+	FastVector<T> operator+(const FastVector<T>& vec, T val) { return vec.apply_std_func(SIMD_ADD, val, [=](T x) {return x + val; }); }
+	template<typename T>
+	FastVector<T> operator-(const FastVector<T>& vec, T val) { return vec.apply_std_func(SIMD_SUB, val, [=](T x) {return x - val; }); }
+	template<typename T>
+	FastVector<T> operator*(const FastVector<T>& vec, T val) { return vec.apply_std_func(SIMD_MUL, val, [=](T x) {return x * val; }); }
+	template<typename T>
+	FastVector<T> operator/(const FastVector<T>& vec, T val) { return vec.apply_std_func(SIMD_DIV, val, [=](T x) {return x / val; }); }
+	template<typename T>
+	FastVector<T> operator==(const FastVector<T>& vec, T val) { return vec.apply_std_func(SIMD_EQ, val, [=](T x) {return x == val; }); }
+	template<typename T>
+	FastVector<T> operator!=(const FastVector<T>& vec, T val) { return vec.apply_std_func(SIMD_NE, val, [=](T x) {return x != val; }); }
+	template<typename T>
+	FastVector<T> operator>(const FastVector<T>& vec, T val) { return vec.apply_std_func(SIMD_GT, val, [=](T x) {return x > val; }); }
+	template<typename T>
+	FastVector<T> operator<(const FastVector<T>& vec, T val) { return vec.apply_std_func(SIMD_LT, val, [=](T x) {return x < val; }); }
+	template<typename T>
+	FastVector<T> operator>=(const FastVector<T>& vec, T val) { return vec.apply_std_func(SIMD_GE, val, [=](T x) {return x >= val; }); }
+	template<typename T>
+	FastVector<T> operator<=(const FastVector<T>& vec, T val) { return vec.apply_std_func(SIMD_LE, val, [=](T x) {return x <= val; }); }
+
+#elif defined FAST_CONTAONER_OPERATOR_OVERLOAD_AUTO_MODE
+
+	template<typename T>
+	FastVector<T> operator+(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_auto_combo_func(SIMD_ADD, [](T x1, T x2) {return x1 + x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator-(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_ppl_combo_func([](T x1, T x2) {return x1 - x2; }, vec2); }
+	FastVector<T> operator-(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_auto_combo_func(SIMD_SUB, [](T x1, T x2) {return x1 - x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator*(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_ppl_combo_func([](T x1, T x2) {return x1 * x2; }, vec2); }
+	FastVector<T> operator*(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_auto_combo_func(SIMD_MUL, [](T x1, T x2) {return x1 * x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator/(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_ppl_combo_func([](T x1, T x2) {return x1 / x2; }, vec2); }
+	FastVector<T> operator/(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_auto_combo_func(SIMD_DIV, [](T x1, T x2) {return x1 / x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator==(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_ppl_combo_func([](T x1, T x2) {return x1 == x2; }, vec2); }
+	FastVector<T> operator==(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_auto_combo_func(SIMD_EQ, [](T x1, T x2) {return x1 == x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator!=(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_ppl_combo_func([](T x1, T x2) {return x1 != x2; }, vec2); }
+	FastVector<T> operator!=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_auto_combo_func(SIMD_NE, [](T x1, T x2) {return x1 != x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator>(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_ppl_combo_func([](T x1, T x2) {return x1 > x2; }, vec2); }
+	FastVector<T> operator>(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_auto_combo_func(SIMD_GT, [](T x1, T x2) {return x1 > x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator<(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_ppl_combo_func([](T x1, T x2) {return x1 < x2; }, vec2); }
+	FastVector<T> operator<(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_auto_combo_func(SIMD_LT, [](T x1, T x2) {return x1 < x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator>=(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_ppl_combo_func([](T x1, T x2) {return x1 >= x2; }, vec2); }
+	FastVector<T> operator>=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_auto_combo_func(SIMD_GE, [](T x1, T x2) {return x1 >= x2; }, vec2); }
 	template<typename T>
-	FastVector<T> operator<=(FastVector<T>& vec1, FastVector<T>& vec2) { return vec1.apply_ppl_combo_func([](T x1, T x2) {return x1 <= x2; }, vec2); }
+	FastVector<T> operator<=(const FastVector<T>& vec1, const FastVector<T>& vec2) { return vec1.apply_auto_combo_func(SIMD_LE, [](T x1, T x2) {return x1 <= x2; }, vec2); }
 
 	template<typename T>
-	FastVector<T> operator+(T val, FastVector<T>& vec) { return vec.apply_ppl_func([=](T x) {return val + x; }); }
+	FastVector<T> operator+(T val, const FastVector<T>& vec) { return vec.apply_auto_func(SIMD_ADD, val, [=](T x) {return val + x; }); }
 	template<typename T>
-	FastVector<T> operator-(T val, FastVector<T>& vec) { return vec.apply_ppl_func([=](T x) {return val - x; }); }
+	FastVector<T> operator-(T val, const FastVector<T>& vec) { return vec.apply_auto_func(SIMD_RSUB, val, [=](T x) {return val - x; }); }
 	template<typename T>
-	FastVector<T> operator*(T val, FastVector<T>& vec) { return vec.apply_ppl_func([=](T x) {return val * x; }); }
+	FastVector<T> operator*(T val, const FastVector<T>& vec) { return vec.apply_auto_func(SIMD_MUL, val, [=](T x) {return val * x; }); }
 	template<typename T>
-	FastVector<T> operator/(T val, FastVector<T>& vec) { return vec.apply_ppl_func([=](T x) {return val / x; }); }
+	FastVector<T> operator/(T val, const FastVector<T>& vec) { return vec.apply_auto_func(SIMD_RDIV, val, [=](T x) {return val / x; }); }
 	template<typename T>
-	FastVector<T> operator==(T val, FastVector<T>& vec) { return vec.apply_ppl_func([=](T x) {return val == x; }); }
+	FastVector<T> operator==(T val, const FastVector<T>& vec) { return vec.apply_auto_func(SIMD_EQ, val, [=](T x) {return val == x; }); }
 	template<typename T>
-	FastVector<T> operator!=(T val, FastVector<T>& vec) { return vec.apply_ppl_func([=](T x) {return val != x; }); }
+	FastVector<T> operator!=(T val, const FastVector<T>& vec) { return vec.apply_auto_func(SIMD_NE, val, [=](T x) {return val != x; }); }
 	template<typename T>
-	FastVector<T> operator>(T val, FastVector<T>& vec) { return vec.apply_ppl_func([=](T x) {return val > x; }); }
+	FastVector<T> operator>(T val, const FastVector<T>& vec) { return vec.apply_auto_func(SIMD_LT, val, [=](T x) {return val > x; }); }
 	template<typename T>
-	FastVector<T> operator<(T val, FastVector<T>& vec) { return vec.apply_ppl_func([=](T x) {return val < x; }); }
+	FastVector<T> operator<(T val, const FastVector<T>& vec) { return vec.apply_auto_func(SIMD_GT, val, [=](T x) {return val < x; }); }
 	template<typename T>
-	FastVector<T> operator>=(T val, FastVector<T>& vec) { return vec.apply_ppl_func([=](T x) {return val >= x; }); }
+	FastVector<T> operator>=(T val, const FastVector<T>& vec) { return vec.apply_auto_func(SIMD_LE, val, [=](T x) {return val >= x; }); }
 	template<typename T>
-	FastVector<T> operator<=(T val, FastVector<T>& vec) { return vec.apply_ppl_func([=](T x) {return val <= x; }); }
+	FastVector<T> operator<=(T val, const FastVector<T>& vec) { return vec.apply_auto_func(SIMD_GE, val, [=](T x) {return val <= x; }); }
 
 	template<typename T>
-	FastVector<T> operator+(FastVector<T>& vec, T val) { return vec.apply_ppl_func([=](T x) {return x + val; }); }
+	FastVector<T> operator+(const FastVector<T>& vec, T val) { return vec.apply_auto_func(SIMD_ADD, val, [=](T x) {return x + val; }); }
 	template<typename T>
-	FastVector<T> operator-(FastVector<T>& vec, T val) { return vec.apply_ppl_func([=](T x) {return x - val; }); }
+	FastVector<T> operator-(const FastVector<T>& vec, T val) { return vec.apply_auto_func(SIMD_SUB, val, [=](T x) {return x - val; }); }
 	template<typename T>
-	FastVector<T> operator*(FastVector<T>& vec, T val) { return vec.apply_ppl_func([=](T x) {return x * val; }); }
+	FastVector<T> operator*(const FastVector<T>& vec, T val) { return vec.apply_auto_func(SIMD_MUL, val, [=](T x) {return x * val; }); }
 	template<typename T>
-	FastVector<T> operator/(FastVector<T>& vec, T val) { return vec.apply_ppl_func([=](T x) {return x / val; }); }
+	FastVector<T> operator/(const FastVector<T>& vec, T val) { return vec.apply_auto_func(SIMD_DIV, val, [=](T x) {return x / val; }); }
 	template<typename T>
-	FastVector<T> operator==(FastVector<T>& vec, T val) { return vec.apply_ppl_func([=](T x) {return x == val; }); }
+	FastVector<T> operator==(const FastVector<T>& vec, T val) { return vec.apply_auto_func(SIMD_EQ, val, [=](T x) {return x == val; }); }
 	template<typename T>
-	FastVector<T> operator!=(FastVector<T>& vec, T val) { return vec.apply_ppl_func([=](T x) {return x != val; }); }
+	FastVector<T> operator!=(const FastVector<T>& vec, T val) { return vec.apply_auto_func(SIMD_NE, val, [=](T x) {return x != val; }); }
 	template<typename T>
-	FastVector<T> operator>(FastVector<T>& vec, T val) { return vec.apply_ppl_func([=](T x) {return x > val; }); }
+	FastVector<T> operator>(const FastVector<T>& vec, T val) { return vec.apply_auto_func(SIMD_GT, val, [=](T x) {return x > val; }); }
 	template<typename T>
-	FastVector<T> operator<(FastVector<T>& vec, T val) { return vec.apply_ppl_func([=](T x) {return x < val; }); }
+	FastVector<T> operator<(const FastVector<T>& vec, T val) { return vec.apply_auto_func(SIMD_LT, val, [=](T x) {return x < val; }); }
 	template<typename T>
-	FastVector<T> operator>=(FastVector<T>& vec, T val) { return vec.apply_ppl_func([=](T x) {return x >= val; }); }
+	FastVector<T> operator>=(const FastVector<T>& vec, T val) { return vec.apply_auto_func(SIMD_GE, val, [=](T x) {return x >= val; }); }
 	template<typename T>
-	FastVector<T> operator<=(FastVector<T>& vec, T val) { return vec.apply_ppl_func([=](T x) {return x <= val; }); }
+	FastVector<T> operator<=(const FastVector<T>& vec, T val) { return vec.apply_auto_func(SIMD_LE, val, [=](T x) {return x <= val; }); }
 
 #endif
 
@@ -0,0 +1,927 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	xNgQƂr[ (̈LȂ)
+	stride: ̗vf܂ł̋
+	QƐ̃Rei蒷gȂ
+	*/
+	template<typename T>
+	class FastVectorView :public Expression<FastVectorView<T>> {
+	public:
+		using value_type = T;
+		using container_type = FastVector<T>;
+		static const bool is_scalar = false;
+
+		FastVectorView() { }
+		FastVectorView(T *data, int size, int stride = 1) : data(data), size(size), stride(stride) { }
+		FastVectorView(FastVector<T>& vec) : data(vec.get_data()), size(vec.get_size()) { }
+		/*const̃xNgQ (ǂݎɂgAassignŏ܂Ȃ)*/
+		FastVectorView(const FastVector<T>& vec) : data(const_cast<T *>(vec.get_data())), size(vec.get_size()) { }
+
+		T *get_data() const { return data; }
+		int get_size() const { return size; }
+		int get_row_size() const { return 1; }
+		int get_column_size() const { return size; }
+		int get_stride() const { return stride; }
+		bool is_contiguous() const { return stride == 1; }
+
+		T& operator[](int idx) const { return data[idx * stride]; }
+
+		/*FastVector֕ϊ (Rs[)*/
+		FastVector<T> to_FastVector() const { return FastVector<T>(*this); }
+
+		/*[begin][count]Q*/
+		FastVectorView<T> slice(int begin, int count) const {
+			if (begin < 0 || count < 0 || begin + count > size) throw fast_container_exception();
+			return FastVectorView<T>(data + begin * stride, count, stride);
+		}
+		/*[row]s̍sƂĎQ (AĂꍇ̂)*/
+		FastMatrixView<T> reshape(int row) const {
+			if (!is_contiguous() || row <= 0 || size % row != 0) throw fast_container_exception();
+			return FastMatrixView<T>(data, row, size / row);
+		}
+
+		/*]ĎQƐ֏*/
+		template<class E>
+		FastVectorView<T>& assign(const Expression<E>& expr) {
+			const E& e = expr.self();
+			if (size != e.get_size()) throw fast_container_exception();
+			T *ptr = data;
+			int st = stride;
+			parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) ptr[i * st] = (T)e[i];
+			}, EXPRESSION_GRAIN);
+			return *this;
+		}
+
+		/*v [hؑ*/
+		T sum() const { return as_row().sum(); }
+		/**/
+		T mean() const { return sum() / size; }
+		/*ŏl [hؑ*/
+		T get_min() const { return as_row().get_min(); }
+		/*ől [hؑ*/
+		T get_max() const { return as_row().get_max(); }
+		/*ől̃CfbNX (ől΍ŏ̂) [hؑ*/
+		int get_argmax() const { return as_row().get_argmax(); }
+
+		/*֐Kp [hؑ
+		func: T(*func)(T x) (AMP[hł restrict(amp) Kv)*/
+		template<class F>
+		FastVector<T> apply(F func) const { return SWITCH_FAST_CONTAONER_FUNCTION(apply)(func); }
+		/*֐Kp
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_com(F func) const {
+			SerialExecutor exec;
+			return apply(func, exec);
+		}
+		/*֐Kp AMP
+		func: T(*func)(T x) restrict(amp)*/
+		template<class F>
+		FastVector<T> apply_amp(F func) const {
+			FastVector<T> result(size);
+			if (size == 0) return result;
+			int st = stride;
+			concurrency::array_view<const T, 1> av_entity((size - 1) * stride + 1, data);
+			concurrency::array_view<T, 1> av_result(size, &result[0]);
+			av_result.discard_data();
+			concurrency::parallel_for_each(av_result.extent, [=](concurrency::index<1> idx) restrict(amp) {
+				av_result[idx] = func(av_entity[idx[0] * st]);
+			});
+			av_result.synchronize();
+			return result;
+		}
+		/*֐Kp PPL
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_ppl(F func) const {
+			PplExecutor exec;
+			return apply(func, exec);
+		}
+		/*֐Kp STD
+		func: T(*func)(T x)*/
+		template<class F>
+		FastVector<T> apply_std(F func) const { return apply(func, ThreadPool::get_instance()); }
+		/*֐Kp
+		func: T(*func)(T x), exec: s*/
+		template<class F, class E>
+		FastVector<T> apply(F func, E& exec) const {
+			FastVector<T> result(size);
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) result[i] = func(data[i * stride]);
+			}, EXPRESSION_GRAIN);
+			return result;
+		}
+
+		/*֐KpĎQƐ֏㏑ [hؑ
+		func: T(*func)(T x) (AMP[hł restrict(amp) Kv)*/
+		template<class F>
+		const FastVectorView<T>& apply_inplace(F func) const { return SWITCH_FAST_CONTAONER_FUNCTION(apply_inplace)(func); }
+		/*֐KpĎQƐ֏㏑
+		func: T(*func)(T x)*/
+		template<class F>
+		const FastVectorView<T>& apply_inplace_com(F func) const {
+			SerialExecutor exec;
+			return apply_inplace(func, exec);
+		}
+		/*֐KpĎQƐ֏㏑ AMP
+		func: T(*func)(T x) restrict(amp)*/
+		template<class F>
+		const FastVectorView<T>& apply_inplace_amp(F func) const {
+			if (size == 0) return *this;
+			int st = stride;
+			concurrency::array_view<T, 1> av_entity((size - 1) * stride + 1, data);
+			concurrency::parallel_for_each(concurrency::extent<1>(size), [=](concurrency::index<1> idx) restrict(amp) {
+				av_entity[idx[0] * st] = func(av_entity[idx[0] * st]);
+			});
+			av_entity.synchronize();
+			return *this;
+		}
+		/*֐KpĎQƐ֏㏑ PPL
+		func: T(*func)(T x)*/
+		template<class F>
+		const FastVectorView<T>& apply_inplace_ppl(F func) const {
+			PplExecutor exec;
+			return apply_inplace(func, exec);
+		}
+		/*֐KpĎQƐ֏㏑ STD
+		func: T(*func)(T x)*/
+		template<class F>
+		const FastVectorView<T>& apply_inplace_std(F func) const { return apply_inplace(func, ThreadPool::get_instance()); }
+		/*֐KpĎQƐ֏㏑
+		func: T(*func)(T x), exec: s*/
+		template<class F, class E>
+		const FastVectorView<T>& apply_inplace(F func, E& exec) const {
+			exec.parallel_for_range(0, size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) data[i * stride] = func(data[i * stride]);
+			}, EXPRESSION_GRAIN);
+			return *this;
+		}
+
+	private:
+		/*1s̍sƂĎQ*/
+		FastMatrixView<T> as_row() const { return FastMatrixView<T>(data, 1, size, size * stride, stride); }
+
+		T *data = nullptr;
+		int size = 0;
+		int stride = 1;
+	};
+
+	/*
+	sQƂr[ (̈LȂ)
+	row_stride: ̍s܂ł̋, column_stride: ̗܂ł̋
+	s͈̔́A͈̔́A]u̓Rs[ɎQƂł
+	QƐ̃Rei蒷gȂ
+	*/
+	template<typename T>
+	class FastMatrixView :public Expression<FastMatrixView<T>> {
+	public:
+		using value_type = T;
+		using container_type = FastMatrix<T>;
+		static const bool is_scalar = false;
+
+		FastMatrixView() { }
+		FastMatrixView(T *data, int row, int col) : FastMatrixView(data, row, col, col, 1) { }
+		FastMatrixView(T *data, int row, int col, int row_stride, int column_stride)
+			: data(data), row_size(row), column_size(col), row_stride(row_stride), column_stride(column_stride) {
+			contiguous = column_stride == 1 && (row_stride == col || row <= 1);
+		}
+		FastMatrixView(FastMatrix<T>& mat) : FastMatrixView(mat.get_data(), mat.get_row_size(), mat.get_column_size()) { }
+		/*const̍sQ (ǂݎɂgAassignŏ܂Ȃ)*/
+		FastMatrixView(const FastMatrix<T>& mat) : FastMatrixView(const_cast<T *>(mat.get_data()), mat.get_row_size(), mat.get_column_size()) { }
+
+		T *get_data() const { return data; }
+		int get_size() const { return row_size * column_size; }
+		int get_row_size() const { return row_size; }
+		int get_column_size() const { return column_size; }
+		int get_row_stride() const { return row_stride; }
+		int get_column_stride() const { return column_stride; }
+		bool is_contiguous() const { return contiguous; }
+
+		/*sD̒ʂԍŎQ*/
+		T& operator[](int idx) const {
+			if (contiguous) return data[idx];
+			return data[(idx / column_size) * row_stride + (idx % column_size) * column_stride];
+		}
+		T& operator()(int row, int col) const { return data[row * row_stride + col * column_stride]; }
+
+		/*FastMatrix֕ϊ (Rs[)*/
+		FastMatrix<T> to_FastMatrix() const { return FastMatrix<T>(*this); }
+
+		/*s[row]Q*/
+		FastVectorView<T> row(int row) const {
+			if (row < 0 || row >= row_size) throw fast_container_exception();
+			return FastVectorView<T>(data + row * row_stride, column_size, column_stride);
+		}
+		/*[col]Q*/
+		FastVectorView<T> column(int col) const {
+			if (col < 0 || col >= column_size) throw fast_container_exception();
+			return FastVectorView<T>(data + col * column_stride, row_size, row_stride);
+		}
+		/*s[begin][count]sQ*/
+		FastMatrixView<T> rows(int begin, int count) const {
+			if (begin < 0 || count < 0 || begin + count > row_size) throw fast_container_exception();
+			return FastMatrixView<T>(data + begin * row_stride, count, column_size, row_stride, column_stride);
+		}
+		/*[begin][count]Q*/
+		FastMatrixView<T> columns(int begin, int count) const {
+			if (begin < 0 || count < 0 || begin + count > column_size) throw fast_container_exception();
+			return FastMatrixView<T>(data + begin * column_stride, row_size, count, row_stride, column_stride);
+		}
+		/*s[0]`[row]܂łQ*/
+		FastMatrixView<T> take_rows(int row) const { return rows(0, row); }
+		/*s[row]`[end]܂łQ*/
+		FastMatrixView<T> skip_rows(int row) const { return rows(row, row_size - row); }
+		/*[0]`[col]܂łQ*/
+		FastMatrixView<T> take_columns(int col) const { return columns(0, col); }
+		/*[col]`[end]܂łQ*/
+		FastMatrixView<T> skip_columns(int col) const { return columns(col, column_size - col); }
+		/*]uĎQ*/
+		FastMatrixView<T> reverse() const { return FastMatrixView<T>(data, column_size, row_size, column_stride, row_stride); }
+		/*[row]s̍sƂĎQ (AĂꍇ̂)*/
+		FastMatrixView<T> reshape(int row) const {
+			int size = get_size();
+			if (!contiguous || row <= 0 || size % row != 0) throw fast_container_exception();
+			return FastMatrixView<T>(data, row, size / row);
+		}
+		/*xNgƂĎQ (AĂꍇ̂)*/
+		FastVectorView<T> flatten() const {
+			if (!contiguous) throw fast_container_exception();
+			return FastVectorView<T>(data, get_size());
+		}
+
+		/*]ĎQƐ֏*/
+		template<class E>
+		FastMatrixView<T>& assign(const Expression<E>& expr) {
+			const E& e = expr.self();
+			if (row_size != e.get_row_size() || column_size != e.get_column_size()) throw fast_container_exception();
+			const FastMatrixView<T>& dst = *this;
+			parallel_for_range(0, get_size(), [&](int begin, int end) {
+				for (int i = begin; i < end; i++) dst[i] = (T)e[i];
+			}, EXPRESSION_GRAIN);
+			return *this;
+		}
+
+		/* [hؑ*/
+		FastMatrix<T> dot(const FastMatrixView<T>& mat) const { return SWITCH_FAST_CONTAONER_FUNCTION(dot)(mat); }
+		/**/
+		FastMatrix<T> dot_com(const FastMatrixView<T>& mat) const {
+			SerialExecutor exec;
+			return dot_gemm(mat, exec);
+		}
+		/* AMP*/
+		FastMatrix<T> dot_amp(const FastMatrixView<T>& mat) const {
+			if (column_size != mat.row_size) throw fast_container_exception();
+			int row = row_size;
+			int mid = column_size;
+			int col = mat.column_size;
+			FastMatrix<T> result(row, col);
+			if (result.get_size() == 0) return result;
+			if (mid == 0) return result;
+			int rs_a = row_stride, cs_a = column_stride;
+			int rs_b = mat.row_stride, cs_b = mat.column_stride;
+			concurrency::array_view<const T, 1> av_entity(get_span(), data);
+			concurrency::array_view<const T, 1> av_mat(mat.get_span(), mat.data);
+			concurrency::array_view<T, 2> av_result(row, col, &result[0]);
+			av_result.discard_data();
+			concurrency::parallel_for_each(av_result.extent, [=](concurrency::index<2> idx) restrict(amp) {
+				T sum = 0;
+				for (int i = 0; i < mid; i++) {
+					sum += av_entity[idx[0] * rs_a + i * cs_a] * av_mat[i * rs_b + idx[1] * cs_b];
+				}
+				av_result[idx] = sum;
+			});
+			av_result.synchronize();
+			return result;
+		}
+		/* PPL*/
+		FastMatrix<T> dot_ppl(const FastMatrixView<T>& mat) const {
+			PplExecutor exec;
+			return dot_gemm(mat, exec);
+		}
+		/* STD*/
+		FastMatrix<T> dot_std(const FastMatrixView<T>& mat) const { return dot_gemm(mat, ThreadPool::get_instance()); }
+		/* ubNs
+		exec: s*/
+		template<class E>
+		FastMatrix<T> dot_gemm(const FastMatrixView<T>& mat, E& exec) const {
+			if (column_size != mat.row_size) throw fast_container_exception();
+			FastMatrix<T> result(row_size, mat.column_size);
+			if (result.get_size() == 0) return result;
+			if (column_size == 0) return result;
+			gemm(row_size, mat.column_size, column_size,
+				(const T *)data, row_stride, column_stride,
+				(const T *)mat.data, mat.row_stride, mat.column_stride,
+				&result[0], mat.column_size, exec);
+			return result;
+		}
+
+		/*s̍v [hؑ*/
+		FastVector<T> sum_by_rows() const { return SWITCH_FAST_CONTAONER_FUNCTION(sum_by_rows)(); }
+		/*s̍v*/
+		FastVector<T> sum_by_rows_com() const {
+			SerialExecutor exec;
+			return sum_by_rows(exec);
+		}
+		/*s̍v AMP*/
+		FastVector<T> sum_by_rows_amp() const {
+			FastVector<T> result(row_size);
+			if (get_size() == 0) return result;
+			int b_col = column_size;
+			int rs = row_stride, cs = column_stride;
+			concurrency::array_view<const T, 1> av_entity(get_span(), data);
+			concurrency::array_view<T, 1> av_result(row_size, &result[0]);
+			av_result.discard_data();
+			concurrency::parallel_for_each(av_result.extent, [=](concurrency::index<1> idx) restrict(amp) {
+				Accumulate<T> sum = 0;
+				for (int i = 0; i < b_col; i++) {
+					sum += (Accumulate<T>)av_entity[idx[0] * rs + i * cs];
+				}
+				av_result[idx] = (T)sum;
+			});
+			av_result.synchronize();
+			return result;
+		}
+		/*s̍v PPL*/
+		FastVector<T> sum_by_rows_ppl() const {
+			PplExecutor exec;
+			return sum_by_rows(exec);
+		}
+		/*s̍v STD*/
+		FastVector<T> sum_by_rows_std() const { return sum_by_rows(ThreadPool::get_instance()); }
+		/*s̍v
+		exec: s*/
+		template<class E>
+		FastVector<T> sum_by_rows(E& exec) const {
+			return reduce_by_rows<T>(row_sum, exec);
+		}
+
+		/*񖈂̍v [hؑ*/
+		FastVector<T> sum_by_columns() const { return reverse().sum_by_rows(); }
+		/*s̕*/
+		FastVector<T> mean_by_rows() const {
+			FastVector<T> result = sum_by_rows();
+			for (int i = 0; i < row_size; i++) result[i] /= column_size;
+			return result;
+		}
+		/*񖈂̕*/
+		FastVector<T> mean_by_columns() const { return reverse().mean_by_rows(); }
+
+		/*s̍ŏl [hؑ*/
+		FastVector<T> min_by_rows() const { return SWITCH_FAST_CONTAONER_FUNCTION(min_by_rows)(); }
+		/*s̍ŏl*/
+		FastVector<T> min_by_rows_com() const {
+			SerialExecutor exec;
+			return min_by_rows(exec);
+		}
+		/*s̍ŏl AMP (zXgŏWv)*/
+		FastVector<T> min_by_rows_amp() const {
+			PplExecutor exec;
+			return min_by_rows(exec);
+		}
+		/*s̍ŏl PPL*/
+		FastVector<T> min_by_rows_ppl() const {
+			PplExecutor exec;
+			return min_by_rows(exec);
+		}
+		/*s̍ŏl STD*/
+		FastVector<T> min_by_rows_std() const { return min_by_rows(ThreadPool::get_instance()); }
+		/*s̍ŏl
+		exec: s*/
+		template<class E>
+		FastVector<T> min_by_rows(E& exec) const {
+			if (row_size > 0 && column_size == 0) throw fast_container_exception();
+			return reduce_by_rows<T>(row_min, exec);
+		}
+		/*񖈂̍ŏl*/
+		FastVector<T> min_by_columns() const { return reverse().min_by_rows(); }
+
+		/*s̍ől [hؑ*/
+		FastVector<T> max_by_rows() const { return SWITCH_FAST_CONTAONER_FUNCTION(max_by_rows)(); }
+		/*s̍ől*/
+		FastVector<T> max_by_rows_com() const {
+			SerialExecutor exec;
+			return max_by_rows(exec);
+		}
+		/*s̍ől AMP (zXgŏWv)*/
+		FastVector<T> max_by_rows_amp() const {
+			PplExecutor exec;
+			return max_by_rows(exec);
+		}
+		/*s̍ől PPL*/
+		FastVector<T> max_by_rows_ppl() const {
+			PplExecutor exec;
+			return max_by_rows(exec);
+		}
+		/*s̍ől STD*/
+		FastVector<T> max_by_rows_std() const { return max_by_rows(ThreadPool::get_instance()); }
+		/*s̍ől
+		exec: s*/
+		template<class E>
+		FastVector<T> max_by_rows(E& exec) const {
+			if (row_size > 0 && column_size == 0) throw fast_container_exception();
+			return reduce_by_rows<T>(row_max, exec);
+		}
+		/*񖈂̍ől*/
+		FastVector<T> max_by_columns() const { return reverse().max_by_rows(); }
+
+		/*s̍ől̃CfbNX [hؑ*/
+		FastVector<int> argmax_by_rows() const { return SWITCH_FAST_CONTAONER_FUNCTION(argmax_by_rows)(); }
+		/*s̍ől̃CfbNX*/
+		FastVector<int> argmax_by_rows_com() const {
+			SerialExecutor exec;
+			return argmax_by_rows(exec);
+		}
+		/*s̍ől̃CfbNX AMP (zXgŏWv)*/
+		FastVector<int> argmax_by_rows_amp() const {
+			PplExecutor exec;
+			return argmax_by_rows(exec);
+		}
+		/*s̍ől̃CfbNX PPL*/
+		FastVector<int> argmax_by_rows_ppl() const {
+			PplExecutor exec;
+			return argmax_by_rows(exec);
+		}
+		/*s̍ől̃CfbNX STD*/
+		FastVector<int> argmax_by_rows_std() const { return argmax_by_rows(ThreadPool::get_instance()); }
+		/*s̍ől̃CfbNX
+		exec: s*/
+		template<class E>
+		FastVector<int> argmax_by_rows(E& exec) const {
+			if (row_size > 0 && column_size == 0) throw fast_container_exception();
+			return reduce_by_rows<int>(row_argmax, exec);
+		}
+		/*񖈂̍ől̃CfbNX*/
+		FastVector<int> argmax_by_columns() const { return reverse().argmax_by_rows(); }
+
+		/*v [hؑ*/
+		T sum() const { return SWITCH_FAST_CONTAONER_FUNCTION(sum)(); }
+		/*v*/
+		T sum_com() const {
+			SerialExecutor exec;
+			return sum(exec);
+		}
+		/*v AMP (zXgŏWv)*/
+		T sum_amp() const {
+			PplExecutor exec;
+			return sum(exec);
+		}
+		/*v PPL*/
+		T sum_ppl() const {
+			PplExecutor exec;
+			return sum(exec);
+		}
+		/*v STD*/
+		T sum_std() const { return sum(ThreadPool::get_instance()); }
+		/*v (AĂȂꍇ͍sfloatŗݐ)
+		exec: s*/
+		template<class E>
+		T sum(E& exec) const {
+			if (contiguous) return reduce_sum(data, get_size(), exec);
+			std::vector<Accumulate<T>> partial(row_size);
+			exec.parallel_for_range(0, row_size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					const T *ptr = data + i * row_stride;
+					Accumulate<T> buf = 0;
+					for (int j = 0; j < column_size; j++) buf += (Accumulate<T>)ptr[j * column_stride];
+					partial[i] = buf;
+				}
+			});
+			Accumulate<T> result = 0;
+			for (auto x : partial) result += x;
+			return (T)result;
+		}
+		/**/
+		T mean() const { return sum() / get_size(); }
+
+		/*ŏl [hؑ*/
+		T get_min() const { return SWITCH_FAST_CONTAONER_FUNCTION(get_min)(); }
+		/*ŏl*/
+		T get_min_com() const {
+			SerialExecutor exec;
+			return get_min(exec);
+		}
+		/*ŏl AMP (zXgŏWv)*/
+		T get_min_amp() const {
+			PplExecutor exec;
+			return get_min(exec);
+		}
+		/*ŏl PPL*/
+		T get_min_ppl() const {
+			PplExecutor exec;
+			return get_min(exec);
+		}
+		/*ŏl STD*/
+		T get_min_std() const { return get_min(ThreadPool::get_instance()); }
+		/*ŏl
+		exec: s*/
+		template<class E>
+		T get_min(E& exec) const {
+			if (contiguous) return reduce_min(data, get_size(), exec);
+			FastVector<T> partial = min_by_rows(exec);
+			SerialExecutor serial;
+			return reduce_min(partial.get_data(), row_size, serial);
+		}
+
+		/*ől [hؑ*/
+		T get_max() const { return SWITCH_FAST_CONTAONER_FUNCTION(get_max)(); }
+		/*ől*/
+		T get_max_com() const {
+			SerialExecutor exec;
+			return get_max(exec);
+		}
+		/*ől AMP (zXgŏWv)*/
+		T get_max_amp() const {
+			PplExecutor exec;
+			return get_max(exec);
+		}
+		/*ől PPL*/
+		T get_max_ppl() const {
+			PplExecutor exec;
+			return get_max(exec);
+		}
+		/*ől STD*/
+		T get_max_std() const { return get_max(ThreadPool::get_instance()); }
+		/*ől
+		exec: s*/
+		template<class E>
+		T get_max(E& exec) const {
+			if (contiguous) return reduce_max(data, get_size(), exec);
+			FastVector<T> partial = max_by_rows(exec);
+			SerialExecutor serial;
+			return reduce_max(partial.get_data(), row_size, serial);
+		}
+
+		/*ől̃CfbNX (sD̒ʂԍAől΍ŏ̂) [hؑ*/
+		int get_argmax() const { return SWITCH_FAST_CONTAONER_FUNCTION(get_argmax)(); }
+		/*ől̃CfbNX (sD̒ʂԍAől΍ŏ̂)*/
+		int get_argmax_com() const {
+			SerialExecutor exec;
+			return get_argmax(exec);
+		}
+		/*ől̃CfbNX (sD̒ʂԍAől΍ŏ̂) AMP (zXgŏWv)*/
+		int get_argmax_amp() const {
+			PplExecutor exec;
+			return get_argmax(exec);
+		}
+		/*ől̃CfbNX (sD̒ʂԍAől΍ŏ̂) PPL*/
+		int get_argmax_ppl() const {
+			PplExecutor exec;
+			return get_argmax(exec);
+		}
+		/*ől̃CfbNX (sD̒ʂԍAől΍ŏ̂) STD*/
+		int get_argmax_std() const { return get_argmax(ThreadPool::get_instance()); }
+		/*ől̃CfbNX (sD̒ʂԍAől΍ŏ̂)
+		exec: s*/
+		template<class E>
+		int get_argmax(E& exec) const {
+			if (contiguous) return reduce_argmax(data, get_size(), exec);
+			FastVector<T> partial = max_by_rows(exec);
+			SerialExecutor serial;
+			int row = reduce_argmax(partial.get_data(), row_size, serial);
+			return row * column_size + row_argmax(data + row * row_stride, column_size, column_stride);
+		}
+
+		/*֐Kp [hؑ
+		func: T(*func)(T x) (AMP[hł restrict(amp) Kv)*/
+		template<class F>
+		FastMatrix<T> apply(F func) const { return SWITCH_FAST_CONTAONER_FUNCTION(apply)(func); }
+		/*֐Kp
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_com(F func) const {
+			SerialExecutor exec;
+			return apply(func, exec);
+		}
+		/*֐Kp AMP
+		func: T(*func)(T x) restrict(amp)*/
+		template<class F>
+		FastMatrix<T> apply_amp(F func) const {
+			FastMatrix<T> result(row_size, column_size);
+			if (result.get_size() == 0) return result;
+			int rs = row_stride, cs = column_stride;
+			concurrency::array_view<const T, 1> av_entity(get_span(), data);
+			concurrency::array_view<T, 2> av_result(row_size, column_size, &result[0]);
+			av_result.discard_data();
+			concurrency::parallel_for_each(av_result.extent, [=](concurrency::index<2> idx) restrict(amp) {
+				av_result[idx] = func(av_entity[idx[0] * rs + idx[1] * cs]);
+			});
+			av_result.synchronize();
+			return result;
+		}
+		/*֐Kp PPL
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_ppl(F func) const {
+			PplExecutor exec;
+			return apply(func, exec);
+		}
+		/*֐Kp STD
+		func: T(*func)(T x)*/
+		template<class F>
+		FastMatrix<T> apply_std(F func) const { return apply(func, ThreadPool::get_instance()); }
+		/*֐Kp
+		func: T(*func)(T x), exec: s*/
+		template<class F, class E>
+		FastMatrix<T> apply(F func, E& exec) const {
+			FastMatrix<T> result(row_size, column_size);
+			exec.parallel_for_range(0, row_size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					const T *ptr = data + i * row_stride;
+					T *out = &result[0] + i * column_size;
+					for (int j = 0; j < column_size; j++) out[j] = func(ptr[j * column_stride]);
+				}
+			});
+			return result;
+		}
+
+		/*֐KpĎQƐ֏㏑ [hؑ
+		func: T(*func)(T x) (AMP[hł restrict(amp) Kv)*/
+		template<class F>
+		const FastMatrixView<T>& apply_inplace(F func) const { return SWITCH_FAST_CONTAONER_FUNCTION(apply_inplace)(func); }
+		/*֐KpĎQƐ֏㏑
+		func: T(*func)(T x)*/
+		template<class F>
+		const FastMatrixView<T>& apply_inplace_com(F func) const {
+			SerialExecutor exec;
+			return apply_inplace(func, exec);
+		}
+		/*֐KpĎQƐ֏㏑ AMP
+		func: T(*func)(T x) restrict(amp)*/
+		template<class F>
+		const FastMatrixView<T>& apply_inplace_amp(F func) const {
+			if (get_size() == 0) return *this;
+			int rs = row_stride, cs = column_stride;
+			concurrency::array_view<T, 1> av_entity(get_span(), data);
+			concurrency::parallel_for_each(concurrency::extent<2>(row_size, column_size), [=](concurrency::index<2> idx) restrict(amp) {
+				int pos = idx[0] * rs + idx[1] * cs;
+				av_entity[pos] = func(av_entity[pos]);
+			});
+			av_entity.synchronize();
+			return *this;
+		}
+		/*֐KpĎQƐ֏㏑ PPL
+		func: T(*func)(T x)*/
+		template<class F>
+		const FastMatrixView<T>& apply_inplace_ppl(F func) const {
+			PplExecutor exec;
+			return apply_inplace(func, exec);
+		}
+		/*֐KpĎQƐ֏㏑ STD
+		func: T(*func)(T x)*/
+		template<class F>
+		const FastMatrixView<T>& apply_inplace_std(F func) const { return apply_inplace(func, ThreadPool::get_instance()); }
+		/*֐KpĎQƐ֏㏑
+		func: T(*func)(T x), exec: s*/
+		template<class F, class E>
+		const FastMatrixView<T>& apply_inplace(F func, E& exec) const {
+			exec.parallel_for_range(0, row_size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					T *ptr = data + i * row_stride;
+					for (int j = 0; j < column_size; j++) ptr[j * column_stride] = func(ptr[j * column_stride]);
+				}
+			});
+			return *this;
+		}
+
+		/*sɃxNgƂ̘a [hؑ*/
+		FastMatrix<T> add_by_rows(const FastVectorView<T>& vec) const { return SWITCH_FAST_CONTAONER_FUNCTION(add_by_rows)(vec); }
+		/*sɃxNgƂ̘a*/
+		FastMatrix<T> add_by_rows_com(const FastVectorView<T>& vec) const {
+			SerialExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 + x2; }, vec, 0, 1, exec);
+		}
+		/*sɃxNgƂ̘a AMP*/
+		FastMatrix<T> add_by_rows_amp(const FastVectorView<T>& vec) const { return apply_amp_combo_func_broadcast([](T x1, T x2) restrict(amp) { return x1 + x2; }, vec, 0, 1); }
+		/*sɃxNgƂ̘a PPL*/
+		FastMatrix<T> add_by_rows_ppl(const FastVectorView<T>& vec) const {
+			PplExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 + x2; }, vec, 0, 1, exec);
+		}
+		/*sɃxNgƂ̘a STD*/
+		FastMatrix<T> add_by_rows_std(const FastVectorView<T>& vec) const { return apply_combo_func_broadcast([](T x1, T x2) { return x1 + x2; }, vec, 0, 1, ThreadPool::get_instance()); }
+		/*񖈂ɃxNgƂ̘a [hؑ*/
+		FastMatrix<T> add_by_columns(const FastVectorView<T>& vec) const { return SWITCH_FAST_CONTAONER_FUNCTION(add_by_columns)(vec); }
+		/*񖈂ɃxNgƂ̘a*/
+		FastMatrix<T> add_by_columns_com(const FastVectorView<T>& vec) const {
+			SerialExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 + x2; }, vec, 1, 0, exec);
+		}
+		/*񖈂ɃxNgƂ̘a AMP*/
+		FastMatrix<T> add_by_columns_amp(const FastVectorView<T>& vec) const { return apply_amp_combo_func_broadcast([](T x1, T x2) restrict(amp) { return x1 + x2; }, vec, 1, 0); }
+		/*񖈂ɃxNgƂ̘a PPL*/
+		FastMatrix<T> add_by_columns_ppl(const FastVectorView<T>& vec) const {
+			PplExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 + x2; }, vec, 1, 0, exec);
+		}
+		/*񖈂ɃxNgƂ̘a STD*/
+		FastMatrix<T> add_by_columns_std(const FastVectorView<T>& vec) const { return apply_combo_func_broadcast([](T x1, T x2) { return x1 + x2; }, vec, 1, 0, ThreadPool::get_instance()); }
+		/*sɃxNgƂ̍ [hؑ*/
+		FastMatrix<T> sub_by_rows(const FastVectorView<T>& vec) const { return SWITCH_FAST_CONTAONER_FUNCTION(sub_by_rows)(vec); }
+		/*sɃxNgƂ̍*/
+		FastMatrix<T> sub_by_rows_com(const FastVectorView<T>& vec) const {
+			SerialExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 - x2; }, vec, 0, 1, exec);
+		}
+		/*sɃxNgƂ̍ AMP*/
+		FastMatrix<T> sub_by_rows_amp(const FastVectorView<T>& vec) const { return apply_amp_combo_func_broadcast([](T x1, T x2) restrict(amp) { return x1 - x2; }, vec, 0, 1); }
+		/*sɃxNgƂ̍ PPL*/
+		FastMatrix<T> sub_by_rows_ppl(const FastVectorView<T>& vec) const {
+			PplExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 - x2; }, vec, 0, 1, exec);
+		}
+		/*sɃxNgƂ̍ STD*/
+		FastMatrix<T> sub_by_rows_std(const FastVectorView<T>& vec) const { return apply_combo_func_broadcast([](T x1, T x2) { return x1 - x2; }, vec, 0, 1, ThreadPool::get_instance()); }
+		/*񖈂ɃxNgƂ̍ [hؑ*/
+		FastMatrix<T> sub_by_columns(const FastVectorView<T>& vec) const { return SWITCH_FAST_CONTAONER_FUNCTION(sub_by_columns)(vec); }
+		/*񖈂ɃxNgƂ̍*/
+		FastMatrix<T> sub_by_columns_com(const FastVectorView<T>& vec) const {
+			SerialExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 - x2; }, vec, 1, 0, exec);
+		}
+		/*񖈂ɃxNgƂ̍ AMP*/
+		FastMatrix<T> sub_by_columns_amp(const FastVectorView<T>& vec) const { return apply_amp_combo_func_broadcast([](T x1, T x2) restrict(amp) { return x1 - x2; }, vec, 1, 0); }
+		/*񖈂ɃxNgƂ̍ PPL*/
+		FastMatrix<T> sub_by_columns_ppl(const FastVectorView<T>& vec) const {
+			PplExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 - x2; }, vec, 1, 0, exec);
+		}
+		/*񖈂ɃxNgƂ̍ STD*/
+		FastMatrix<T> sub_by_columns_std(const FastVectorView<T>& vec) const { return apply_combo_func_broadcast([](T x1, T x2) { return x1 - x2; }, vec, 1, 0, ThreadPool::get_instance()); }
+		/*sɃxNgƂ̐ [hؑ*/
+		FastMatrix<T> mul_by_rows(const FastVectorView<T>& vec) const { return SWITCH_FAST_CONTAONER_FUNCTION(mul_by_rows)(vec); }
+		/*sɃxNgƂ̐*/
+		FastMatrix<T> mul_by_rows_com(const FastVectorView<T>& vec) const {
+			SerialExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 * x2; }, vec, 0, 1, exec);
+		}
+		/*sɃxNgƂ̐ AMP*/
+		FastMatrix<T> mul_by_rows_amp(const FastVectorView<T>& vec) const { return apply_amp_combo_func_broadcast([](T x1, T x2) restrict(amp) { return x1 * x2; }, vec, 0, 1); }
+		/*sɃxNgƂ̐ PPL*/
+		FastMatrix<T> mul_by_rows_ppl(const FastVectorView<T>& vec) const {
+			PplExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 * x2; }, vec, 0, 1, exec);
+		}
+		/*sɃxNgƂ̐ STD*/
+		FastMatrix<T> mul_by_rows_std(const FastVectorView<T>& vec) const { return apply_combo_func_broadcast([](T x1, T x2) { return x1 * x2; }, vec, 0, 1, ThreadPool::get_instance()); }
+		/*񖈂ɃxNgƂ̐ [hؑ*/
+		FastMatrix<T> mul_by_columns(const FastVectorView<T>& vec) const { return SWITCH_FAST_CONTAONER_FUNCTION(mul_by_columns)(vec); }
+		/*񖈂ɃxNgƂ̐*/
+		FastMatrix<T> mul_by_columns_com(const FastVectorView<T>& vec) const {
+			SerialExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 * x2; }, vec, 1, 0, exec);
+		}
+		/*񖈂ɃxNgƂ̐ AMP*/
+		FastMatrix<T> mul_by_columns_amp(const FastVectorView<T>& vec) const { return apply_amp_combo_func_broadcast([](T x1, T x2) restrict(amp) { return x1 * x2; }, vec, 1, 0); }
+		/*񖈂ɃxNgƂ̐ PPL*/
+		FastMatrix<T> mul_by_columns_ppl(const FastVectorView<T>& vec) const {
+			PplExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 * x2; }, vec, 1, 0, exec);
+		}
+		/*񖈂ɃxNgƂ̐ STD*/
+		FastMatrix<T> mul_by_columns_std(const FastVectorView<T>& vec) const { return apply_combo_func_broadcast([](T x1, T x2) { return x1 * x2; }, vec, 1, 0, ThreadPool::get_instance()); }
+		/*sɃxNgƂ̏ [hؑ*/
+		FastMatrix<T> div_by_rows(const FastVectorView<T>& vec) const { return SWITCH_FAST_CONTAONER_FUNCTION(div_by_rows)(vec); }
+		/*sɃxNgƂ̏*/
+		FastMatrix<T> div_by_rows_com(const FastVectorView<T>& vec) const {
+			SerialExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 / x2; }, vec, 0, 1, exec);
+		}
+		/*sɃxNgƂ̏ AMP*/
+		FastMatrix<T> div_by_rows_amp(const FastVectorView<T>& vec) const { return apply_amp_combo_func_broadcast([](T x1, T x2) restrict(amp) { return x1 / x2; }, vec, 0, 1); }
+		/*sɃxNgƂ̏ PPL*/
+		FastMatrix<T> div_by_rows_ppl(const FastVectorView<T>& vec) const {
+			PplExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 / x2; }, vec, 0, 1, exec);
+		}
+		/*sɃxNgƂ̏ STD*/
+		FastMatrix<T> div_by_rows_std(const FastVectorView<T>& vec) const { return apply_combo_func_broadcast([](T x1, T x2) { return x1 / x2; }, vec, 0, 1, ThreadPool::get_instance()); }
+		/*񖈂ɃxNgƂ̏ [hؑ*/
+		FastMatrix<T> div_by_columns(const FastVectorView<T>& vec) const { return SWITCH_FAST_CONTAONER_FUNCTION(div_by_columns)(vec); }
+		/*񖈂ɃxNgƂ̏*/
+		FastMatrix<T> div_by_columns_com(const FastVectorView<T>& vec) const {
+			SerialExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 / x2; }, vec, 1, 0, exec);
+		}
+		/*񖈂ɃxNgƂ̏ AMP*/
+		FastMatrix<T> div_by_columns_amp(const FastVectorView<T>& vec) const { return apply_amp_combo_func_broadcast([](T x1, T x2) restrict(amp) { return x1 / x2; }, vec, 1, 0); }
+		/*񖈂ɃxNgƂ̏ PPL*/
+		FastMatrix<T> div_by_columns_ppl(const FastVectorView<T>& vec) const {
+			PplExecutor exec;
+			return apply_combo_func_broadcast([](T x1, T x2) { return x1 / x2; }, vec, 1, 0, exec);
+		}
+		/*񖈂ɃxNgƂ̏ STD*/
+		FastMatrix<T> div_by_columns_std(const FastVectorView<T>& vec) const { return apply_combo_func_broadcast([](T x1, T x2) { return x1 / x2; }, vec, 1, 0, ThreadPool::get_instance()); }
+
+		/*s܂͗񖈂ɃxNgƊ֐Kp (vf[i][j]vec[i * vec_row + j * vec_column]gݍ킹)
+		func: T(*func)(T x1, T x2), exec: s*/
+		template<class F, class E>
+		FastMatrix<T> apply_combo_func_broadcast(F func, const FastVectorView<T>& vec, int vec_row, int vec_column, E& exec) const {
+			if (vec.get_size() != (vec_row == 0 ? column_size : row_size)) throw fast_container_exception();
+			FastMatrix<T> result(row_size, column_size);
+			exec.parallel_for_range(0, row_size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) {
+					const T *ptr = data + i * row_stride;
+					T *out = &result[0] + i * column_size;
+					for (int j = 0; j < column_size; j++) out[j] = func(ptr[j * column_stride], vec[i * vec_row + j * vec_column]);
+				}
+			});
+			return result;
+		}
+		/*s܂͗񖈂ɃxNgƊ֐Kp AMP
+		func: T(*func)(T x1, T x2) restrict(amp)*/
+		template<class F>
+		FastMatrix<T> apply_amp_combo_func_broadcast(F func, const FastVectorView<T>& vec, int vec_row, int vec_column) const {
+			if (vec.get_size() != (vec_row == 0 ? column_size : row_size)) throw fast_container_exception();
+			FastMatrix<T> result(row_size, column_size);
+			if (result.get_size() == 0) return result;
+			int rs = row_stride, cs = column_stride, vs = vec.get_stride();
+			int vr = vec_row * vs, vc = vec_column * vs;
+			concurrency::array_view<const T, 1> av_entity(get_span(), data);
+			concurrency::array_view<const T, 1> av_vec((vec.get_size() - 1) * vs + 1, vec.get_data());
+			concurrency::array_view<T, 2> av_result(row_size, column_size, &result[0]);
+			av_result.discard_data();
+			concurrency::parallel_for_each(av_result.extent, [=](concurrency::index<2> idx) restrict(amp) {
+				av_result[idx] = func(av_entity[idx[0] * rs + idx[1] * cs], av_vec[idx[0] * vr + idx[1] * vc]);
+			});
+			av_result.synchronize();
+			return result;
+		}
+
+	private:
+		/*sɏWv
+		R: Wvʂ̌^, func: R(*func)(const T *ptr, int count, int stride) 1s̏Wv, exec: s*/
+		template<typename R, class F, class E>
+		FastVector<R> reduce_by_rows(F func, E& exec) const {
+			FastVector<R> result(row_size);
+			exec.parallel_for_range(0, row_size, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) result[i] = func(data + i * row_stride, column_size, column_stride);
+			});
+			return result;
+		}
+		/*1s̍v (AĂSIMD߂ŌvZA16rbg_floatŗݐ)*/
+		static T row_sum(const T *ptr, int count, int stride) {
+			if (stride == 1) {
+				SerialExecutor exec;
+				return reduce_sum(ptr, count, exec);
+			}
+			Accumulate<T> result = 0;
+			for (int j = 0; j < count; j++) result += (Accumulate<T>)ptr[j * stride];
+			return (T)result;
+		}
+		/*1s̍ŏl (AĂSIMD߂ŌvZ)*/
+		static T row_min(const T *ptr, int count, int stride) {
+			if (stride == 1) {
+				SerialExecutor exec;
+				return reduce_min(ptr, count, exec);
+			}
+			T result = ptr[0];
+			for (int j = 1; j < count; j++) result = std::min(result, ptr[j * stride]);
+			return result;
+		}
+		/*1s̍ől (AĂSIMD߂ŌvZ)*/
+		static T row_max(const T *ptr, int count, int stride) {
+			if (stride == 1) {
+				SerialExecutor exec;
+				return reduce_max(ptr, count, exec);
+			}
+			T result = ptr[0];
+			for (int j = 1; j < count; j++) result = std::max(result, ptr[j * stride]);
+			return result;
+		}
+		/*1s̍ől̓Y (ől΍ŏ̂)*/
+		static int row_argmax(const T *ptr, int count, int stride) {
+			if (stride == 1) {
+				SerialExecutor exec;
+				return reduce_argmax(ptr, count, exec);
+			}
+			int result = 0;
+			T max = ptr[0];
+			for (int j = 1; j < count; j++) {
+				if (max < ptr[j * stride]) {
+					max = ptr[j * stride];
+					result = j;
+				}
+			}
+			return result;
+		}
+		/*QƂ̗̈vf*/
+		int get_span() const {
+			if (get_size() == 0) return 0;
+			return (row_size - 1) * row_stride + (column_size - 1) * column_stride + 1;
+		}
+
+		T *data = nullptr;
+		int row_size = 0;
+		int column_size = 0;
+		int row_stride = 0;
+		int column_stride = 1;
+		bool contiguous = true;
+	};
+
+}
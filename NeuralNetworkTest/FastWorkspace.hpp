@@ -0,0 +1,63 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	Ɨ̈
+	ĂяoɍƗp̍sƃxNg݂oAreset() őSĕԋpς݂ɂ
+	񓯂ɓ`؂΁A2ڈȍ~͑Ö̗̂܂܍ėp̂ŊmۂNȂ
+	݂ö̓e͕s (O̒lcĂ)
+	ԋpɎQƂgȂ (Ɏ؂肽ɏ㏑)
+	*/
+	template<typename T>
+	class Workspace {
+	public:
+		/*row x col ̍Ɨp̍s؂*/
+		FastMatrix<T>& matrix(int row, int col) {
+			if (matrix_count == matrices.size()) matrices.emplace_back();
+			auto& result = matrices[matrix_count++];
+			if (result.get_row_size() != row || result.get_column_size() != col) result.resize(row, col);
+			return result;
+		}
+		/*傫size̍Ɨp̃xNg؂*/
+		FastVector<T>& vector(int size) {
+			if (vector_count == vectors.size()) vectors.emplace_back();
+			auto& result = vectors[vector_count++];
+			if (result.get_size() != size) result.resize(size);
+			return result;
+		}
+		/*Sĕԋpς݂ɂ (͉̈Ȃ)*/
+		void reset() {
+			matrix_count = 0;
+			vector_count = 0;
+		}
+		/*̈*/
+		void clear() {
+			reset();
+			matrices.clear();
+			vectors.clear();
+		}
+
+		/*mۍς݂̍s̐*/
+		int get_matrix_count() const { return (int)matrices.size(); }
+		/*mۍς݂̃xNg̐*/
+		int get_vector_count() const { return (int)vectors.size(); }
+		/*mۍς݂̗̈̃oCg*/
+		size_t get_bytes() const {
+			size_t result = 0;
+			for (auto& mat : matrices) result += mat.get_entity().capacity() * sizeof(T);
+			for (auto& vec : vectors) result += vec.get_entity().capacity() * sizeof(T);
+			return result;
+		}
+
+	private:
+		/*vfǉĂ̗vf̎QƂɂȂȂ悤dequeŎ*/
+		std::deque<FastMatrix<T>> matrices;
+		std::deque<FastVector<T>> vectors;
+		size_t matrix_count = 0;
+		size_t vector_count = 0;
+	};
+
+}
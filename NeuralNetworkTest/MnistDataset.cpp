@@ -15,7 +15,7 @@ namespace MnistDataset {
 		return ((int)c1 << 24) + ((int)c2 << 16) + ((int)c3 << 8) + c4;
 	}
 
-	FastContainer::FastMatrix<double> Mnist::read_training_file(string filename) {
+	FastContainer::FastMatrix<float> Mnist::read_training_file(string filename) {
 		ifstream ifs(filename.c_str(), std::ios::in | std::ios::binary);
 		int magic_number = 0;
 		int number_of_images = 0;
@@ -32,7 +32,7 @@ namespace MnistDataset {
 		ifs.read((char*)&cols, sizeof(cols));
 		cols = reverseInt(cols);
 
-		FastContainer::FastMatrix<double> images(number_of_images, rows * cols);
+		FastContainer::FastMatrix<float> images(number_of_images, rows * cols);
 		cout << magic_number << " " << number_of_images << " " << rows << " " << cols << endl;
 
 		for (int i = 0; i < number_of_images; i++) {
@@ -40,14 +40,14 @@ namespace MnistDataset {
 				for (int col = 0; col < cols; col++) {
 					unsigned char temp = 0;
 					ifs.read((char*)&temp, sizeof(temp));
-					images(i, rows * row + col) = (double)temp;
+					images(i, rows * row + col) = (float)temp;
 				}
 			}
 		}
 		return images;
 	}
 
-	FastContainer::FastVector<double> Mnist::read_label_file(string filename) {
+	FastContainer::FastVector<float> Mnist::read_label_file(string filename) {
 		ifstream ifs(filename.c_str(), std::ios::in | std::ios::binary);
 		int magic_number = 0;
 		int number_of_images = 0;
@@ -58,19 +58,19 @@ namespace MnistDataset {
 		ifs.read((char*)&number_of_images, sizeof(number_of_images));
 		number_of_images = reverseInt(number_of_images);
 
-		FastContainer::FastVector<double> label(number_of_images);
+		FastContainer::FastVector<float> label(number_of_images);
 
 		cout << number_of_images << endl;
 
 		for (int i = 0; i < number_of_images; i++) {
 			unsigned char temp = 0;
 			ifs.read((char*)&temp, sizeof(temp));
-			label[i] = (double)temp;
+			label[i] = (float)temp;
 		}
 		return label;
 	}
 
-	FastContainer::FastMatrix<double> Mnist::read_label_file_onehot(string filename) {
+	FastContainer::FastMatrix<float> Mnist::read_label_file_onehot(string filename) {
 		ifstream ifs(filename.c_str(), std::ios::in | std::ios::binary);
 		int magic_number = 0;
 		int number_of_images = 0;
@@ -81,15 +81,15 @@ namespace MnistDataset {
 		ifs.read((char*)&number_of_images, sizeof(number_of_images));
 		number_of_images = reverseInt(number_of_images);
 
-		FastContainer::FastMatrix<double> label(number_of_images, 10);
+		FastContainer::FastMatrix<float> label(number_of_images, 10);
 
 		cout << number_of_images << endl;
 
 		for (int i = 0; i < number_of_images; i++) {
-			vector<double> temp(10);
+			vector<float> temp(10);
 			char digit;
 			ifs.read((char*)&digit, sizeof(char));
-			temp[digit] = 1.0;
+			temp[digit] = 1.0f;
 			for (int j = 0; j < 10; ++j) label(i, j) = temp[j];
 		}
 		return label;
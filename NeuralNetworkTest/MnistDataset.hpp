@@ -12,9 +12,9 @@ namespace MnistDataset {
 
 	class Mnist {
 	public:
-		FastContainer::FastMatrix<double> read_training_file(string filename);
-		FastContainer::FastVector<double> read_label_file(string filename);
-		FastContainer::FastMatrix<double> read_label_file_onehot(string filename);
+		FastContainer::FastMatrix<float> read_training_file(string filename);
+		FastContainer::FastVector<float> read_label_file(string filename);
+		FastContainer::FastMatrix<float> read_label_file_onehot(string filename);
 	};
 
 }
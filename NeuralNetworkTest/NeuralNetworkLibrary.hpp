@@ -6,71 +6,103 @@ namespace NeuralNetwork {
 
 #pragma region Layer
 
-	/*CNX*/
+	/*CNX
+	forward, backward ͌ʂ̎QƂԂ (g̎s񂩁AƗ̈悩؂肽s񂩁Â܂܏㏑)
+	forward  target  backward I܂ŏȂ (C͓͂o͂𕡎ʂɎQƂ)
+	̂ forward  target ㏑Ao͍͂Ɨ̈悩g̎s֏
+	workspace: 1Xebv̊ԂgƗ̈ (NetworkXebvɃZbg)*/
 	template<typename T>
 	class Layer {
 	public:
-		virtual FastContainer::FastMatrix<T> forward(FastContainer::FastMatrix<T>& target) = 0;
-		virtual FastContainer::FastMatrix<T> backward(FastContainer::FastMatrix<T>& target) = 0;
+		virtual FastContainer::FastMatrix<T>& forward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) = 0;
+		virtual FastContainer::FastMatrix<T>& backward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) = 0;
+		/*as̓͂̏`d (͖s֕ϊď`d)*/
+		virtual FastContainer::FastMatrix<T>& forward(const FastContainer::FastSparseMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			auto& x = workspace.matrix(target.get_row_size(), target.get_column_size());
+			target.to_FastMatrix(x);
+			return forward(x, workspace);
+		}
 		virtual void update(T learningRate) = 0;
+		/*xwKp d݂Accumulate<T>̐x̃}X^[d݂ƂĕʂɎ (d݂̖C͉Ȃ)*/
+		virtual void enable_master_weights() { }
+		/*zSėL (XP[ÕI[o[t[o)*/
+		virtual bool is_gradient_finite() const { return true; }
+		/*zgradScaleŊĂXV (XP[Oz̍XV)*/
+		virtual void update_scaled(FastContainer::Accumulate<T> learningRate, FastContainer::Accumulate<T> gradScale) {
+			update((T)(learningRate / gradScale));
+		}
 	};
 
 	/*VOChC*/
 	template<typename T>
 	class SigmoidLayer :public Layer<T> {
 	public:
-		FastContainer::FastMatrix<T> forward(FastContainer::FastMatrix<T>& target) {
-			return target.sigmoid();
+		FastContainer::FastMatrix<T>& forward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			auto& y = workspace.matrix(target.get_row_size(), target.get_column_size());
+			y = target;
+			y.sigmoid_inplace();
+			out = &y;
+			return y;
 		}
-		FastContainer::FastMatrix<T> backward(const FastContainer::FastMatrix<T>& target) {
-			return out * ((T)1 - out) * target;
+		FastContainer::FastMatrix<T>& backward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			target.sigmoid_backward_inplace(*out);
+			return target;
 		}
 		void update(T learningRate) {
 		}
 	private:
-		FastContainer::FastMatrix<T> out;
+		/*`d̏o (Ɨ̈̍sQƂ)*/
+		const FastContainer::FastMatrix<T> *out = nullptr;
 	};
 
-	/*ReLUC*/
+	/*ReLUC
+	t`dp̃}XN1vf1rbgŎ (o͂ƃ}XN1̑ŏ)*/
 	template<typename T>
 	class ReluLayer :public Layer<T> {
 	public:
-		FastContainer::FastMatrix<T> forward(FastContainer::FastMatrix<T>& target) {
-			mask = target > (T)0;
-			return target * mask;
+		FastContainer::FastMatrix<T>& forward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			auto& y = workspace.matrix(target.get_row_size(), target.get_column_size());
+			target.leaky_relu_mask_to(y, mask);
+			return y;
 		}
-		FastContainer::FastMatrix<T> backward(FastContainer::FastMatrix<T>& target) {
-			return target * mask;
+		FastContainer::FastMatrix<T>& backward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			target.leaky_relu_backward_to(mask, target);
+			return target;
 		}
 		void update(T learningRate) {
 		}
 	private:
-		FastContainer::FastMatrix<T> mask;
+		FastContainer::FastBitMask mask;
 	};
 
-	/*Parametric ReLUC*/
+	/*Parametric ReLUC
+	t`dp̃}XN1vf1rbgŎ (̗vf̌X͑SēȂ̂ŃrbgőIׂ)*/
 	template<typename T>
 	class PReluLayer :public Layer<T> {
 	public:
 		PReluLayer(T slope) {
 			this->slope = slope;
 		}
-		FastContainer::FastMatrix<T> forward(FastContainer::FastMatrix<T>& target) {
-			mask = target > (T)0;
-			mask = mask + (slope * (mask == (T)0));
-			return target * mask;
+		FastContainer::FastMatrix<T>& forward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			auto& y = workspace.matrix(target.get_row_size(), target.get_column_size());
+			target.leaky_relu_mask_to(y, mask, slope);
+			return y;
 		}
-		FastContainer::FastMatrix<T> backward(FastContainer::FastMatrix<T>& target) {
-			return target * mask;
+		FastContainer::FastMatrix<T>& backward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			auto& dx = workspace.matrix(target.get_row_size(), target.get_column_size());
+			target.leaky_relu_backward_to(mask, dx, slope);
+			return dx;
 		}
 		void update(T learningRate) {
 		}
 	private:
-		FastContainer::FastMatrix<T> mask;
+		FastContainer::FastBitMask mask;
 		T slope;
 	};
 
-	/*Randomized Leaky ReLUC*/
+	/*Randomized Leaky ReLUC
+	t`dpɂ1vf1rbg̃}XNƌX̗̎킾A
+	X͋t`dœ킩Ɨ̈֐ (JE^̗Ȃ̂œlɂȂ)*/
 	template<typename T>
 	class RReluLayer :public Layer<T> {
 	public:
@@ -78,19 +110,30 @@ namespace NeuralNetwork {
 			this->slope_min = slope_min;
 			this->slope_max = slope_max;
 		}
-		FastContainer::FastMatrix<T> forward(FastContainer::FastMatrix<T>& target) {
-			mask = target > (T)0;
-			auto rnd = FastContainer::FastMatrix<T>::real_random_ppl(target.get_row_size(), target.get_column_size(), slope_min, slope_max);
-			mask = mask + (rnd * (mask == (T)0));
-			return target * mask;
+		FastContainer::FastMatrix<T>& forward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			seed = FastContainer::next_random_seed();
+			auto& slopes = generate_slopes(target.get_row_size(), target.get_column_size(), workspace);
+			auto& y = workspace.matrix(target.get_row_size(), target.get_column_size());
+			target.leaky_relu_mask_to(y, mask, slopes);
+			return y;
 		}
-		FastContainer::FastMatrix<T> backward(FastContainer::FastMatrix<T>& target) {
-			return target * mask;
+		FastContainer::FastMatrix<T>& backward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			auto& slopes = generate_slopes(target.get_row_size(), target.get_column_size(), workspace);
+			auto& dx = workspace.matrix(target.get_row_size(), target.get_column_size());
+			target.leaky_relu_backward_to(mask, dx, slopes);
+			return dx;
 		}
 		void update(T learningRate) {
 		}
 	private:
-		FastContainer::FastMatrix<T> mask;
+		/*̃Xebv̌X̗Ɨ̈֐*/
+		FastContainer::FastMatrix<T>& generate_slopes(int row, int col, FastContainer::Workspace<T>& workspace) {
+			auto& slopes = workspace.matrix(row, col);
+			slopes.fill_real_random(slope_min, slope_max, seed, FastContainer::ThreadPool::get_instance());
+			return slopes;
+		}
+		FastContainer::FastBitMask mask;
+		uint64_t seed = 0;
 		T slope_min;
 		T slope_max;
 	};
@@ -99,23 +142,71 @@ namespace NeuralNetwork {
 	template<typename T>
 	class AffineLayer :public Layer<T> {
 	public:
+		using A = FastContainer::Accumulate<T>;
 		AffineLayer(const FastContainer::FastMatrix<T>& w, const FastContainer::FastVector<T>& b) {
 			this->w = w;
 			this->b = b;
 		}
-		FastContainer::FastMatrix<T> forward(FastContainer::FastMatrix<T>& target) {
-			x = target;
-			return target.dot_amp(w).add_by_rows(b);
+		FastContainer::FastMatrix<T>& forward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			sparse_input = false;
+			x = &target;
+			auto& out = workspace.matrix(target.get_row_size(), w.get_column_size());
+			target.dot_to(w, false, false, out);
+			out.add_by_rows_inplace(b);
+			return out;
+		}
+		/*as̓ (vZʂ͓͂̔vf̐ɔႷ)*/
+		FastContainer::FastMatrix<T>& forward(const FastContainer::FastSparseMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			sparse_input = true;
+			sparse_x = &target;
+			auto& out = workspace.matrix(target.get_row_size(), w.get_column_size());
+			target.dot_to(w, out, sparse_buffer);
+			out.add_by_rows_inplace(b);
+			return out;
 		}
-		FastContainer::FastMatrix<T> backward(FastContainer::FastMatrix<T>& target) {
-			auto dx = target.dot_amp(w.reverse());
-			dw = x.reverse().dot_amp(target);
-			db = target.sum_by_columns();
+		/*as̓͂̏ꍇA͂̓f[^ (擪̃C) Ȃ̂œ͑̌z͌vZ̍sԂ*/
+		FastContainer::FastMatrix<T>& backward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			if (sparse_input) {
+				sparse_x->transpose_dot_to(target, dw, sparse_xt, sparse_buffer);
+				target.sum_by_columns_to(db);
+				return workspace.matrix(0, 0);
+			}
+			auto& dx = workspace.matrix(target.get_row_size(), w.get_row_size());
+			target.dot_to(w, false, true, dx);
+			x->dot_to(target, true, false, dw);
+			target.sum_by_columns_to(db);
 			return dx;
 		}
 		void update(T learningRate) {
-			w = w - (learningRate * dw);
-			b = b - (learningRate * db);
+			w.axpy(-learningRate, dw);
+			b.axpy(-learningRate, db);
+		}
+		void enable_master_weights() {
+			//vf̌^Accumulate<T>Ȃd݂̂̂}X^[d
+			if (std::is_same<T, A>::value || has_master) return;
+			w.cast_to(master_w);
+			b.cast_to(master_b);
+			has_master = true;
+		}
+		bool is_gradient_finite() const {
+			return dw.is_finite() && db.is_finite();
+		}
+		void update_scaled(A learningRate, A gradScale) {
+			if (!has_master) {
+				update((T)(learningRate / gradScale));
+				return;
+			}
+			//}X^[d݂XVĂvf̌^֊ۂ߂ (ȍXVʂۂ߂ŏȂ)
+			master_w.axpy_cast(-learningRate / gradScale, dw);
+			master_b.axpy_cast(-learningRate / gradScale, db);
+			master_w.cast_to(w);
+			master_b.cast_to(b);
+		}
+		FastContainer::FastMatrix<T> get_w() {
+			return w;
+		}
+		FastContainer::FastVector<T> get_b() {
+			return b;
 		}
 		FastContainer::FastMatrix<T> get_dw() {
 			return dw;
@@ -123,95 +214,361 @@ namespace NeuralNetwork {
 		FastContainer::FastVector<T> get_db() {
 			return db;
 		}
-	private:
+	protected:
 		FastContainer::FastMatrix<T> w;
 		FastContainer::FastVector<T> b;
-		FastContainer::FastMatrix<T> x;
+		/*`d̓ (ʂɎQƂ ͍͂Ɨ̈悩ÕC̏o͂ŁAt`d܂ŏȂ)*/
+		FastContainer::FastMatrix<T> *x = nullptr;
+		/*as̏`d̓ (ʂɎQƂ Ăяõob`͋t`d܂ŗL)*/
+		const FastContainer::FastSparseMatrix<T> *sparse_x = nullptr;
+		/*͂̓]u (ob`Ȃ]uȂ)*/
+		FastContainer::FastSparseMatrix<T> sparse_xt;
+		/*asƂ̐ς̍Ɨ̈*/
+		FastContainer::SparseDotBuffer<T> sparse_buffer;
+		bool sparse_input = false;
 		FastContainer::FastMatrix<T> dw;
 		FastContainer::FastVector<T> db;
+		FastContainer::FastMatrix<A> master_w;
+		FastContainer::FastVector<A> master_b;
+		bool has_master = false;
+	};
+
+	/*AtBCƊ֐ (ReLU, VOCh) ZC
+	oCAX̉ZƊ֐sς̃Gs[OœKp̂ŁAo͂1񂾂݁A
+	AffineLayerReluLayerׂꍇ̒Ԃ̍sƗ]ȑȂ*/
+	template<typename T>
+	class AffineActivationLayer :public AffineLayer<T> {
+	public:
+		AffineActivationLayer(const FastContainer::FastMatrix<T>& w, const FastContainer::FastVector<T>& b, FastContainer::GemmActivation activation = FastContainer::GEMM_ACTIVATION_RELU)
+			: AffineLayer<T>(w, b) {
+			this->activation = activation;
+		}
+		FastContainer::FastMatrix<T>& forward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			this->sparse_input = false;
+			this->x = &target;
+			auto& out = workspace.matrix(target.get_row_size(), this->w.get_column_size());
+			target.dot_activation_to(this->w, this->b, activation, out, activation == FastContainer::GEMM_ACTIVATION_RELU ? &mask : nullptr);
+			y = &out;
+			return out;
+		}
+		/*as̓ (vZʂ͓͂̔vf̐ɔႷ)*/
+		FastContainer::FastMatrix<T>& forward(const FastContainer::FastSparseMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			this->sparse_input = true;
+			this->sparse_x = &target;
+			auto& out = workspace.matrix(target.get_row_size(), this->w.get_column_size());
+			target.dot_activation_to(this->w, this->b, activation, out, activation == FastContainer::GEMM_ACTIVATION_RELU ? &mask : nullptr, this->sparse_buffer);
+			y = &out;
+			return out;
+		}
+		/*֐̔|ĂAtBC̋t`d*/
+		FastContainer::FastMatrix<T>& backward(FastContainer::FastMatrix<T>& target, FastContainer::Workspace<T>& workspace) {
+			if (activation == FastContainer::GEMM_ACTIVATION_RELU) {
+				target.leaky_relu_backward_to(mask, target);
+			}
+			else if (activation == FastContainer::GEMM_ACTIVATION_SIGMOID) {
+				target.sigmoid_backward_inplace(*y);
+			}
+			return AffineLayer<T>::backward(target, workspace);
+		}
+		FastContainer::GemmActivation get_activation() const { return activation; }
+	private:
+		FastContainer::GemmActivation activation;
+		FastContainer::FastBitMask mask;
+		/*`d̏o (VOCh̋t`dŎg Ɨ̈̍sQƂ)*/
+		const FastContainer::FastMatrix<T> *y = nullptr;
 	};
 
 #pragma endregion
 
 #pragma region LastLayer
 
-	/*ŏICNX*/
+	/*ŏICNX
+	loss_scale: XP[O̔{ (backwarďz͂̔{|̂Ԃ)*/
 	template<typename T>
 	class LastLayer {
 	public:
-		virtual T forward(FastContainer::FastMatrix<T>& target, FastContainer::FastMatrix<T>& teacher) = 0;
-		virtual FastContainer::FastMatrix<T> backward() = 0;
+		virtual T forward(FastContainer::FastMatrix<T>& target, FastContainer::FastMatrix<T>& teacher, FastContainer::Workspace<T>& workspace) = 0;
+		virtual FastContainer::FastMatrix<T>& backward() = 0;
+		void set_loss_scale(FastContainer::Accumulate<T> scale) { loss_scale = scale; }
+		FastContainer::Accumulate<T> get_loss_scale() const { return loss_scale; }
+	protected:
+		FastContainer::Accumulate<T> loss_scale = 1;
+	};
+
+	/*IȑXP[O
+	16rbg_̌z0ɒׂȂ悤Aɔ{|Ăt`d
+	zinf, NaNoXV΂Ĕ{Agrowth_interval񑱂Đ{グ (max_scale܂)*/
+	template<typename T>
+	class DynamicLossScale {
+	public:
+		DynamicLossScale(T initial_scale = 65536, int growth_interval = 2000, T growth_factor = 2, T backoff_factor = (T)0.5)
+			: scale(initial_scale), growth_interval(growth_interval), growth_factor(growth_factor), backoff_factor(backoff_factor) { }
+		/*zLȂtrueԂĔ{グ鏀AłȂfalseԂĔ{*/
+		bool step(bool finite) {
+			if (!finite) {
+				scale = std::max(scale * backoff_factor, (T)1);
+				good_steps = 0;
+				skipped_steps++;
+				return false;
+			}
+			if (++good_steps >= growth_interval) {
+				scale = std::min(scale * growth_factor, max_scale);
+				good_steps = 0;
+			}
+			return true;
+		}
+		T get_scale() const { return scale; }
+		long long get_skipped_steps() const { return skipped_steps; }
+		/*{̏ύX (̔{܂łɗ})*/
+		void set_max_scale(T value) {
+			max_scale = std::max(value, (T)1);
+			scale = std::min(scale, max_scale);
+		}
+		T get_max_scale() const { return max_scale; }
+	private:
+		T scale;
+		T max_scale = std::numeric_limits<T>::max();
+		int growth_interval;
+		T growth_factor;
+		T backoff_factor;
+		int good_steps = 0;
+		long long skipped_steps = 0;
 	};
 
 	/*\tg}bNX덷C*/
 	template<typename T>
 	class SoftmaxWithLossLayer :public LastLayer<T> {
 	public:
-		T forward(FastContainer::FastMatrix<T>& target, FastContainer::FastMatrix<T>& teacher) {
+		T forward(FastContainer::FastMatrix<T>& target, FastContainer::FastMatrix<T>& teacher, FastContainer::Workspace<T>& workspace) {
+			//1̏ꍇ͗񐔂ŊAXP[O̔{| (zT֊ۂ߂OɊ|)
+			FastContainer::Accumulate<T> scale = this->loss_scale;
+			if (target.get_row_size() == 1) scale /= target.get_column_size();
+			T loss;
 			if ((target.get_column_size() == 1) && (teacher.get_row_size() == 1)) {
-				this->teacher = teacher.reverse();
+				//1s̓]u͕тȂ̂Ō`ς
+				auto& reversed = workspace.matrix(teacher.get_row_size(), teacher.get_column_size());
+				reversed = teacher;
+				reversed.resize(teacher.get_column_size(), 1);
+				loss = target.softmax_cross_entropy(reversed, out, grad, scale);
 			}
 			else {
-				this->teacher = teacher;
+				loss = target.softmax_cross_entropy(teacher, out, grad, scale);
 			}
-			out = target.softmax();
-			return out.cross_entropy_error_class(this->teacher);
+			return loss;
 		}
-		FastContainer::FastMatrix<T> backward() {
-			if (teacher.get_row_size() == 1) return (out - teacher) / (T)teacher.get_column_size();
-			else return (out - teacher) / (T)teacher.get_row_size();
+		FastContainer::FastMatrix<T>& backward() {
+			return grad;
 		}
 	private:
 		FastContainer::FastMatrix<T> out;
-		FastContainer::FastMatrix<T> teacher;
+		FastContainer::FastMatrix<T> grad;
 	};
 
 #pragma endregion
 
 #pragma region NeuralNetwork
 
-	/*j[lbg[N*/
+	/*j[lbg[N
+	eC̒Ԍʂ͍Ɨ̈悩؂AXebv (predict, loss, gradient ̌Ăяo) ɃZbg
+	`񓯂Ȃ2ڈȍ~̃Xebvł͍s̗̈mۂȂ*/
 	template<typename T>
 	class Network {
 	public:
 		std::vector<Layer<T> *> layers;
 		LastLayer<T> *lastLayer;
-		FastContainer::FastMatrix<T> predict(FastContainer::FastMatrix<T>& input) {
-			auto result = input;
-			for each (auto layer in layers)
+		FastContainer::FastMatrix<T> predict(FastContainer::FastMatrix<T>& input) { return predict_impl(input); }
+		T loss(FastContainer::FastMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) { return loss_impl(input, teacher); }
+		T accuracy(FastContainer::FastMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) { return accuracy_impl(input, teacher); }
+		std::vector<Layer<T> *> gradient(FastContainer::FastMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) { return gradient_impl(input, teacher); }
+		/*as̓ (擪̃Caŝ܂܎󂯎 AtBCȂvZʂ͔vf̐ɔႷ)*/
+		FastContainer::FastMatrix<T> predict(const FastContainer::FastSparseMatrix<T>& input) { return predict_impl(input); }
+		T loss(const FastContainer::FastSparseMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) { return loss_impl(input, teacher); }
+		T accuracy(const FastContainer::FastSparseMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) { return accuracy_impl(input, teacher); }
+		std::vector<Layer<T> *> gradient(const FastContainer::FastSparseMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) { return gradient_impl(input, teacher); }
+		void update(T learningRate) {
+			for (auto layer : layers)
 			{
-				result = layer->forward(result);
+				layer->update(learningRate);
 			}
-			return result;
 		}
-		T loss(FastContainer::FastMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) {
-			auto y = predict(input);
-			return lastLayer->forward(y, teacher);
+		/*wK (xwKŌzI[o[t[AXV΂ꍇfalse)*/
+		bool training(FastContainer::FastMatrix<T>& input, FastContainer::FastMatrix<T>& teacher, T learningRate) { return training_impl(input, teacher, learningRate); }
+		bool training(const FastContainer::FastSparseMatrix<T>& input, FastContainer::FastMatrix<T>& teacher, T learningRate) { return training_impl(input, teacher, learningRate); }
+		/*xwKLɂ (CǉɌĂ)
+		ƌzT (bfloat16, half) ̂܂܁Ad݂Accumulate<T> (float) ̃}X^[d݂ōXVA
+		z͓IȑXP[OŌh (gradienťz͑XP[O̔{|̂ɂȂ)
+		{Tŕ\ő2̙p܂łɗ} (halfȂ32768)*/
+		void enable_mixed_precision(const DynamicLossScale<FastContainer::Accumulate<T>>& scale = DynamicLossScale<FastContainer::Accumulate<T>>()) {
+			mixed_precision = true;
+			loss_scale = scale;
+			loss_scale.set_max_scale(std::min(loss_scale.get_max_scale(), std::exp2(std::floor(std::log2((A)std::numeric_limits<T>::max())))));
+			for (auto layer : layers) layer->enable_master_weights();
 		}
-		T accuracy(FastContainer::FastMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) {
-			auto y = predict(input).argmax_by_rows();
+		/*XP[Ȍ*/
+		const DynamicLossScale<FastContainer::Accumulate<T>>& get_loss_scale() const { return loss_scale; }
+		/*Ɨ̈*/
+		const FastContainer::Workspace<T>& get_workspace() const { return workspace; }
+		/*sς̃ubNTCYƕ񉻂臒l
+		xzvZĎgsς̑傫L^Â̂Όv
+		(ʂ̓}ṼLbVt@CɕۑAȍ~͓ǂݍނ)*/
+		void autotune(FastContainer::FastMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) {
+			//16rbg_̍sςfloatŌvẐfloatƂĒ
+			using C = typename FastContainer::GemmCompute<T>::type;
+			auto& recorder = FastContainer::GemmShapeRecorder<C>::get_instance();
+			recorder.start();
+			gradient(input, teacher);
+			auto shapes = recorder.stop();
+			auto& tuner = FastContainer::Autotuner::get_instance();
+			if (tuner.is_tuned<C>(shapes)) return;
+			tuner.tune<C>(shapes);
+		}
+	private:
+		using A = FastContainer::Accumulate<T>;
+		FastContainer::Workspace<T> workspace;
+		bool mixed_precision = false;
+		DynamicLossScale<A> loss_scale;
+		/*SC̏`d (͍͂Ɨ̈֕ʂĂn̂ŏȂ)*/
+		FastContainer::FastMatrix<T>& forward_layers(FastContainer::FastMatrix<T>& input) {
+			auto& x = workspace.matrix(input.get_row_size(), input.get_column_size());
+			x = input;
+			return forward_layers_from(x, 0);
+		}
+		/*as̓͂͐擪̃Cւ̂܂ܓn*/
+		FastContainer::FastMatrix<T>& forward_layers(const FastContainer::FastSparseMatrix<T>& input) {
+			if (layers.empty()) throw FastContainer::fast_container_exception();
+			return forward_layers_from(layers.front()->forward(input, workspace), 1);
+		}
+		/*Cfirstȍ~̏`d*/
+		FastContainer::FastMatrix<T>& forward_layers_from(FastContainer::FastMatrix<T>& input, size_t first) {
+			FastContainer::FastMatrix<T> *result = &input;
+			for (size_t i = first; i < layers.size(); i++)
+			{
+				result = &layers[i]->forward(*result, workspace);
+			}
+			return *result;
+		}
+		/*ȉ͓͂s (FastMatrix) Ƒas (FastSparseMatrix) ŋ*/
+		template<class X>
+		T forward_loss(X& input, FastContainer::FastMatrix<T>& teacher) {
+			auto& y = forward_layers(input);
+			return lastLayer->forward(y, teacher, workspace);
+		}
+		template<class X>
+		FastContainer::FastMatrix<T> predict_impl(X& input) {
+			workspace.reset();
+			return forward_layers(input);
+		}
+		template<class X>
+		T loss_impl(X& input, FastContainer::FastMatrix<T>& teacher) {
+			workspace.reset();
+			return forward_loss(input, teacher);
+		}
+		template<class X>
+		T accuracy_impl(X& input, FastContainer::FastMatrix<T>& teacher) {
+			workspace.reset();
+			auto y = forward_layers(input).argmax_by_rows();
 			auto t = teacher.argmax_by_rows();
-			return (y == t).sum() / input.get_row_size();
+			return (T)((FastContainer::Accumulate<T>)(y == t).sum() / input.get_row_size());
 		}
-		std::vector<Layer<T> *> gradient(FastContainer::FastMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) {
-			loss(input, teacher);
-			auto out = lastLayer->backward();
+		template<class X>
+		std::vector<Layer<T> *> gradient_impl(X& input, FastContainer::FastMatrix<T>& teacher) {
+			workspace.reset();
+			forward_loss(input, teacher);
+			auto& grad = lastLayer->backward();
+			auto& dout = workspace.matrix(grad.get_row_size(), grad.get_column_size());
+			dout = grad;
+			FastContainer::FastMatrix<T> *out = &dout;
+			//擪̃CԂ͑̌z͎gȂ (as̓͂ł͋̍s)
 			for (auto it = layers.rbegin(); it != layers.rend(); ++it) {
-				out = (*it)->backward(out);
+				out = &(*it)->backward(*out, workspace);
 			}
 			return layers;
 		}
-		void update(T learningRate) {
-			for each (auto layer in layers)
-			{
-				layer->update(learningRate);
+		template<class X>
+		bool training_impl(X& input, FastContainer::FastMatrix<T>& teacher, T learningRate) {
+			if (!mixed_precision) {
+				gradient(input, teacher);
+				update(learningRate);
+				return true;
 			}
-		}
-		void training(FastContainer::FastMatrix<T>& input, FastContainer::FastMatrix<T>& teacher, T learningRate) {
+			lastLayer->set_loss_scale(loss_scale.get_scale());
 			gradient(input, teacher);
-			update(learningRate);
+			bool finite = true;
+			for (auto layer : layers) finite = finite && layer->is_gradient_finite();
+			A scale = loss_scale.get_scale();
+			if (!loss_scale.step(finite)) return false;
+			for (auto layer : layers) layer->update_scaled((A)learningRate, scale);
+			return true;
+		}
+	};
+
+#pragma endregion
+
+#pragma region QuantizedNetwork
+
+	/*int8ʎq_plbg[N
+	wKς݂Network̃AtBC̏d݂o̓`l̃XP[int8ɗʎq (wKʎq)A
+	eAtBC̓͂̃XP[calibration (\Iȓ) ̏`dőőΒl猈߂
+	Ή郌C̓AtBCReLUC (ReLU͒ÕAtBC̍ėʎqɗZ) ReLUZAtBC
+	Ԃ̊int8̂܂܎̃AtBC֓nAŌ̃AtBC̏o͂T֖߂*/
+	template<typename T>
+	class QuantizedNetwork {
+	public:
+		QuantizedNetwork(Network<T>& net, FastContainer::FastMatrix<T>& calibration) {
+			FastContainer::Workspace<T> workspace;
+			auto& x = workspace.matrix(calibration.get_row_size(), calibration.get_column_size());
+			x = calibration;
+			FastContainer::FastMatrix<T> *out = &x;
+			for (auto layer : net.layers) {
+				if (auto affine = dynamic_cast<AffineLayer<T> *>(layer)) {
+					//ZCReLUΉ
+					auto fused = dynamic_cast<AffineActivationLayer<T> *>(layer);
+					if (fused != nullptr && fused->get_activation() == FastContainer::GEMM_ACTIVATION_SIGMOID) throw FastContainer::fast_container_exception();
+					FastContainer::Int8Affine stage;
+					stage.weight = FastContainer::Int8Weight::quantize(affine->get_w());
+					auto b = affine->get_b();
+					stage.bias.resize(b.get_size());
+					for (int j = 0; j < b.get_size(); j++) stage.bias[j] = (float)(FastContainer::Accumulate<T>)b[j];
+					float max_abs = std::max(std::fabs((float)(FastContainer::Accumulate<T>)out->get_max()), std::fabs((float)(FastContainer::Accumulate<T>)out->get_min()));
+					stage.input_scale = FastContainer::int8_scale(max_abs);
+					stage.relu = fused != nullptr && fused->get_activation() == FastContainer::GEMM_ACTIVATION_RELU;
+					stages.push_back(std::move(stage));
+				}
+				else if (dynamic_cast<ReluLayer<T> *>(layer) != nullptr) {
+					//ReLU̓AtBC̒ゾZł
+					if (stages.empty() || stages.back().relu) throw FastContainer::fast_container_exception();
+					stages.back().relu = true;
+				}
+				else {
+					throw FastContainer::fast_container_exception();
+				}
+				out = &layer->forward(*out, workspace);
+			}
+			if (stages.empty()) throw FastContainer::fast_container_exception();
+		}
+		FastContainer::FastMatrix<T> predict(const FastContainer::FastMatrix<T>& input) {
+			FastContainer::FastMatrix<T> result;
+			input_buffer.quantize(input, stages.front().input_scale);
+			FastContainer::Int8Activation *x = &input_buffer;
+			for (size_t i = 0; i + 1 < stages.size(); i++) {
+				FastContainer::Int8Activation *y = (x == &buffers[0]) ? &buffers[1] : &buffers[0];
+				stages[i].forward(*x, *y, stages[i + 1].input_scale);
+				x = y;
+			}
+			stages.back().forward(*x, result);
+			return result;
+		}
+		T accuracy(const FastContainer::FastMatrix<T>& input, FastContainer::FastMatrix<T>& teacher) {
+			auto y = predict(input).argmax_by_rows();
+			auto t = teacher.argmax_by_rows();
+			return (T)((FastContainer::Accumulate<T>)(y == t).sum() / input.get_row_size());
 		}
+		/*ʎqAtBC*/
+		const std::vector<FastContainer::Int8Affine>& get_stages() const { return stages; }
 	private:
+		std::vector<FastContainer::Int8Affine> stages;
+		FastContainer::Int8Activation input_buffer;
+		FastContainer::Int8Activation buffers[2];
 	};
 
 #pragma endregion
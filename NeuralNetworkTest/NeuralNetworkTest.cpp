@@ -4,14 +4,20 @@
 #include "stdafx.h"
 
 //#define FAST_CONTAONER_FUNCTIONS_COM_MODE
-#define FAST_CONTAONER_FUNCTIONS_AMP_MODE
+//#define FAST_CONTAONER_FUNCTIONS_AMP_MODE
 //#define FAST_CONTAONER_FUNCTIONS_PPL_MODE
+//#define FAST_CONTAONER_FUNCTIONS_STD_MODE
+#define FAST_CONTAONER_FUNCTIONS_AUTO_MODE
 
 //#define FAST_CONTAONER_OPERATOR_OVERLOAD_COM_MODE
-#define FAST_CONTAONER_OPERATOR_OVERLOAD_AMP_MODE
+//#define FAST_CONTAONER_OPERATOR_OVERLOAD_AMP_MODE
 //#define FAST_CONTAONER_OPERATOR_OVERLOAD_PPL_MODE
+//#define FAST_CONTAONER_OPERATOR_OVERLOAD_STD_MODE
+//#define FAST_CONTAONER_OPERATOR_OVERLOAD_AUTO_MODE
+#define FAST_CONTAONER_OPERATOR_OVERLOAD_EXPR_MODE
 
 //#define FAST_CONTAINER_NO_EXCEPTION
+//#define FAST_CONTAINER_NO_AMP
 
 #include "NeuralNetworkLibrary.hpp"
 #include "MnistDataset.hpp"
@@ -37,16 +43,35 @@ void cout_calc_span(T func, int cycle_num = 1, std::string str = "calc") {
 	cout << str.c_str() << ": " << timeSpan << "s" << endl;
 }
 
+void argmax_test() {
+	//最大値のインデックスはintで返す (bfloat16は256を超える整数を正確に表せない)
+	FastMatrix<bfloat16> mat(2, 2000);
+	mat(0, 1238) = (bfloat16)1.0f;
+	mat(1, 1999) = (bfloat16)1.0f;
+	auto rows = mat.argmax_by_rows();
+	auto view_rows = mat.columns_view(1, 1999).argmax_by_rows();
+	bool ok = rows[0] == 1238 && rows[1] == 1999 && view_rows[0] == 1237 && view_rows[1] == 1998
+		&& mat.get_argmax() == 1238 && mat.row_view(1).get_argmax() == 1999;
+	cout << "bfloat16 argmax: " << (ok ? "OK" : "NG") << endl;
+}
+
 void neuralnetwork_test() {
-	using fvd = FastVector<double>;
-	using fvi = FastVector<int>;
-	using fmd = FastMatrix<double>;
+	/*
+	要素の型 (float, double, bfloat16, half)
+	bfloat16, halfはMSVCでは FAST_CONTAINER_NO_AMP を定義すること
+	*/
+	using real = float;
+	using fvr = FastVector<real>;
+	using fmr = FastMatrix<real>;
 
 	Mnist mnist;
-	auto train_img = fmd(mnist.read_training_file("mnist\\train-images.idx3-ubyte")).normalization();
-	auto train_lbl = fmd(mnist.read_label_file_onehot("mnist\\train-labels.idx1-ubyte"));
-	auto test_img = fmd(mnist.read_training_file("mnist\\t10k-images.idx3-ubyte")).normalization();
-	auto test_lbl = fmd(mnist.read_label_file_onehot("mnist\\t10k-labels.idx1-ubyte"));
+	auto train_img = mnist.read_training_file("mnist\\train-images.idx3-ubyte").normalization().cast<real>();
+	auto train_lbl = mnist.read_label_file_onehot("mnist\\train-labels.idx1-ubyte").cast<real>();
+	auto test_img = mnist.read_training_file("mnist\\t10k-images.idx3-ubyte").normalization().cast<real>();
+	auto test_lbl = mnist.read_label_file_onehot("mnist\\t10k-labels.idx1-ubyte").cast<real>();
+
+	//画素の大半は0なので学習の入力は疎行列にする (1層目の計算量が非零要素の数に比例する)
+	FastSparseMatrix<real> train_sparse(train_img);
 
 	int train_num = 100;
 	int batch_size = 1000;
@@ -54,31 +79,56 @@ void neuralnetwork_test() {
 	int input_size = train_img.get_column_size();
 	int hidden_size = 100;
 	int output_size = train_lbl.get_column_size();
-	double weight_init = 0.05;
+	real weight_init = 0.05f;
+
+	Network<real> net;
+
+	//アフィンレイヤとReLUは行列積のエピローグで融合する
+	net.layers.push_back(new AffineActivationLayer<real>(weight_init * fmr::normal_random_ppl(input_size, hidden_size), weight_init * fvr::real_random_ppl(hidden_size), GEMM_ACTIVATION_RELU));
+	net.layers.push_back(new AffineLayer<real>(weight_init * fmr::normal_random_ppl(hidden_size, output_size), weight_init * fvr::real_random_ppl(output_size)));
+	net.lastLayer = new SoftmaxWithLossLayer<real>();
+	//16ビット浮動小数点では混合精度学習 (floatのマスター重みと動的な損失スケーリング) を使う
+	if (IsHalfFloat<real>::value) net.enable_mixed_precision();
 
-	Network<double> net;
+	//エポック毎に並べ替えた順列からミニバッチを取り出す
+	EpochSampler train_sampler(train_img.get_row_size(), batch_size);
+	EpochSampler test_sampler(test_img.get_row_size(), tbatch_size);
 
-	net.layers.push_back(new AffineLayer<double>(weight_init * fmd::normal_random_ppl(input_size, hidden_size), weight_init * fvd::real_random_ppl(hidden_size)));
-	net.layers.push_back(new ReluLayer<double>());
-	net.layers.push_back(new AffineLayer<double>(weight_init * fmd::normal_random_ppl(hidden_size, output_size), weight_init * fvd::real_random_ppl(output_size)));
-	net.lastLayer = new SoftmaxWithLossLayer<double>();
+	{
+		auto& mask = train_sampler.next();
+		auto x_batch = train_img.batch(mask);
+		auto t_batch = train_lbl.batch(mask);
+		net.autotune(x_batch, t_batch);
+	}
 
+	//疎行列のバッチは領域を使い回す
+	FastSparseMatrix<real> x_sparse;
 	for (int i = 0; i < train_num; i++) {
-		auto mask = fvi::int_hash_random(batch_size, 0, train_img.get_row_size() - 1);
+		auto& mask = train_sampler.next();
 		auto x_batch = train_img.batch(mask);
+		train_sparse.batch_to(mask, x_sparse);
 		auto t_batch = train_lbl.batch(mask);
-		auto tmask = fvi::int_hash_random(tbatch_size, 0, test_img.get_row_size() - 1);
+		auto& tmask = test_sampler.next();
 		auto tx_batch = test_img.batch(tmask);
 		auto tt_batch = test_lbl.batch(tmask);
-		net.training(x_batch, t_batch, weight_init);
+		net.training(x_sparse, t_batch, weight_init);
 		//cout << "loss:" << net.loss(x_batch, t_batch) << endl;
 		cout << to_string(i).c_str() << ".train acc: " << net.accuracy(x_batch, t_batch) << endl;
 		cout << to_string(i).c_str() << ".test  acc: " << net.accuracy(tx_batch, tt_batch) << endl;
 	}
+
+	//int8量子化した推論 (キャリブレーションは学習データの一部)
+	{
+		auto& mask = train_sampler.next();
+		auto calibration = train_img.batch(mask);
+		QuantizedNetwork<real> qnet(net, calibration);
+		cout << "int8 test acc: " << qnet.accuracy(test_img, test_lbl) << endl;
+	}
 }
 
 int main()
 {
+	argmax_test();
 	neuralnetwork_test();
 
 	getchar();
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+/*
+MSVCȊO̊ (܂ FAST_CONTAINER_NO_AMP w莞)  C++ AMP / PPL ̍ŏ̑ւ`
+(AMPAPPLThreadPoolŎs)
+*/
+#ifdef FAST_CONTAINER_NO_AMP
+
+#define restrict(...)
+
+namespace concurrency {
+
+	template<int N>
+	class index {
+	public:
+		index() { for (auto&& x : idx) x = 0; }
+		index(int i0) { idx[0] = i0; }
+		index(int i0, int i1) { idx[0] = i0; idx[1] = i1; }
+		int& operator[](int i) { return idx[i]; }
+		int operator[](int i) const { return idx[i]; }
+	private:
+		int idx[N];
+	};
+
+	inline index<1> operator+(int val, const index<1>& idx) { return index<1>(val + idx[0]); }
+	inline index<1> operator+(const index<1>& idx, int val) { return index<1>(idx[0] + val); }
+
+	template<int N>
+	class extent :public index<N> {
+	public:
+		using index<N>::index;
+		int size() const {
+			int result = 1;
+			for (int i = 0; i < N; i++) result *= (*this)[i];
+			return result;
+		}
+	};
+
+	template<typename T, int N>
+	class array_view;
+
+	template<typename T>
+	class array_view<T, 1> {
+	public:
+		array_view(int size, T *ptr) : extent(size), ptr(ptr) { }
+		T& operator[](const index<1>& idx) const { return ptr[idx[0]]; }
+		T& operator[](int i) const { return ptr[i]; }
+		void discard_data() const { }
+		void synchronize() const { }
+		concurrency::extent<1> extent;
+	private:
+		T *ptr;
+	};
+
+	template<typename T>
+	class array_view<T, 2> {
+	public:
+		array_view(int row, int col, T *ptr) : extent(row, col), ptr(ptr) { }
+		T& operator[](const index<2>& idx) const { return ptr[idx[0] * extent[1] + idx[1]]; }
+		T *operator[](int row) const { return ptr + row * extent[1]; }
+		void discard_data() const { }
+		void synchronize() const { }
+		concurrency::extent<2> extent;
+	private:
+		T *ptr;
+	};
+
+	template<class F>
+	void parallel_for_each(const extent<1>& ext, const F& func) {
+		FastContainer::parallel_for(0, ext[0], [&](int i) { func(index<1>(i)); });
+	}
+	template<class F>
+	void parallel_for_each(const extent<2>& ext, const F& func) {
+		int col = ext[1];
+		FastContainer::parallel_for(0, ext.size(), [&](int i) { func(index<2>(i / col, i % col)); });
+	}
+
+	template<typename I, class F>
+	void parallel_for(I first, I last, const F& func) {
+		FastContainer::parallel_for((int)first, (int)last, [&](int i) { func((I)i); });
+	}
+
+	namespace fast_math {
+		using std::fabs;
+		using std::log;
+		using std::log10;
+		using std::sqrt;
+		using std::pow;
+		using std::exp;
+	}
+
+}
+
+#endif
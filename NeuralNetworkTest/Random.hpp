@@ -4,6 +4,417 @@
 
 namespace FastContainer {
 
+	/*
+	JE^̗ Philox4x32-10
+	 (seed) ƃJE^ (ubN̔ԍ, stream) 32rbg̗4vZ
+	ԂȂ̂ŁAǂ̃Xbhǂ̏ɃubNvZĂlɂȂ
+	*/
+	class Philox4x32 {
+	public:
+		Philox4x32(uint64_t seed = 0, uint64_t stream = 0) {
+			key[0] = (uint32_t)seed;
+			key[1] = (uint32_t)(seed >> 32);
+			this->stream[0] = (uint32_t)stream;
+			this->stream[1] = (uint32_t)(stream >> 32);
+		}
+
+		/*ubN[counter]̗4out֏*/
+		void generate(uint64_t counter, uint32_t *out) const {
+			uint32_t c0 = (uint32_t)counter, c1 = (uint32_t)(counter >> 32), c2 = stream[0], c3 = stream[1];
+			uint32_t k0 = key[0], k1 = key[1];
+			for (int r = 0; r < ROUNDS; r++) {
+				uint64_t p0 = (uint64_t)M0 * c0;
+				uint64_t p1 = (uint64_t)M1 * c2;
+				uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+				uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+				c1 = (uint32_t)p1;
+				c3 = (uint32_t)p0;
+				c0 = n0;
+				c2 = n2;
+				k0 += W0;
+				k1 += W1;
+			}
+			out[0] = c0;
+			out[1] = c1;
+			out[2] = c2;
+			out[3] = c3;
+		}
+		/*ubN[first][count]̗out֏ (out[4 * i + j] ̓ubN[first + i]jԖ)*/
+		void generate_blocks(uint64_t first, int count, uint32_t *out) const {
+			int i = 0;
+#ifdef FAST_CONTAINER_SIMD_AVX2
+			//JE^̉32rbgオ肵Ȃ͈͂8ubNvZ
+			if (get_simd_level() >= SIMD_LEVEL_AVX2) {
+				for (; i + 8 <= count && (uint32_t)(first + i) <= 0xFFFFFFFFu - 7; i += 8) generate8_avx2(first + i, out + i * 4);
+			}
+#endif
+			for (; i < count; i++) generate(first + i, out + i * 4);
+		}
+
+	private:
+		static const int ROUNDS = 10;
+		static const uint32_t M0 = 0xD2511F53u;
+		static const uint32_t M1 = 0xCD9E8D57u;
+		static const uint32_t W0 = 0x9E3779B9u;
+		static const uint32_t W1 = 0xBB67AE85u;
+
+#ifdef FAST_CONTAINER_SIMD_AVX2
+		/*32rbgm̐ς̏ʂƉ*/
+		FAST_CONTAINER_TARGET(FAST_CONTAINER_TARGET_AVX2)
+		static void mulhilo_avx2(__m256i x, __m256i m, __m256i& hi, __m256i& lo) {
+			__m256i even = _mm256_mul_epu32(x, m);
+			__m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), m);
+			lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+			hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+		}
+		/*ubN[first]8 AVX2 ([jubN[first + j])*/
+		FAST_CONTAINER_TARGET(FAST_CONTAINER_TARGET_AVX2)
+		void generate8_avx2(uint64_t first, uint32_t *out) const {
+			__m256i c0 = _mm256_add_epi32(_mm256_set1_epi32((int)(uint32_t)first), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+			__m256i c1 = _mm256_set1_epi32((int)(uint32_t)(first >> 32));
+			__m256i c2 = _mm256_set1_epi32((int)stream[0]);
+			__m256i c3 = _mm256_set1_epi32((int)stream[1]);
+			__m256i m0 = _mm256_set1_epi32((int)M0);
+			__m256i m1 = _mm256_set1_epi32((int)M1);
+			uint32_t k0 = key[0], k1 = key[1];
+			for (int r = 0; r < ROUNDS; r++) {
+				__m256i hi0, lo0, hi1, lo1;
+				mulhilo_avx2(c0, m0, hi0, lo0);
+				mulhilo_avx2(c2, m1, hi1, lo1);
+				c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), _mm256_set1_epi32((int)k0));
+				c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), _mm256_set1_epi32((int)k1));
+				c1 = lo1;
+				c3 = lo0;
+				k0 += W0;
+				k1 += W1;
+			}
+			//4 x 8 ]uăubNɕׂ
+			__m256i t0 = _mm256_unpacklo_epi32(c0, c1);
+			__m256i t1 = _mm256_unpackhi_epi32(c0, c1);
+			__m256i t2 = _mm256_unpacklo_epi32(c2, c3);
+			__m256i t3 = _mm256_unpackhi_epi32(c2, c3);
+			__m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+			__m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+			__m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+			__m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+			_mm256_storeu_si256((__m256i *)(out + 0), _mm256_permute2x128_si256(u0, u1, 0x20));
+			_mm256_storeu_si256((__m256i *)(out + 8), _mm256_permute2x128_si256(u2, u3, 0x20));
+			_mm256_storeu_si256((__m256i *)(out + 16), _mm256_permute2x128_si256(u0, u1, 0x31));
+			_mm256_storeu_si256((__m256i *)(out + 24), _mm256_permute2x128_si256(u2, u3, 0x31));
+		}
+#endif
+
+		uint32_t key[2];
+		uint32_t stream[2];
+	};
+
+	inline std::atomic<uint64_t>& get_random_seed_state() {
+		static std::atomic<uint64_t> state([] {
+			std::random_device rnd;
+			return ((uint64_t)rnd() << 32) | rnd();
+		}());
+		return state;
+	}
+
+	/*̎Œ肷 (ȍ~̃_FastMatrix, FastVector̐Čł)*/
+	inline void set_random_seed(uint64_t seed) { get_random_seed_state().store(seed, std::memory_order_relaxed); }
+
+	/*Ɏg̎ (Ăяoɕʂ̒l SplitMix64)*/
+	inline uint64_t next_random_seed() {
+		uint64_t x = get_random_seed_state().fetch_add(0x9E3779B97F4A7C15ull, std::memory_order_relaxed) + 0x9E3779B97F4A7C15ull;
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+		return x ^ (x >> 31);
+	}
+
+	/*֕ϊ^ (doubleȊOfloatŌvZ)*/
+	template<typename T>
+	struct RandomCompute { using type = float; };
+	template<>
+	struct RandomCompute<double> { using type = double; };
+
+	/*32rbg̗ [0, 1) ̈l (float͏23rbgɓꂽ SIMDJ[lƓl)*/
+	inline float uniform_from_bits(uint32_t x, float) { return (float)(x >> 9) * (1.0f / 8388608.0f); }
+	inline double uniform_from_bits(uint32_t x, double) { return (double)x * (1.0 / 4294967296.0); }
+	/*32rbg̗ (0, 1) ̈l (ΐ悤0܂܂Ȃ ̍ݕ炷)*/
+	inline float uniform_open_from_bits(uint32_t x, float) { return uniform_from_bits(x, float()) + (1.0f / 16777216.0f); }
+	inline double uniform_open_from_bits(uint32_t x, double) { return uniform_from_bits(x, double()) + (1.0 / 8589934592.0); }
+
+	/*1ɂ܂Ƃ߂Đ闐̌ (4̔{)*/
+	const int RANDOM_CHUNK = 256;
+
+	/*
+	vf[i]ɃubN[i / 4][i % 4]Ԗڂ̗蓖āARANDOM_CHUNK func(first, bits, count) Ă
+	(bits[j] vf[first + j]̗ first4̔{ Ō̒[łbitsRANDOM_CHUNKׂĐ)
+	exec: s
+	*/
+	template<class F, class E>
+	void philox_for_each_chunk(int size, uint64_t seed, F func, E& exec) {
+		if (size <= 0) return;
+		Philox4x32 generator(seed);
+		int chunks = (size + RANDOM_CHUNK - 1) / RANDOM_CHUNK;
+		exec.parallel_for_range(0, chunks, [&](int begin, int end) {
+			alignas(64) uint32_t bits[RANDOM_CHUNK];
+			for (int c = begin; c < end; c++) {
+				int first = c * RANDOM_CHUNK;
+				int count = std::min(RANDOM_CHUNK, size - first);
+				generator.generate_blocks((uint64_t)(first / 4), RANDOM_CHUNK / 4, bits);
+				func(first, (const uint32_t *)bits, count);
+			}
+		}, std::max(1, SIMD_GRAIN / RANDOM_CHUNK));
+	}
+
+	/*
+	32rbgׂ̗WX^ [0, 1) ̈l̃WX^
+	(̏ʃrbg1.0̉֓1 ϊEZȂ)
+	*/
+	template<class S>
+	struct SimdRandomBits;
+
+#ifdef FAST_CONTAINER_SIMD_SSE4
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_SSE4)
+	template<>
+	struct SimdRandomBits<SimdSse4<float>> {
+		static __m128 uniform(const uint32_t *bits) {
+			__m128i x = _mm_loadu_si128((const __m128i *)bits);
+			__m128i one = _mm_or_si128(_mm_srli_epi32(x, 9), _mm_set1_epi32(0x3F800000));
+			return _mm_sub_ps(_mm_castsi128_ps(one), _mm_set1_ps(1.0f));
+		}
+	};
+	template<>
+	struct SimdRandomBits<SimdSse4<double>> {
+		static __m128d uniform(const uint32_t *bits) {
+			__m128i x = _mm_cvtepu32_epi64(_mm_loadl_epi64((const __m128i *)bits));
+			__m128i one = _mm_or_si128(_mm_slli_epi64(x, 20), _mm_set1_epi64x(0x3FF0000000000000ll));
+			return _mm_sub_pd(_mm_castsi128_pd(one), _mm_set1_pd(1.0));
+		}
+	};
+FAST_CONTAINER_TARGET_END
+#endif
+
+#ifdef FAST_CONTAINER_SIMD_AVX2
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_AVX2)
+	template<>
+	struct SimdRandomBits<SimdAvx2<float>> {
+		static __m256 uniform(const uint32_t *bits) {
+			__m256i x = _mm256_loadu_si256((const __m256i *)bits);
+			__m256i one = _mm256_or_si256(_mm256_srli_epi32(x, 9), _mm256_set1_epi32(0x3F800000));
+			return _mm256_sub_ps(_mm256_castsi256_ps(one), _mm256_set1_ps(1.0f));
+		}
+	};
+	template<>
+	struct SimdRandomBits<SimdAvx2<double>> {
+		static __m256d uniform(const uint32_t *bits) {
+			__m256i x = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *)bits));
+			__m256i one = _mm256_or_si256(_mm256_slli_epi64(x, 20), _mm256_set1_epi64x(0x3FF0000000000000ll));
+			return _mm256_sub_pd(_mm256_castsi256_pd(one), _mm256_set1_pd(1.0));
+		}
+	};
+FAST_CONTAINER_TARGET_END
+#endif
+
+#ifdef FAST_CONTAINER_SIMD_AVX512
+FAST_CONTAINER_TARGET_BEGIN(FAST_CONTAINER_TARGET_AVX512)
+	template<>
+	struct SimdRandomBits<SimdAvx512<float>> {
+		static __m512 uniform(const uint32_t *bits) {
+			__m512i x = _mm512_loadu_si512((const void *)bits);
+			__m512i one = _mm512_or_si512(_mm512_maskz_srli_epi32(SimdAvx512<float>::all, x, 9), _mm512_set1_epi32(0x3F800000));
+			return _mm512_sub_ps(_mm512_castsi512_ps(one), _mm512_set1_ps(1.0f));
+		}
+	};
+	template<>
+	struct SimdRandomBits<SimdAvx512<double>> {
+		static __m512d uniform(const uint32_t *bits) {
+			__m512i x = _mm512_maskz_cvtepu32_epi64(SimdAvx512<double>::all, _mm256_loadu_si256((const __m256i *)bits));
+			__m512i one = _mm512_or_si512(_mm512_maskz_slli_epi64(SimdAvx512<double>::all, x, 20), _mm512_set1_epi64(0x3FF0000000000000ll));
+			return _mm512_sub_pd(_mm512_castsi512_pd(one), _mm512_set1_pd(1.0));
+		}
+	};
+FAST_CONTAINER_TARGET_END
+#endif
+
+	/*̖߃ZbggȂJ[l*/
+	template<typename T>
+	struct ScalarRandomKernel {
+		static void uniform(const uint32_t *bits, T *out, int count, T lo, T width) {
+			for (int i = 0; i < count; i++) out[i] = lo + width * uniform_from_bits(bits[i], T());
+		}
+		static void normal(const uint32_t *bits, T *out, T mean, T sd) {
+			const int half = RANDOM_CHUNK / 2;
+			const T two_pi = (T)6.283185307179586;
+			for (int j = 0; j < half; j++) {
+				T r = sd * std::sqrt((T)-2 * std::log(uniform_open_from_bits(bits[j], T())));
+				T theta = two_pi * uniform_from_bits(bits[j + half], T());
+				out[j] = mean + r * std::cos(theta);
+				out[j + half] = mean + r * std::sin(theta);
+			}
+		}
+	};
+
+	/*߃Zbg̗̃J[l̕\ (T: RandomCompute<T>::type)*/
+	template<typename T>
+	struct RandomKernelTable {
+		SimdLevel level = SIMD_LEVEL_NONE;
+		void(*uniform)(const uint32_t *bits, T *out, int count, T lo, T width) = &ScalarRandomKernel<T>::uniform;
+		void(*normal)(const uint32_t *bits, T *out, T mean, T sd) = &ScalarRandomKernel<T>::normal;
+	};
+
+	/*߃Zbg̗̃J[l (Sse4Kernels, Avx2Kernels, Avx512Kernels)*/
+#define FAST_CONTAINER_SIMD_KERNELS "RandomKernels.hpp"
+#include "FastSimdTarget.hpp"
+#undef FAST_CONTAINER_SIMD_KERNELS
+
+	/*߃ZbgɑΉ闐̃J[l̕\쐬 (float, doubleȊO͖߃ZbggȂ)*/
+	template<typename T>
+	struct RandomKernelFactory {
+		static RandomKernelTable<T> create(SimdLevel level) { return RandomKernelTable<T>(); }
+	};
+	template<typename T>
+	struct RandomFloatingKernelFactory {
+		static RandomKernelTable<T> create(SimdLevel level) {
+			RandomKernelTable<T> table;
+#ifdef FAST_CONTAINER_SIMD_AVX512
+			if (level >= SIMD_LEVEL_AVX512) {
+				Avx512Kernels::register_random_kernels<SimdAvx512<T>>(table, SIMD_LEVEL_AVX512);
+				return table;
+			}
+#endif
+#ifdef FAST_CONTAINER_SIMD_AVX2
+			if (level >= SIMD_LEVEL_AVX2) {
+				Avx2Kernels::register_random_kernels<SimdAvx2<T>>(table, SIMD_LEVEL_AVX2);
+				return table;
+			}
+#endif
+#ifdef FAST_CONTAINER_SIMD_SSE4
+			if (level >= SIMD_LEVEL_SSE4) {
+				Sse4Kernels::register_random_kernels<SimdSse4<T>>(table, SIMD_LEVEL_SSE4);
+				return table;
+			}
+#endif
+			return table;
+		}
+	};
+	template<>
+	struct RandomKernelFactory<double> :public RandomFloatingKernelFactory<double> { };
+	template<>
+	struct RandomKernelFactory<float> :public RandomFloatingKernelFactory<float> { };
+
+	/*gp̖߃Zbg̗̃J[l̕\*/
+	template<typename T>
+	const RandomKernelTable<T>& get_random_kernels() {
+		static const RandomKernelTable<T> tables[SIMD_LEVEL_NUM] = {
+			RandomKernelFactory<T>::create(SIMD_LEVEL_NONE),
+			RandomKernelFactory<T>::create(SIMD_LEVEL_SSE4),
+			RandomKernelFactory<T>::create(SIMD_LEVEL_AVX2),
+			RandomKernelFactory<T>::create(SIMD_LEVEL_AVX512)
+		};
+		return tables[get_simd_level()];
+	}
+
+	/*vZ^̂܂܏o͂֒ڏ߂邩 (߂Ȃnullptr)*/
+	template<typename T, typename C>
+	struct RandomDirectOutput {
+		static C *get(T *out) { return nullptr; }
+	};
+	template<typename T>
+	struct RandomDirectOutput<T, T> {
+		static T *get(T *out) { return out; }
+	};
+
+	/*out[0]`out[size - 1]  min`max ̈l (seedȂsɊւ炸l)
+	exec: s*/
+	template<typename T, class E>
+	void random_uniform(T *out, int size, T min, T max, uint64_t seed, E& exec) {
+		using C = typename RandomCompute<T>::type;
+		if (min > max) throw fast_container_exception();
+		C lo = (C)min;
+		C width = (C)max - (C)min;
+		auto kernel = get_random_kernels<C>().uniform;
+		philox_for_each_chunk(size, seed, [&](int first, const uint32_t *bits, int count) {
+			C *direct = RandomDirectOutput<T, C>::get(out + first);
+			if (direct != nullptr) {
+				kernel(bits, direct, count, lo, width);
+				return;
+			}
+			//16rbg_Ȃǂ͍Ɨ̈ŌvZĂϊ
+			alignas(64) C buf[RANDOM_CHUNK];
+			kernel(bits, buf, count, lo, width);
+			for (int i = 0; i < count; i++) out[first + i] = (T)buf[i];
+		}, exec);
+	}
+
+	/*out[0]`out[size - 1]  min`max ̐̈l (seedȂsɊւ炸l)
+	exec: s*/
+	template<typename T, class E>
+	void random_int(T *out, int size, int min, int max, uint64_t seed, E& exec) {
+		if (min > max) throw fast_container_exception();
+		uint64_t range = (uint64_t)((int64_t)max - min) + 1;
+		philox_for_each_chunk(size, seed, [&](int first, const uint32_t *bits, int count) {
+			T *o = out + first;
+			for (int i = 0; i < count; i++) o[i] = (T)(min + (int64_t)(((uint64_t)bits[i] * range) >> 32));
+		}, exec);
+	}
+
+	/*out[0]`out[size - 1]  :mean, W΍:sd ̐K (Box-Muller@ seedȂsɊւ炸l)
+	exec: s*/
+	template<typename T, class E>
+	void random_normal(T *out, int size, T mean, T sd, uint64_t seed, E& exec) {
+		using C = typename RandomCompute<T>::type;
+		C m = (C)mean;
+		C s = (C)sd;
+		auto kernel = get_random_kernels<C>().normal;
+		philox_for_each_chunk(size, seed, [&](int first, const uint32_t *bits, int count) {
+			//RANDOM_CHUNKPʂō̂ŁA[16rbg_Ȃǂ͍Ɨ̈ŌvZ
+			C *direct = count == RANDOM_CHUNK ? RandomDirectOutput<T, C>::get(out + first) : nullptr;
+			if (direct != nullptr) {
+				kernel(bits, direct, m, s);
+				return;
+			}
+			alignas(64) C buf[RANDOM_CHUNK];
+			kernel(bits, buf, m, s);
+			for (int i = 0; i < count; i++) out[first + i] = (T)buf[i];
+		}, exec);
+	}
+
+	/*
+	out[0]`out[size - 1]  0`size - 1 בւ̏ (seedȂsɊւ炸l)
+	ŃoPbg֐U蕪ĂAoPbgɕʂ̌nFisher-YatesVbt
+	exec: s
+	*/
+	template<class E>
+	void random_permutation(int *out, int size, uint64_t seed, E& exec) {
+		if (size <= 0) return;
+		//1oPbgLbVɎ܂x̑傫ɂȂ悤ɕ
+		const int bucket_size = 4096;
+		int buckets = std::max(1, std::min(256, size / bucket_size));
+		FastStorage<int> keys(size);
+		random_int(keys.data(), size, 0, buckets - 1, seed, exec);
+		FastStorage<int> offsets(buckets + 1, 0);
+		for (int i = 0; i < size; i++) offsets[keys[i] + 1]++;
+		for (int b = 0; b < buckets; b++) offsets[b + 1] += offsets[b];
+		FastStorage<int> next(offsets.begin(), offsets.end() - 1);
+		for (int i = 0; i < size; i++) out[next[keys[i]]++] = i;
+		exec.parallel_for_range(0, buckets, [&](int begin, int end) {
+			alignas(64) uint32_t bits[RANDOM_CHUNK];
+			for (int b = begin; b < end; b++) {
+				Philox4x32 generator(seed, (uint64_t)b + 1);
+				int *o = out + offsets[b];
+				int n = offsets[b + 1] - offsets[b];
+				//납珇 [0, i] ̗̈ʒuƓւ
+				for (int step = 0; step < n - 1; step += RANDOM_CHUNK) {
+					generator.generate_blocks((uint64_t)(step / 4), RANDOM_CHUNK / 4, bits);
+					int count = std::min(RANDOM_CHUNK, n - 1 - step);
+					for (int k = 0; k < count; k++) {
+						int i = n - 1 - step - k;
+						int j = (int)(((uint64_t)bits[k] * (uint64_t)(i + 1)) >> 32);
+						std::swap(o[i], o[j]);
+					}
+				}
+			}
+		}, 1);
+	}
+
 	/*min`max̗*/
 	template<typename T>
 	class RealRandom {
@@ -0,0 +1,114 @@
+/*
+߃Zbg̗̃J[l (Random.hpp 疽߃ZbgɎ荞 #pragma once Ȃ)
+S: ߃Zbg̃WX^ (荞ޖOԂ̖߃Zbĝ)
+*/
+
+	/*
+	sin(2u), cos(2u) SIMDŌvZ (Cephes̑ߎ)
+	u1/4PʂŊۂ߂ |x| <= /4 ̑ɂAیsin, cosւ
+	*/
+	template<class S, typename T>
+	struct SimdSincos;
+
+	template<class S>
+	struct SimdSincos<S, double> {
+		using reg = typename S::reg;
+		static reg sin_poly(reg x, reg z) {
+			reg y = S::set1(1.58962301576546568060E-10);
+			y = S::fmadd(y, z, S::set1(-2.50507477628578072866E-8));
+			y = S::fmadd(y, z, S::set1(2.75573136213857245213E-6));
+			y = S::fmadd(y, z, S::set1(-1.98412698295895385996E-4));
+			y = S::fmadd(y, z, S::set1(8.33333333332211858878E-3));
+			y = S::fmadd(y, z, S::set1(-1.66666666666666307295E-1));
+			return S::fmadd(S::mul(y, z), x, x);
+		}
+		static reg cos_poly(reg z) {
+			reg y = S::set1(-1.13585365213876817300E-11);
+			y = S::fmadd(y, z, S::set1(2.08757008419747316778E-9));
+			y = S::fmadd(y, z, S::set1(-2.75573141792967388112E-7));
+			y = S::fmadd(y, z, S::set1(2.48015872888517045348E-5));
+			y = S::fmadd(y, z, S::set1(-1.38888888888730564116E-3));
+			y = S::fmadd(y, z, S::set1(4.16666666666665929218E-2));
+			return S::fmadd(S::mul(y, z), z, S::fmadd(z, S::set1(-0.5), S::set1(1.0)));
+		}
+	};
+
+	template<class S>
+	struct SimdSincos<S, float> {
+		using reg = typename S::reg;
+		static reg sin_poly(reg x, reg z) {
+			reg y = S::set1(-1.9515295891E-4f);
+			y = S::fmadd(y, z, S::set1(8.3321608736E-3f));
+			y = S::fmadd(y, z, S::set1(-1.6666654611E-1f));
+			return S::fmadd(S::mul(y, z), x, x);
+		}
+		static reg cos_poly(reg z) {
+			reg y = S::set1(2.443315711809948E-5f);
+			y = S::fmadd(y, z, S::set1(-1.388731625493765E-3f));
+			y = S::fmadd(y, z, S::set1(4.166664568298827E-2f));
+			return S::fmadd(S::mul(y, z), z, S::fmadd(z, S::set1(-0.5f), S::set1(1.0f)));
+		}
+	};
+
+	/*u: [0, 1) ̈l*/
+	template<class S, typename T>
+	void simd_sincos_2pi(typename S::reg u, typename S::reg& s, typename S::reg& c) {
+		using reg = typename S::reg;
+		//u = q / 4 + f (|f| <= 1/8) ɂĂx = 2f
+		reg q = S::round(S::mul(u, S::set1((T)4)));
+		reg f = S::sub(u, S::mul(q, S::set1((T)0.25)));
+		reg x = S::mul(f, S::set1((T)6.283185307179586));
+		reg z = S::mul(x, x);
+		reg sx = SimdSincos<S, T>::sin_poly(x, z);
+		reg cx = SimdSincos<S, T>::cos_poly(z);
+		reg zero = S::set1((T)0);
+		reg nsx = S::sub(zero, sx);
+		reg ncx = S::sub(zero, cx);
+		//q = 4  q = 0 Ɠ
+		auto q1 = S::eq(q, S::set1((T)1));
+		auto q2 = S::eq(q, S::set1((T)2));
+		auto q3 = S::eq(q, S::set1((T)3));
+		s = S::select(q1, cx, S::select(q2, nsx, S::select(q3, ncx, sx)));
+		c = S::select(q1, nsx, S::select(q2, ncx, S::select(q3, sx, cx)));
+	}
+
+	/*
+	̃J[l
+	uniform: bits[0]`bits[count - 1]  lo`lo + width ̈l
+	normal: bits[RANDOM_CHUNK] 畽:mean, W΍:sd ̐KRANDOM_CHUNK
+	(Oƌ㔼̗gɂBox-Muller@ out[j]cos, out[j + RANDOM_CHUNK / 2]sin)
+	*/
+	template<class S, typename T>
+	struct SimdRandomKernel {
+		using reg = typename S::reg;
+		static void uniform(const uint32_t *bits, T *out, int count, T lo, T width) {
+			reg l = S::set1(lo);
+			reg w = S::set1(width);
+			int i = 0;
+			for (; i + S::width <= count; i += S::width) S::store(out + i, S::fmadd(SimdRandomBits<S>::uniform(bits + i), w, l));
+			for (; i < count; i++) out[i] = lo + width * uniform_from_bits(bits[i], T());
+		}
+		static void normal(const uint32_t *bits, T *out, T mean, T sd) {
+			const int half = RANDOM_CHUNK / 2;
+			reg m = S::set1(mean);
+			reg open = S::set1(uniform_open_from_bits(0, T()));
+			reg minus_two_sd2 = S::set1((T)-2 * sd * sd);
+			for (int j = 0; j < half; j += S::width) {
+				reg u1 = S::add(SimdRandomBits<S>::uniform(bits + j), open);
+				reg u2 = SimdRandomBits<S>::uniform(bits + j + half);
+				reg r = S::sqrt(S::mul(minus_two_sd2, SimdFunction<S, T>::log(u1)));
+				reg s, c;
+				simd_sincos_2pi<S, T>(u2, s, c);
+				S::store(out + j, S::fmadd(r, c, m));
+				S::store(out + j + half, S::fmadd(r, s, m));
+			}
+		}
+	};
+
+	/*̃J[l̕\ւ̖߃Zbg̃J[lo^*/
+	template<class S, typename T>
+	void register_random_kernels(RandomKernelTable<T>& table, SimdLevel level) {
+		table.level = level;
+		table.uniform = &SimdRandomKernel<S, T>::uniform;
+		table.normal = &SimdRandomKernel<S, T>::normal;
+	}
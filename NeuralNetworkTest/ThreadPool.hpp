@@ -0,0 +1,190 @@
+#pragma once
+
+#include "FastContainerLibrary.hpp"
+
+namespace FastContainer {
+
+	/*
+	[NXeB[O^Xbhv[
+	(e[J[̗[L[AɂȂƑ̃L[瓐)
+	*/
+	class ThreadPool {
+	public:
+		/*thread_num: ĂяoXbhȊÕ[J[*/
+		explicit ThreadPool(int thread_num) {
+			if (thread_num < 0) thread_num = 0;
+			for (int i = 0; i < std::max(thread_num, 1); i++) queues.emplace_back(new WorkQueue());
+			for (int i = 0; i < thread_num; i++) threads.emplace_back([this, i]() { worker_loop(i); });
+		}
+		~ThreadPool() {
+			{
+				std::lock_guard<std::mutex> lock(sleep_mutex);
+				stop = true;
+			}
+			sleep_cv.notify_all();
+			for (auto&& th : threads) th.join();
+		}
+
+		/*vZXʂ̃CX^X*/
+		static ThreadPool& get_instance() {
+			static ThreadPool pool((int)std::thread::hardware_concurrency() - 1);
+			return pool;
+		}
+
+		/*ĂяoXbh܂߂x*/
+		int get_concurrency() { return (int)threads.size() + 1; }
+
+		/*[first, last)𕪊 func(begin, end) Ɏs
+		grain: 1^XN̍ŏvf*/
+		template<class F>
+		void parallel_for_range(int first, int last, F func, int grain = 1) {
+			int count = last - first;
+			if (count <= 0) return;
+			if (grain < 1) grain = 1;
+			int task_num = std::min(get_concurrency() * 4, (count + grain - 1) / grain);
+			if (task_num <= 1 || threads.empty()) {
+				func(first, last);
+				return;
+			}
+			TaskGroup group;
+			group.pending = task_num;
+			int index = get_worker_index();
+			for (int i = 0; i < task_num; i++) {
+				Task task;
+				task.invoke = &invoke_range<F>;
+				task.func = &func;
+				task.first = first + (int)((long long)count * i / task_num);
+				task.last = first + (int)((long long)count * (i + 1) / task_num);
+				task.group = &group;
+				push(index >= 0 ? index : i % (int)queues.size(), task);
+			}
+			{
+				std::lock_guard<std::mutex> lock(sleep_mutex);
+			}
+			sleep_cv.notify_all();
+			//܂ŌĂяoXbh`
+			while (group.pending.load(std::memory_order_acquire) > 0) {
+				Task task;
+				if (pop(index, task)) run(task);
+				else std::this_thread::yield();
+			}
+			if (group.error) std::rethrow_exception(group.error);
+		}
+
+		/*[first, last)̊eCfbNX func(i) Ɏs*/
+		template<class F>
+		void parallel_for(int first, int last, F func, int grain = 1) {
+			parallel_for_range(first, last, [&](int begin, int end) {
+				for (int i = begin; i < end; i++) func(i);
+			}, grain);
+		}
+
+	private:
+		struct TaskGroup {
+			std::atomic<int> pending;
+			std::mutex error_mutex;
+			std::exception_ptr error;
+		};
+		struct Task {
+			void(*invoke)(const void *func, int first, int last);
+			const void *func;
+			int first;
+			int last;
+			TaskGroup *group;
+		};
+		struct WorkQueue {
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		template<class F>
+		static void invoke_range(const void *func, int first, int last) {
+			(*(F *)func)(first, last);
+		}
+
+		/*[J[̔ԍ ([J[ȊO-1)*/
+		static int& get_worker_index() {
+			thread_local int index = -1;
+			return index;
+		}
+
+		void push(int index, const Task& task) {
+			{
+				std::lock_guard<std::mutex> lock(queues[index]->mutex);
+				queues[index]->tasks.push_back(task);
+			}
+			queued.fetch_add(1, std::memory_order_release);
+		}
+
+		/*̃L[̖oAΑ̃L[̐擪瓐*/
+		bool pop(int index, Task& task) {
+			if (queued.load(std::memory_order_acquire) <= 0) return false;
+			int num = (int)queues.size();
+			if (index >= 0) {
+				std::lock_guard<std::mutex> lock(queues[index]->mutex);
+				auto& tasks = queues[index]->tasks;
+				if (!tasks.empty()) {
+					task = tasks.back();
+					tasks.pop_back();
+					queued.fetch_sub(1, std::memory_order_relaxed);
+					return true;
+				}
+			}
+			int start = index >= 0 ? index + 1 : 0;
+			for (int i = 0; i < num; i++) {
+				auto& queue = *queues[(start + i) % num];
+				std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+				if (!lock.owns_lock() || queue.tasks.empty()) continue;
+				task = queue.tasks.front();
+				queue.tasks.pop_front();
+				queued.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+			return false;
+		}
+
+		void run(Task& task) {
+			try {
+				task.invoke(task.func, task.first, task.last);
+			}
+			catch (...) {
+				std::lock_guard<std::mutex> lock(task.group->error_mutex);
+				if (!task.group->error) task.group->error = std::current_exception();
+			}
+			task.group->pending.fetch_sub(1, std::memory_order_release);
+		}
+
+		void worker_loop(int index) {
+			get_worker_index() = index;
+			while (true) {
+				Task task;
+				if (pop(index, task)) {
+					run(task);
+					continue;
+				}
+				std::unique_lock<std::mutex> lock(sleep_mutex);
+				sleep_cv.wait(lock, [&] { return stop || queued.load(std::memory_order_acquire) > 0; });
+				if (stop) return;
+			}
+		}
+
+		std::vector<std::unique_ptr<WorkQueue>> queues;
+		std::vector<std::thread> threads;
+		std::atomic<int> queued{ 0 };
+		std::mutex sleep_mutex;
+		std::condition_variable sleep_cv;
+		bool stop = false;
+	};
+
+	/*[first, last)̊eCfbNX func(i) Ɏs STD*/
+	template<class F>
+	void parallel_for(int first, int last, F func) { ThreadPool::get_instance().parallel_for(first, last, func); }
+
+	/*[first, last)𕪊 func(begin, end) Ɏs STD*/
+	template<class F>
+	void parallel_for_range(int first, int last, F func, int grain = 1) { ThreadPool::get_instance().parallel_for_range(first, last, func, grain); }
+
+}